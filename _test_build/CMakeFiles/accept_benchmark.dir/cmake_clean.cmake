@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/accept_benchmark.dir/src/accept_benchmark.cpp.o"
+  "CMakeFiles/accept_benchmark.dir/src/accept_benchmark.cpp.o.d"
+  "accept_benchmark"
+  "accept_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/accept_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/affinity_benchmark.dir/src/affinity_benchmark.cpp.o"
+  "CMakeFiles/affinity_benchmark.dir/src/affinity_benchmark.cpp.o.d"
+  "affinity_benchmark"
+  "affinity_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/affinity_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dispatch_benchmark.dir/src/dispatch_benchmark.cpp.o"
+  "CMakeFiles/dispatch_benchmark.dir/src/dispatch_benchmark.cpp.o.d"
+  "dispatch_benchmark"
+  "dispatch_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dispatch_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
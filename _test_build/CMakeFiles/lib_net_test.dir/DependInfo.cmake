@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/net/coroutine_layer.cpp" "CMakeFiles/lib_net_test.dir/test/net/coroutine_layer.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/coroutine_layer.cpp.o.d"
+  "/root/repo/test/net/datagram_socket.cpp" "CMakeFiles/lib_net_test.dir/test/net/datagram_socket.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/datagram_socket.cpp.o.d"
+  "/root/repo/test/net/detail/acceptor.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/acceptor.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/acceptor.cpp.o.d"
+  "/root/repo/test/net/detail/datagram_dispatcher.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/datagram_dispatcher.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/datagram_dispatcher.cpp.o.d"
+  "/root/repo/test/net/detail/datagram_transport.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/datagram_transport.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/datagram_transport.cpp.o.d"
+  "/root/repo/test/net/detail/frame_allocator.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/frame_allocator.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/frame_allocator.cpp.o.d"
+  "/root/repo/test/net/detail/manager_base.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/manager_base.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/manager_base.cpp.o.d"
+  "/root/repo/test/net/detail/manager_pool.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/manager_pool.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/manager_pool.cpp.o.d"
+  "/root/repo/test/net/detail/manager_table.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/manager_table.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/manager_table.cpp.o.d"
+  "/root/repo/test/net/detail/multiplexer_stats.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/multiplexer_stats.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/multiplexer_stats.cpp.o.d"
+  "/root/repo/test/net/detail/pollset_updater.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/pollset_updater.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/pollset_updater.cpp.o.d"
+  "/root/repo/test/net/detail/stream_transport.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/stream_transport.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/stream_transport.cpp.o.d"
+  "/root/repo/test/net/detail/timer_wheel.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/timer_wheel.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/timer_wheel.cpp.o.d"
+  "/root/repo/test/net/detail/transport_adaptor.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/transport_adaptor.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/transport_adaptor.cpp.o.d"
+  "/root/repo/test/net/detail/uring_multiplexer.cpp" "CMakeFiles/lib_net_test.dir/test/net/detail/uring_multiplexer.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/detail/uring_multiplexer.cpp.o.d"
+  "/root/repo/test/net/full_integration/stream_transport.cpp" "CMakeFiles/lib_net_test.dir/test/net/full_integration/stream_transport.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/full_integration/stream_transport.cpp.o.d"
+  "/root/repo/test/net/ip/v4_address.cpp" "CMakeFiles/lib_net_test.dir/test/net/ip/v4_address.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/ip/v4_address.cpp.o.d"
+  "/root/repo/test/net/ip/v4_endpoint.cpp" "CMakeFiles/lib_net_test.dir/test/net/ip/v4_endpoint.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/ip/v4_endpoint.cpp.o.d"
+  "/root/repo/test/net/multiplexer.cpp" "CMakeFiles/lib_net_test.dir/test/net/multiplexer.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/multiplexer.cpp.o.d"
+  "/root/repo/test/net/multiplexer_group.cpp" "CMakeFiles/lib_net_test.dir/test/net/multiplexer_group.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/multiplexer_group.cpp.o.d"
+  "/root/repo/test/net/socket_guard.cpp" "CMakeFiles/lib_net_test.dir/test/net/socket_guard.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/socket_guard.cpp.o.d"
+  "/root/repo/test/net/tcp_socket.cpp" "CMakeFiles/lib_net_test.dir/test/net/tcp_socket.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/tcp_socket.cpp.o.d"
+  "/root/repo/test/net/udp_datagram_socket.cpp" "CMakeFiles/lib_net_test.dir/test/net/udp_datagram_socket.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/udp_datagram_socket.cpp.o.d"
+  "/root/repo/test/net/uri.cpp" "CMakeFiles/lib_net_test.dir/test/net/uri.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net/uri.cpp.o.d"
+  "/root/repo/test/net_test_main.cpp" "CMakeFiles/lib_net_test.dir/test/net_test_main.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/net_test_main.cpp.o.d"
+  "/root/repo/test/util/binary_deserializer.cpp" "CMakeFiles/lib_net_test.dir/test/util/binary_deserializer.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/binary_deserializer.cpp.o.d"
+  "/root/repo/test/util/binary_serializer.cpp" "CMakeFiles/lib_net_test.dir/test/util/binary_serializer.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/binary_serializer.cpp.o.d"
+  "/root/repo/test/util/cli_parser.cpp" "CMakeFiles/lib_net_test.dir/test/util/cli_parser.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/cli_parser.cpp.o.d"
+  "/root/repo/test/util/config.cpp" "CMakeFiles/lib_net_test.dir/test/util/config.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/config.cpp.o.d"
+  "/root/repo/test/util/cpu_affinity.cpp" "CMakeFiles/lib_net_test.dir/test/util/cpu_affinity.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/cpu_affinity.cpp.o.d"
+  "/root/repo/test/util/cycle_clock.cpp" "CMakeFiles/lib_net_test.dir/test/util/cycle_clock.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/cycle_clock.cpp.o.d"
+  "/root/repo/test/util/format.cpp" "CMakeFiles/lib_net_test.dir/test/util/format.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/format.cpp.o.d"
+  "/root/repo/test/util/histogram.cpp" "CMakeFiles/lib_net_test.dir/test/util/histogram.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/histogram.cpp.o.d"
+  "/root/repo/test/util/intrusive_ptr.cpp" "CMakeFiles/lib_net_test.dir/test/util/intrusive_ptr.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/intrusive_ptr.cpp.o.d"
+  "/root/repo/test/util/mpsc_queue.cpp" "CMakeFiles/lib_net_test.dir/test/util/mpsc_queue.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/mpsc_queue.cpp.o.d"
+  "/root/repo/test/util/ref_counted.cpp" "CMakeFiles/lib_net_test.dir/test/util/ref_counted.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/ref_counted.cpp.o.d"
+  "/root/repo/test/util/scope_guard.cpp" "CMakeFiles/lib_net_test.dir/test/util/scope_guard.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/scope_guard.cpp.o.d"
+  "/root/repo/test/util/serialized_size.cpp" "CMakeFiles/lib_net_test.dir/test/util/serialized_size.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/serialized_size.cpp.o.d"
+  "/root/repo/test/util/slot_table.cpp" "CMakeFiles/lib_net_test.dir/test/util/slot_table.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/slot_table.cpp.o.d"
+  "/root/repo/test/util/token_bucket.cpp" "CMakeFiles/lib_net_test.dir/test/util/token_bucket.cpp.o" "gcc" "CMakeFiles/lib_net_test.dir/test/util/token_bucket.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/net.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,90 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lib_net_test.dir/test/net/coroutine_layer.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/coroutine_layer.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/datagram_socket.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/datagram_socket.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/acceptor.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/acceptor.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/datagram_dispatcher.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/datagram_dispatcher.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/datagram_transport.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/datagram_transport.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/frame_allocator.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/frame_allocator.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/manager_base.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/manager_base.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/manager_pool.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/manager_pool.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/manager_table.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/manager_table.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/multiplexer_stats.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/multiplexer_stats.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/pollset_updater.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/pollset_updater.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/stream_transport.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/stream_transport.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/timer_wheel.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/timer_wheel.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/transport_adaptor.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/transport_adaptor.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/uring_multiplexer.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/detail/uring_multiplexer.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/full_integration/stream_transport.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/full_integration/stream_transport.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/ip/v4_address.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/ip/v4_address.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/ip/v4_endpoint.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/ip/v4_endpoint.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/multiplexer.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/multiplexer.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/multiplexer_group.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/multiplexer_group.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/socket_guard.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/socket_guard.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/tcp_socket.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/tcp_socket.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/udp_datagram_socket.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/udp_datagram_socket.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net/uri.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net/uri.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/net_test_main.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/net_test_main.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/binary_deserializer.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/binary_deserializer.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/binary_serializer.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/binary_serializer.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/cli_parser.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/cli_parser.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/config.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/config.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/cpu_affinity.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/cpu_affinity.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/cycle_clock.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/cycle_clock.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/format.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/format.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/histogram.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/histogram.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/intrusive_ptr.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/intrusive_ptr.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/mpsc_queue.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/mpsc_queue.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/ref_counted.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/ref_counted.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/scope_guard.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/scope_guard.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/serialized_size.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/serialized_size.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/slot_table.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/slot_table.cpp.o.d"
+  "CMakeFiles/lib_net_test.dir/test/util/token_bucket.cpp.o"
+  "CMakeFiles/lib_net_test.dir/test/util/token_bucket.cpp.o.d"
+  "lib_net_test"
+  "lib_net_test.pdb"
+  "lib_net_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lib_net_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,56 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/net/connection.cpp" "CMakeFiles/net.dir/src/net/connection.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/connection.cpp.o.d"
+  "/root/repo/src/net/detail/acceptor.cpp" "CMakeFiles/net.dir/src/net/detail/acceptor.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/acceptor.cpp.o.d"
+  "/root/repo/src/net/detail/epoll_multiplexer.cpp" "CMakeFiles/net.dir/src/net/detail/epoll_multiplexer.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/epoll_multiplexer.cpp.o.d"
+  "/root/repo/src/net/detail/frame_allocator.cpp" "CMakeFiles/net.dir/src/net/detail/frame_allocator.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/frame_allocator.cpp.o.d"
+  "/root/repo/src/net/detail/kqueue_multiplexer.cpp" "CMakeFiles/net.dir/src/net/detail/kqueue_multiplexer.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/kqueue_multiplexer.cpp.o.d"
+  "/root/repo/src/net/detail/manager_base.cpp" "CMakeFiles/net.dir/src/net/detail/manager_base.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/manager_base.cpp.o.d"
+  "/root/repo/src/net/detail/manager_pool.cpp" "CMakeFiles/net.dir/src/net/detail/manager_pool.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/manager_pool.cpp.o.d"
+  "/root/repo/src/net/detail/manager_table.cpp" "CMakeFiles/net.dir/src/net/detail/manager_table.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/manager_table.cpp.o.d"
+  "/root/repo/src/net/detail/multiplexer_base.cpp" "CMakeFiles/net.dir/src/net/detail/multiplexer_base.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/multiplexer_base.cpp.o.d"
+  "/root/repo/src/net/detail/multiplexer_stats.cpp" "CMakeFiles/net.dir/src/net/detail/multiplexer_stats.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/multiplexer_stats.cpp.o.d"
+  "/root/repo/src/net/detail/pollset_updater.cpp" "CMakeFiles/net.dir/src/net/detail/pollset_updater.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/pollset_updater.cpp.o.d"
+  "/root/repo/src/net/detail/timer_wheel.cpp" "CMakeFiles/net.dir/src/net/detail/timer_wheel.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/timer_wheel.cpp.o.d"
+  "/root/repo/src/net/detail/uring_manager.cpp" "CMakeFiles/net.dir/src/net/detail/uring_manager.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/uring_manager.cpp.o.d"
+  "/root/repo/src/net/detail/uring_multiplexer.cpp" "CMakeFiles/net.dir/src/net/detail/uring_multiplexer.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/detail/uring_multiplexer.cpp.o.d"
+  "/root/repo/src/net/ip/v4_address.cpp" "CMakeFiles/net.dir/src/net/ip/v4_address.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/ip/v4_address.cpp.o.d"
+  "/root/repo/src/net/ip/v4_endpoint.cpp" "CMakeFiles/net.dir/src/net/ip/v4_endpoint.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/ip/v4_endpoint.cpp.o.d"
+  "/root/repo/src/net/multiplexer.cpp" "CMakeFiles/net.dir/src/net/multiplexer.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/multiplexer.cpp.o.d"
+  "/root/repo/src/net/operation.cpp" "CMakeFiles/net.dir/src/net/operation.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/operation.cpp.o.d"
+  "/root/repo/src/net/placement_policy.cpp" "CMakeFiles/net.dir/src/net/placement_policy.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/placement_policy.cpp.o.d"
+  "/root/repo/src/net/socket/datagram_socket.cpp" "CMakeFiles/net.dir/src/net/socket/datagram_socket.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/socket/datagram_socket.cpp.o.d"
+  "/root/repo/src/net/socket/event_socket.cpp" "CMakeFiles/net.dir/src/net/socket/event_socket.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/socket/event_socket.cpp.o.d"
+  "/root/repo/src/net/socket/pipe_socket.cpp" "CMakeFiles/net.dir/src/net/socket/pipe_socket.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/socket/pipe_socket.cpp.o.d"
+  "/root/repo/src/net/socket/socket.cpp" "CMakeFiles/net.dir/src/net/socket/socket.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/socket/socket.cpp.o.d"
+  "/root/repo/src/net/socket/stream_socket.cpp" "CMakeFiles/net.dir/src/net/socket/stream_socket.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/socket/stream_socket.cpp.o.d"
+  "/root/repo/src/net/socket/tcp_accept_socket.cpp" "CMakeFiles/net.dir/src/net/socket/tcp_accept_socket.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/socket/tcp_accept_socket.cpp.o.d"
+  "/root/repo/src/net/socket/tcp_stream_socket.cpp" "CMakeFiles/net.dir/src/net/socket/tcp_stream_socket.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/socket/tcp_stream_socket.cpp.o.d"
+  "/root/repo/src/net/socket/udp_datagram_socket.cpp" "CMakeFiles/net.dir/src/net/socket/udp_datagram_socket.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/socket/udp_datagram_socket.cpp.o.d"
+  "/root/repo/src/net/uri.cpp" "CMakeFiles/net.dir/src/net/uri.cpp.o" "gcc" "CMakeFiles/net.dir/src/net/uri.cpp.o.d"
+  "/root/repo/src/openssl/tls_context.cpp" "CMakeFiles/net.dir/src/openssl/tls_context.cpp.o" "gcc" "CMakeFiles/net.dir/src/openssl/tls_context.cpp.o.d"
+  "/root/repo/src/openssl/tls_session.cpp" "CMakeFiles/net.dir/src/openssl/tls_session.cpp.o" "gcc" "CMakeFiles/net.dir/src/openssl/tls_session.cpp.o.d"
+  "/root/repo/src/util/binary_deserializer.cpp" "CMakeFiles/net.dir/src/util/binary_deserializer.cpp.o" "gcc" "CMakeFiles/net.dir/src/util/binary_deserializer.cpp.o.d"
+  "/root/repo/src/util/binary_serializer.cpp" "CMakeFiles/net.dir/src/util/binary_serializer.cpp.o" "gcc" "CMakeFiles/net.dir/src/util/binary_serializer.cpp.o.d"
+  "/root/repo/src/util/cli_parser.cpp" "CMakeFiles/net.dir/src/util/cli_parser.cpp.o" "gcc" "CMakeFiles/net.dir/src/util/cli_parser.cpp.o.d"
+  "/root/repo/src/util/config.cpp" "CMakeFiles/net.dir/src/util/config.cpp.o" "gcc" "CMakeFiles/net.dir/src/util/config.cpp.o.d"
+  "/root/repo/src/util/cpu_affinity.cpp" "CMakeFiles/net.dir/src/util/cpu_affinity.cpp.o" "gcc" "CMakeFiles/net.dir/src/util/cpu_affinity.cpp.o.d"
+  "/root/repo/src/util/cycle_clock.cpp" "CMakeFiles/net.dir/src/util/cycle_clock.cpp.o" "gcc" "CMakeFiles/net.dir/src/util/cycle_clock.cpp.o.d"
+  "/root/repo/src/util/error.cpp" "CMakeFiles/net.dir/src/util/error.cpp.o" "gcc" "CMakeFiles/net.dir/src/util/error.cpp.o.d"
+  "/root/repo/src/util/format.cpp" "CMakeFiles/net.dir/src/util/format.cpp.o" "gcc" "CMakeFiles/net.dir/src/util/format.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
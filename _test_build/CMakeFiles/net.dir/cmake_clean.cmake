@@ -0,0 +1,85 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net.dir/src/net/connection.cpp.o"
+  "CMakeFiles/net.dir/src/net/connection.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/acceptor.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/acceptor.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/epoll_multiplexer.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/epoll_multiplexer.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/frame_allocator.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/frame_allocator.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/kqueue_multiplexer.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/kqueue_multiplexer.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/manager_base.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/manager_base.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/manager_pool.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/manager_pool.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/manager_table.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/manager_table.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/multiplexer_base.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/multiplexer_base.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/multiplexer_stats.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/multiplexer_stats.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/pollset_updater.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/pollset_updater.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/timer_wheel.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/timer_wheel.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/uring_manager.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/uring_manager.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/detail/uring_multiplexer.cpp.o"
+  "CMakeFiles/net.dir/src/net/detail/uring_multiplexer.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/ip/v4_address.cpp.o"
+  "CMakeFiles/net.dir/src/net/ip/v4_address.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/ip/v4_endpoint.cpp.o"
+  "CMakeFiles/net.dir/src/net/ip/v4_endpoint.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/multiplexer.cpp.o"
+  "CMakeFiles/net.dir/src/net/multiplexer.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/operation.cpp.o"
+  "CMakeFiles/net.dir/src/net/operation.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/placement_policy.cpp.o"
+  "CMakeFiles/net.dir/src/net/placement_policy.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/socket/datagram_socket.cpp.o"
+  "CMakeFiles/net.dir/src/net/socket/datagram_socket.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/socket/event_socket.cpp.o"
+  "CMakeFiles/net.dir/src/net/socket/event_socket.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/socket/pipe_socket.cpp.o"
+  "CMakeFiles/net.dir/src/net/socket/pipe_socket.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/socket/socket.cpp.o"
+  "CMakeFiles/net.dir/src/net/socket/socket.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/socket/stream_socket.cpp.o"
+  "CMakeFiles/net.dir/src/net/socket/stream_socket.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/socket/tcp_accept_socket.cpp.o"
+  "CMakeFiles/net.dir/src/net/socket/tcp_accept_socket.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/socket/tcp_stream_socket.cpp.o"
+  "CMakeFiles/net.dir/src/net/socket/tcp_stream_socket.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/socket/udp_datagram_socket.cpp.o"
+  "CMakeFiles/net.dir/src/net/socket/udp_datagram_socket.cpp.o.d"
+  "CMakeFiles/net.dir/src/net/uri.cpp.o"
+  "CMakeFiles/net.dir/src/net/uri.cpp.o.d"
+  "CMakeFiles/net.dir/src/openssl/tls_context.cpp.o"
+  "CMakeFiles/net.dir/src/openssl/tls_context.cpp.o.d"
+  "CMakeFiles/net.dir/src/openssl/tls_session.cpp.o"
+  "CMakeFiles/net.dir/src/openssl/tls_session.cpp.o.d"
+  "CMakeFiles/net.dir/src/util/binary_deserializer.cpp.o"
+  "CMakeFiles/net.dir/src/util/binary_deserializer.cpp.o.d"
+  "CMakeFiles/net.dir/src/util/binary_serializer.cpp.o"
+  "CMakeFiles/net.dir/src/util/binary_serializer.cpp.o.d"
+  "CMakeFiles/net.dir/src/util/cli_parser.cpp.o"
+  "CMakeFiles/net.dir/src/util/cli_parser.cpp.o.d"
+  "CMakeFiles/net.dir/src/util/config.cpp.o"
+  "CMakeFiles/net.dir/src/util/config.cpp.o.d"
+  "CMakeFiles/net.dir/src/util/cpu_affinity.cpp.o"
+  "CMakeFiles/net.dir/src/util/cpu_affinity.cpp.o.d"
+  "CMakeFiles/net.dir/src/util/cycle_clock.cpp.o"
+  "CMakeFiles/net.dir/src/util/cycle_clock.cpp.o.d"
+  "CMakeFiles/net.dir/src/util/error.cpp.o"
+  "CMakeFiles/net.dir/src/util/error.cpp.o.d"
+  "CMakeFiles/net.dir/src/util/format.cpp.o"
+  "CMakeFiles/net.dir/src/util/format.cpp.o.d"
+  "libnet.a"
+  "libnet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/placement_benchmark.dir/src/placement_benchmark.cpp.o"
+  "CMakeFiles/placement_benchmark.dir/src/placement_benchmark.cpp.o.d"
+  "placement_benchmark"
+  "placement_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/placement_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,447 @@
+add_test([=[coroutine_layer_test.echo]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=coroutine_layer_test.echo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[coroutine_layer_test.echo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[coroutine_layer_test.echo_exceeding_the_read_size]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=coroutine_layer_test.echo_exceeding_the_read_size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[coroutine_layer_test.echo_exceeding_the_read_size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[coroutine_layer_test.nested_tasks_and_pipelined_requests]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=coroutine_layer_test.nested_tasks_and_pipelined_requests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[coroutine_layer_test.nested_tasks_and_pipelined_requests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[coroutine_layer_test.sleep]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=coroutine_layer_test.sleep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[coroutine_layer_test.sleep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[coroutine_layer_test.connection_closes_when_coroutine_returns]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=coroutine_layer_test.connection_closes_when_coroutine_returns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[coroutine_layer_test.connection_closes_when_coroutine_returns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[coroutine_layer_test.connection_closes_when_coroutine_throws]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=coroutine_layer_test.connection_closes_when_coroutine_throws]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[coroutine_layer_test.connection_closes_when_coroutine_throws]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[coroutine_layer_test.frames_are_reused]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=coroutine_layer_test.frames_are_reused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[coroutine_layer_test.frames_are_reused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[datagram_socket.write]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=datagram_socket.write]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[datagram_socket.write]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.mpx_shuts_down_correctly]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.mpx_shuts_down_correctly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.mpx_shuts_down_correctly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.mpx_accepts_connections]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.mpx_accepts_connections]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.mpx_accepts_connections]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.manager_removed_after_disconnect]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.manager_removed_after_disconnect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.manager_removed_after_disconnect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.event_handling]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.event_handling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.event_handling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.chained_timeouts]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.chained_timeouts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.chained_timeouts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.multiple_timeouts_at_once]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.multiple_timeouts_at_once]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.multiple_timeouts_at_once]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.cancel_timeout]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.cancel_timeout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.cancel_timeout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.reschedule_timeout]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.reschedule_timeout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.reschedule_timeout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.timeouts_are_cancelled_on_removal]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.timeouts_are_cancelled_on_removal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.timeouts_are_cancelled_on_removal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.post_from_multiplexer_thread_is_deferred]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.post_from_multiplexer_thread_is_deferred]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.post_from_multiplexer_thread_is_deferred]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.dispatch_runs_inline_on_multiplexer_thread]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.dispatch_runs_inline_on_multiplexer_thread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.dispatch_runs_inline_on_multiplexer_thread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.post_from_other_threads]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.post_from_other_threads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.post_from_other_threads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.post_fails_after_shutdown]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.post_fails_after_shutdown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.post_fails_after_shutdown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.multiplexer_threads_give_up_on_full_queues]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.multiplexer_threads_give_up_on_full_queues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.multiplexer_threads_give_up_on_full_queues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.migrate_moves_manager_with_timeouts]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.migrate_moves_manager_with_timeouts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.migrate_moves_manager_with_timeouts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.migrate_managers_skips_internal_managers]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.migrate_managers_skips_internal_managers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.migrate_managers_skips_internal_managers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.invalid_placement_is_rejected]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.invalid_placement_is_rejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.invalid_placement_is_rejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.accepting_pauses_while_overloaded]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.accepting_pauses_while_overloaded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.accepting_pauses_while_overloaded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.timers_have_sub_millisecond_precision]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.timers_have_sub_millisecond_precision]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.timers_have_sub_millisecond_precision]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.thread_is_pinned_to_configured_cpus]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.thread_is_pinned_to_configured_cpus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.thread_is_pinned_to_configured_cpus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.timerfd_timers_have_sub_millisecond_precision]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.timerfd_timers_have_sub_millisecond_precision]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.timerfd_timers_have_sub_millisecond_precision]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.busy_managers_take_turns]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.busy_managers_take_turns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.busy_managers_take_turns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.busy_managers_are_queued_once]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.busy_managers_are_queued_once]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.busy_managers_are_queued_once]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.event_batch_adapts_to_load]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.event_batch_adapts_to_load]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.event_batch_adapts_to_load]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_test.invalid_scheduling_configuration_is_rejected]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_test.invalid_scheduling_configuration_is_rejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_test.invalid_scheduling_configuration_is_rejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_profiling_test.stats_are_collected]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_profiling_test.stats_are_collected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_profiling_test.stats_are_collected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_profiling_test.slow_handlers_are_reported]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_profiling_test.slow_handlers_are_reported]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_profiling_test.slow_handlers_are_reported]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_profiling_test.most_expensive_managers]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_profiling_test.most_expensive_managers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_profiling_test.most_expensive_managers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[placement_policy.parse]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=placement_policy.parse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[placement_policy.parse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group.invalid_config]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group.invalid_config]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group.invalid_config]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_rebalance_test.moves_half_of_the_difference]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_rebalance_test.moves_half_of_the_difference]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_rebalance_test.moves_half_of_the_difference]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_rebalance_test.tolerates_differences_in_threshold]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_rebalance_test.tolerates_differences_in_threshold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_rebalance_test.tolerates_differences_in_threshold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_rebalance_test.rebalances_periodically]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_rebalance_test.rebalances_periodically]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_rebalance_test.rebalances_periodically]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[socket_guard_test.close]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=socket_guard_test.close]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[socket_guard_test.close]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[socket_guard_test.release]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=socket_guard_test.release]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[socket_guard_test.release]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[tcp_socket_test.accept]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=tcp_socket_test.accept]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[tcp_socket_test.accept]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[udp_datagram_socket_test.write]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=udp_datagram_socket_test.write]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[udp_datagram_socket_test.write]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[uri_test.parse]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=uri_test.parse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[uri_test.parse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.handle_read_event]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.handle_read_event]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.handle_read_event]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.accepts_batches_of_nonblocking_sockets]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.accepts_batches_of_nonblocking_sockets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.accepts_batches_of_nonblocking_sockets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.invalid_batch_size_is_rejected]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.invalid_batch_size_is_rejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.invalid_batch_size_is_rejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.sheds_connections_while_overloaded]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.sheds_connections_while_overloaded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.sheds_connections_while_overloaded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.sheds_connections_placed_on_lagging_targets]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.sheds_connections_placed_on_lagging_targets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.sheds_connections_placed_on_lagging_targets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.limits_connections_per_source]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.limits_connections_per_source]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.limits_connections_per_source]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.invalid_admission_control_is_rejected]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.invalid_admission_control_is_rejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.invalid_admission_control_is_rejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.defers_accepting]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.defers_accepting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.defers_accepting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_handler_acceptor_test.forgets_the_least_recently_seen_source]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_handler_acceptor_test.forgets_the_least_recently_seen_source]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_handler_acceptor_test.forgets_the_least_recently_seen_source]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[datagram_dispatcher_test.init]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=datagram_dispatcher_test.init]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[datagram_dispatcher_test.init]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[datagram_dispatcher_test.consume]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=datagram_dispatcher_test.consume]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[datagram_dispatcher_test.consume]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[datagram_dispatcher_test.produce]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=datagram_dispatcher_test.produce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[datagram_dispatcher_test.produce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[datagram_dispatcher_test.set_timeout_in]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=datagram_dispatcher_test.set_timeout_in]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[datagram_dispatcher_test.set_timeout_in]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[datagram_dispatcher_test.set_timeout_at]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=datagram_dispatcher_test.set_timeout_at]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[datagram_dispatcher_test.set_timeout_at]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[datagram_transport_test.handle_read_event]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=datagram_transport_test.handle_read_event]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[datagram_transport_test.handle_read_event]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[datagram_transport_test.handle_write_event]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=datagram_transport_test.handle_write_event]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[datagram_transport_test.handle_write_event]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[frame_allocator.reuses_released_frames]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=frame_allocator.reuses_released_frames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[frame_allocator.reuses_released_frames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[frame_allocator.size_classes_are_separate]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=frame_allocator.size_classes_are_separate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[frame_allocator.size_classes_are_separate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[frame_allocator.large_frames_are_not_cached]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=frame_allocator.large_frames_are_not_cached]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[frame_allocator.large_frames_are_not_cached]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[frame_allocator.cache_is_bounded]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=frame_allocator.cache_is_bounded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[frame_allocator.cache_is_bounded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_base_test.construction_and_destruction]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_base_test.construction_and_destruction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_base_test.construction_and_destruction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_base_test.mask_operations]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_base_test.mask_operations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_base_test.mask_operations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_pool_test.released_transports_are_reused]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_pool_test.released_transports_are_reused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_pool_test.released_transports_are_reused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_pool_test.next_layers_are_destroyed_on_release]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_pool_test.next_layers_are_destroyed_on_release]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_pool_test.next_layers_are_destroyed_on_release]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_pool_test.throwing_next_layers_leave_the_transport_pooled]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_pool_test.throwing_next_layers_leave_the_transport_pooled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_pool_test.throwing_next_layers_leave_the_transport_pooled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_pool_test.managers_without_recycle_are_deleted]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_pool_test.managers_without_recycle_are_deleted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_pool_test.managers_without_recycle_are_deleted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_pool_test.managers_released_on_other_threads_are_deleted]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_pool_test.managers_released_on_other_threads_are_deleted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_pool_test.managers_released_on_other_threads_are_deleted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_pool_test.managers_made_on_other_threads_are_constructed]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_pool_test.managers_made_on_other_threads_are_constructed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_pool_test.managers_made_on_other_threads_are_constructed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_pool_test.caches_are_bounded_per_type]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_pool_test.caches_are_bounded_per_type]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_pool_test.caches_are_bounded_per_type]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_table_test.emplace_and_find]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_table_test.emplace_and_find]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_table_test.emplace_and_find]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_table_test.erase]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_table_test.erase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_table_test.erase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_table_test.reused_descriptors_are_detected]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_table_test.reused_descriptors_are_detected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_table_test.reused_descriptors_are_detected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[manager_table_test.iteration]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=manager_table_test.iteration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[manager_table_test.iteration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_stats.record]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_stats.record]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_stats.record]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_stats.discard]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_stats.discard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_stats.discard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_stats.accepts_per_second]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_stats.accepts_per_second]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_stats.accepts_per_second]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_pollset_updater_test.init]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_pollset_updater_test.init]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_pollset_updater_test.init]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_pollset_updater_test.handle_shutdown]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_pollset_updater_test.handle_shutdown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_pollset_updater_test.handle_shutdown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_pollset_updater_test.handle_add]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_pollset_updater_test.handle_add]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_pollset_updater_test.handle_add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_pollset_updater_test.handle_all_commands_at_once]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_pollset_updater_test.handle_all_commands_at_once]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_pollset_updater_test.handle_all_commands_at_once]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_pollset_updater_test.drop_add_during_shutdown]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_pollset_updater_test.drop_add_during_shutdown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_pollset_updater_test.drop_add_during_shutdown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_stream_transport_test.handle_read_event]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_stream_transport_test.handle_read_event]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_stream_transport_test.handle_read_event]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_stream_transport_test.partial_read]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_stream_transport_test.partial_read]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_stream_transport_test.partial_read]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_stream_transport_test.consumes_bytes_received_elsewhere]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_stream_transport_test.consumes_bytes_received_elsewhere]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_stream_transport_test.consumes_bytes_received_elsewhere]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_stream_transport_test.handle_write_event]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_stream_transport_test.handle_write_event]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_stream_transport_test.handle_write_event]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_stream_transport_test.disconnect]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_stream_transport_test.disconnect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_stream_transport_test.disconnect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[event_stream_transport_test.timeout_handling]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=event_stream_transport_test.timeout_handling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[event_stream_transport_test.timeout_handling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[send_handle_test.send_from_multiplexer_thread]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=send_handle_test.send_from_multiplexer_thread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[send_handle_test.send_from_multiplexer_thread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[send_handle_test.send_from_other_threads]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=send_handle_test.send_from_other_threads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[send_handle_test.send_from_other_threads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[send_handle_test.send_follows_migration]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=send_handle_test.send_follows_migration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[send_handle_test.send_follows_migration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[send_handle_test.expires_with_transport]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=send_handle_test.expires_with_transport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[send_handle_test.expires_with_transport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[send_handle_test.send_fails_after_shutdown]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=send_handle_test.send_fails_after_shutdown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[send_handle_test.send_fails_after_shutdown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[drain_test.shutdown_flushes_pending_writes]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=drain_test.shutdown_flushes_pending_writes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[drain_test.shutdown_flushes_pending_writes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[drain_test.shutdown_closes_after_drain_timeout]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=drain_test.shutdown_closes_after_drain_timeout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[drain_test.shutdown_closes_after_drain_timeout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[drain_test.zero_drain_timeout_closes_immediately]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=drain_test.zero_drain_timeout_closes_immediately]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[drain_test.zero_drain_timeout_closes_immediately]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[watermark_test.crossing_watermarks_notifies_next_layer]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=watermark_test.crossing_watermarks_notifies_next_layer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[watermark_test.crossing_watermarks_notifies_next_layer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[watermark_test.reads_pause_while_writing_is_blocked]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=watermark_test.reads_pause_while_writing_is_blocked]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[watermark_test.reads_pause_while_writing_is_blocked]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[watermark_test.paused_managers_stay_registered]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=watermark_test.paused_managers_stay_registered]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[watermark_test.paused_managers_stay_registered]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[watermark_test.invalid_watermarks_are_rejected]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=watermark_test.invalid_watermarks_are_rejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[watermark_test.invalid_watermarks_are_rejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.empty]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.expires_in_order]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.expires_in_order]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.expires_in_order]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.does_not_expire_early]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.does_not_expire_early]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.does_not_expire_early]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.cascades_from_upper_levels]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.cascades_from_upper_levels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.cascades_from_upper_levels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.advances_over_many_ticks]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.advances_over_many_ticks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.advances_over_many_ticks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.past_deadlines_expire_immediately]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.past_deadlines_expire_immediately]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.past_deadlines_expire_immediately]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.timeouts_scheduled_while_expiring]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.timeouts_scheduled_while_expiring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.timeouts_scheduled_while_expiring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.cancel]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.cancel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.cancel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.reschedule]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.reschedule]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.reschedule]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.cancel_all]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.cancel_all]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.cancel_all]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.modified_while_expiring]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.modified_while_expiring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.modified_while_expiring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[timer_wheel_test.clear]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=timer_wheel_test.clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[timer_wheel_test.clear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[v4_address_test.init]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=v4_address_test.init]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[v4_address_test.init]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[v4_address_test.toString]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=v4_address_test.toString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[v4_address_test.toString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[v4_address_test.parse]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=v4_address_test.parse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[v4_address_test.parse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[v4_address_test.parsing_fails]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=v4_address_test.parsing_fails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[v4_address_test.parsing_fails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[v4_endpoint_test.parse]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=v4_endpoint_test.parse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[v4_endpoint_test.parse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[v4_endpoint_test.to_string]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=v4_endpoint_test.to_string]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[v4_endpoint_test.to_string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[v4_endpoint_test.from_sockaddr]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=v4_endpoint_test.from_sockaddr]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[v4_endpoint_test.from_sockaddr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[v4_endpoint_test.to_sockaddr]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=v4_endpoint_test.to_sockaddr]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[v4_endpoint_test.to_sockaddr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.empty_call]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.empty_call]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.empty_call]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.integer]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.integer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.integer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.byte]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.byte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.byte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.floats]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.floats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.floats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.string]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.string]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.pair]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.pair]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.pair]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.tuple]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.tuple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.tuple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.visit]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.visit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.visit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_deserializer.vector]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_deserializer.vector]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_deserializer.vector]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.empty_call]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.empty_call]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.empty_call]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.integer]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.integer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.integer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.byte]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.byte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.byte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.floats]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.floats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.floats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.string]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.string]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.pair]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.pair]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.pair]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.tuple]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.tuple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.tuple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.visit]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.visit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.visit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.c_style_array]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.c_style_array]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.c_style_array]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[binary_serializer.vector]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=binary_serializer.vector]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[binary_serializer.vector]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cli_parser.register_option]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cli_parser.register_option]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cli_parser.register_option]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cli_parser.parse_longform_options]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cli_parser.parse_longform_options]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cli_parser.parse_longform_options]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cli_parser.parse_shortform_options]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cli_parser.parse_shortform_options]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cli_parser.parse_shortform_options]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cli_parser.option_value_conversion]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cli_parser.option_value_conversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cli_parser.option_value_conversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[config.add_config_entry]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=config.add_config_entry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[config.add_config_entry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[config.set_config_entry]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=config.set_config_entry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[config.set_config_entry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[config.get]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=config.get]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[config.get]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[config.get_or]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=config.get_or]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[config.get_or]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[config.has_entry]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=config.has_entry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[config.has_entry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[config.parse]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=config.parse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[config.parse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cpu_affinity.parse_cpu_list]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cpu_affinity.parse_cpu_list]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cpu_affinity.parse_cpu_list]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cpu_affinity.parse_invalid_cpu_list]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cpu_affinity.parse_invalid_cpu_list]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cpu_affinity.parse_invalid_cpu_list]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cpu_affinity.pin_current_thread]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cpu_affinity.pin_current_thread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cpu_affinity.pin_current_thread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cpu_affinity.numa_node_cpus]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cpu_affinity.numa_node_cpus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cpu_affinity.numa_node_cpus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cycle_clock.monotonic]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cycle_clock.monotonic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cycle_clock.monotonic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cycle_clock.conversion]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cycle_clock.conversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cycle_clock.conversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[cycle_clock.measures_elapsed_time]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=cycle_clock.measures_elapsed_time]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[cycle_clock.measures_elapsed_time]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[format_test.replace_single_string]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=format_test.replace_single_string]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[format_test.replace_single_string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[format_test.replace_multiple_strings]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=format_test.replace_multiple_strings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[format_test.replace_multiple_strings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[format_test.replace_same_string_multiple_times]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=format_test.replace_same_string_multiple_times]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[format_test.replace_same_string_multiple_times]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[format_test.replace_to_stringable_types]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=format_test.replace_to_stringable_types]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[format_test.replace_to_stringable_types]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[format_test.split_string_by_string_delimiter]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=format_test.split_string_by_string_delimiter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[format_test.split_string_by_string_delimiter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[format_test.split_string_by_char_delimiter]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=format_test.split_string_by_char_delimiter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[format_test.split_string_by_char_delimiter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[format_test.join_string]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=format_test.join_string]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[format_test.join_string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[histogram.buckets]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=histogram.buckets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[histogram.buckets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[histogram.record]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=histogram.record]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[histogram.record]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[histogram.percentile]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=histogram.percentile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[histogram.percentile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[histogram.concurrent_read]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=histogram.concurrent_read]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[histogram.concurrent_read]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[intrusive_ptr_test.delete_called_on_destruction]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=intrusive_ptr_test.delete_called_on_destruction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[intrusive_ptr_test.delete_called_on_destruction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[intrusive_ptr_test.delete_called_on_reset]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=intrusive_ptr_test.delete_called_on_reset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[intrusive_ptr_test.delete_called_on_reset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[intrusive_ptr_test.copy_ptr]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=intrusive_ptr_test.copy_ptr]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[intrusive_ptr_test.copy_ptr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[intrusive_ptr_test.move_ptr]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=intrusive_ptr_test.move_ptr]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[intrusive_ptr_test.move_ptr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[intrusive_ptr_test.release]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=intrusive_ptr_test.release]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[intrusive_ptr_test.release]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[mpsc_queue.capacity]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=mpsc_queue.capacity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[mpsc_queue.capacity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[mpsc_queue.push_pop]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=mpsc_queue.push_pop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[mpsc_queue.push_pop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[mpsc_queue.full]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=mpsc_queue.full]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[mpsc_queue.full]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[mpsc_queue.wraparound]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=mpsc_queue.wraparound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[mpsc_queue.wraparound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[mpsc_queue.failed_push_does_not_move]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=mpsc_queue.failed_push_does_not_move]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[mpsc_queue.failed_push_does_not_move]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[mpsc_queue.destroys_remaining_elements]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=mpsc_queue.destroys_remaining_elements]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[mpsc_queue.destroys_remaining_elements]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[mpsc_queue.multiple_producers]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=mpsc_queue.multiple_producers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[mpsc_queue.multiple_producers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ref_counted_test.ref_counting]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=ref_counted_test.ref_counting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ref_counted_test.ref_counting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[scope_guard.func_executed]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=scope_guard.func_executed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[scope_guard.func_executed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[scope_guard.func_not_executed]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=scope_guard.func_not_executed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[scope_guard.func_not_executed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[scope_guard.reset]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=scope_guard.reset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[scope_guard.reset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.empty_call]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.empty_call]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.empty_call]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.integral_types]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.integral_types]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.integral_types]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.byte]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.byte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.byte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.enum]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.enum]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.enum]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.strings]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.strings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.strings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.mixed_types]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.mixed_types]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.mixed_types]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.pair]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.pair]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.pair]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.tuple]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.tuple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.tuple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.visit]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.visit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.visit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.c_style_array]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.c_style_array]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.c_style_array]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.integral_container]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.integral_container]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.integral_container]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.float_container]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.float_container]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.float_container]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.double_container]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.double_container]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.double_container]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.enum_container]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.enum_container]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.enum_container]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.string_container]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.string_container]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.string_container]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[serialized_size.visitable_container]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=serialized_size.visitable_container]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[serialized_size.visitable_container]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[slot_table.finds_inserted_values]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=slot_table.finds_inserted_values]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[slot_table.finds_inserted_values]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[slot_table.erased_keys_are_stale]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=slot_table.erased_keys_are_stale]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[slot_table.erased_keys_are_stale]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[slot_table.grows_when_full]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=slot_table.grows_when_full]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[slot_table.grows_when_full]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[token_bucket.admits_bursts]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=token_bucket.admits_bursts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[token_bucket.admits_bursts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[token_bucket.refills_at_rate]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=token_bucket.refills_at_rate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[token_bucket.refills_at_rate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[token_bucket.does_not_exceed_burst]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=token_bucket.does_not_exceed_burst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[token_bucket.does_not_exceed_burst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[stream_transport_full_integration.mirror<event_based>]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=stream_transport_full_integration/0.mirror]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[stream_transport_full_integration.mirror<event_based>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[stream_transport_full_integration.mirror_multiple_rounds<event_based>]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=stream_transport_full_integration/0.mirror_multiple_rounds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[stream_transport_full_integration.mirror_multiple_rounds<event_based>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[stream_transport_full_integration.mirror<edge_triggered_event_based>]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=stream_transport_full_integration/1.mirror]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[stream_transport_full_integration.mirror<edge_triggered_event_based>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[stream_transport_full_integration.mirror_multiple_rounds<edge_triggered_event_based>]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=stream_transport_full_integration/1.mirror_multiple_rounds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[stream_transport_full_integration.mirror_multiple_rounds<edge_triggered_event_based>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[edge_triggered_multiplexer.avoids_pollset_updates]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=edge_triggered_multiplexer.avoids_pollset_updates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[edge_triggered_multiplexer.avoids_pollset_updates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_tests/multiplexer_group_test.init/reuse_port  # GetParam() = reuse-port]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_tests/multiplexer_group_test.init/reuse_port]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_tests/multiplexer_group_test.init/reuse_port  # GetParam() = reuse-port]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_tests/multiplexer_group_test.init/round_robin  # GetParam() = round-robin]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_tests/multiplexer_group_test.init/round_robin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_tests/multiplexer_group_test.init/round_robin  # GetParam() = round-robin]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_tests/multiplexer_group_test.init/least_connections  # GetParam() = least-connections]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_tests/multiplexer_group_test.init/least_connections]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_tests/multiplexer_group_test.init/least_connections  # GetParam() = least-connections]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_tests/multiplexer_group_test.init/least_lag  # GetParam() = least-lag]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_tests/multiplexer_group_test.init/least_lag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_tests/multiplexer_group_test.init/least_lag  # GetParam() = least-lag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/reuse_port  # GetParam() = reuse-port]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/reuse_port]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/reuse_port  # GetParam() = reuse-port]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/round_robin  # GetParam() = round-robin]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/round_robin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/round_robin  # GetParam() = round-robin]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/least_connections  # GetParam() = least-connections]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/least_connections]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/least_connections  # GetParam() = least-connections]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/least_lag  # GetParam() = least-lag]=]  /root/repo/_test_build/lib_net_test [==[--gtest_filter=multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/least_lag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/least_lag  # GetParam() = least-lag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  lib_net_test_TESTS coroutine_layer_test.echo coroutine_layer_test.echo_exceeding_the_read_size coroutine_layer_test.nested_tasks_and_pipelined_requests coroutine_layer_test.sleep coroutine_layer_test.connection_closes_when_coroutine_returns coroutine_layer_test.connection_closes_when_coroutine_throws coroutine_layer_test.frames_are_reused datagram_socket.write multiplexer_test.mpx_shuts_down_correctly multiplexer_test.mpx_accepts_connections multiplexer_test.manager_removed_after_disconnect multiplexer_test.event_handling multiplexer_test.chained_timeouts multiplexer_test.multiple_timeouts_at_once multiplexer_test.cancel_timeout multiplexer_test.reschedule_timeout multiplexer_test.timeouts_are_cancelled_on_removal multiplexer_test.post_from_multiplexer_thread_is_deferred multiplexer_test.dispatch_runs_inline_on_multiplexer_thread multiplexer_test.post_from_other_threads multiplexer_test.post_fails_after_shutdown multiplexer_test.multiplexer_threads_give_up_on_full_queues multiplexer_test.migrate_moves_manager_with_timeouts multiplexer_test.migrate_managers_skips_internal_managers multiplexer_test.invalid_placement_is_rejected multiplexer_test.accepting_pauses_while_overloaded multiplexer_test.timers_have_sub_millisecond_precision multiplexer_test.thread_is_pinned_to_configured_cpus multiplexer_test.timerfd_timers_have_sub_millisecond_precision multiplexer_test.busy_managers_take_turns multiplexer_test.busy_managers_are_queued_once multiplexer_test.event_batch_adapts_to_load multiplexer_test.invalid_scheduling_configuration_is_rejected multiplexer_profiling_test.stats_are_collected multiplexer_profiling_test.slow_handlers_are_reported multiplexer_profiling_test.most_expensive_managers placement_policy.parse multiplexer_group.invalid_config multiplexer_group_rebalance_test.moves_half_of_the_difference multiplexer_group_rebalance_test.tolerates_differences_in_threshold multiplexer_group_rebalance_test.rebalances_periodically socket_guard_test.close socket_guard_test.release tcp_socket_test.accept udp_datagram_socket_test.write uri_test.parse event_handler_acceptor_test.handle_read_event event_handler_acceptor_test.accepts_batches_of_nonblocking_sockets event_handler_acceptor_test.invalid_batch_size_is_rejected event_handler_acceptor_test.sheds_connections_while_overloaded event_handler_acceptor_test.sheds_connections_placed_on_lagging_targets event_handler_acceptor_test.limits_connections_per_source event_handler_acceptor_test.invalid_admission_control_is_rejected event_handler_acceptor_test.defers_accepting event_handler_acceptor_test.forgets_the_least_recently_seen_source datagram_dispatcher_test.init datagram_dispatcher_test.consume datagram_dispatcher_test.produce datagram_dispatcher_test.set_timeout_in datagram_dispatcher_test.set_timeout_at datagram_transport_test.handle_read_event datagram_transport_test.handle_write_event frame_allocator.reuses_released_frames frame_allocator.size_classes_are_separate frame_allocator.large_frames_are_not_cached frame_allocator.cache_is_bounded manager_base_test.construction_and_destruction manager_base_test.mask_operations manager_pool_test.released_transports_are_reused manager_pool_test.next_layers_are_destroyed_on_release manager_pool_test.throwing_next_layers_leave_the_transport_pooled manager_pool_test.managers_without_recycle_are_deleted manager_pool_test.managers_released_on_other_threads_are_deleted manager_pool_test.managers_made_on_other_threads_are_constructed manager_pool_test.caches_are_bounded_per_type manager_table_test.emplace_and_find manager_table_test.erase manager_table_test.reused_descriptors_are_detected manager_table_test.iteration multiplexer_stats.record multiplexer_stats.discard multiplexer_stats.accepts_per_second event_pollset_updater_test.init event_pollset_updater_test.handle_shutdown event_pollset_updater_test.handle_add event_pollset_updater_test.handle_all_commands_at_once event_pollset_updater_test.drop_add_during_shutdown event_stream_transport_test.handle_read_event event_stream_transport_test.partial_read event_stream_transport_test.consumes_bytes_received_elsewhere event_stream_transport_test.handle_write_event event_stream_transport_test.disconnect event_stream_transport_test.timeout_handling send_handle_test.send_from_multiplexer_thread send_handle_test.send_from_other_threads send_handle_test.send_follows_migration send_handle_test.expires_with_transport send_handle_test.send_fails_after_shutdown drain_test.shutdown_flushes_pending_writes drain_test.shutdown_closes_after_drain_timeout drain_test.zero_drain_timeout_closes_immediately watermark_test.crossing_watermarks_notifies_next_layer watermark_test.reads_pause_while_writing_is_blocked watermark_test.paused_managers_stay_registered watermark_test.invalid_watermarks_are_rejected timer_wheel_test.empty timer_wheel_test.expires_in_order timer_wheel_test.does_not_expire_early timer_wheel_test.cascades_from_upper_levels timer_wheel_test.advances_over_many_ticks timer_wheel_test.past_deadlines_expire_immediately timer_wheel_test.timeouts_scheduled_while_expiring timer_wheel_test.cancel timer_wheel_test.reschedule timer_wheel_test.cancel_all timer_wheel_test.modified_while_expiring timer_wheel_test.clear v4_address_test.init v4_address_test.toString v4_address_test.parse v4_address_test.parsing_fails v4_endpoint_test.parse v4_endpoint_test.to_string v4_endpoint_test.from_sockaddr v4_endpoint_test.to_sockaddr binary_deserializer.empty_call binary_deserializer.integer binary_deserializer.byte binary_deserializer.floats binary_deserializer.string binary_deserializer.pair binary_deserializer.tuple binary_deserializer.visit binary_deserializer.vector binary_serializer.empty_call binary_serializer.integer binary_serializer.byte binary_serializer.floats binary_serializer.string binary_serializer.pair binary_serializer.tuple binary_serializer.visit binary_serializer.c_style_array binary_serializer.vector cli_parser.register_option cli_parser.parse_longform_options cli_parser.parse_shortform_options cli_parser.option_value_conversion config.add_config_entry config.set_config_entry config.get config.get_or config.has_entry config.parse cpu_affinity.parse_cpu_list cpu_affinity.parse_invalid_cpu_list cpu_affinity.pin_current_thread cpu_affinity.numa_node_cpus cycle_clock.monotonic cycle_clock.conversion cycle_clock.measures_elapsed_time format_test.replace_single_string format_test.replace_multiple_strings format_test.replace_same_string_multiple_times format_test.replace_to_stringable_types format_test.split_string_by_string_delimiter format_test.split_string_by_char_delimiter format_test.join_string histogram.buckets histogram.record histogram.percentile histogram.concurrent_read intrusive_ptr_test.delete_called_on_destruction intrusive_ptr_test.delete_called_on_reset intrusive_ptr_test.copy_ptr intrusive_ptr_test.move_ptr intrusive_ptr_test.release mpsc_queue.capacity mpsc_queue.push_pop mpsc_queue.full mpsc_queue.wraparound mpsc_queue.failed_push_does_not_move mpsc_queue.destroys_remaining_elements mpsc_queue.multiple_producers ref_counted_test.ref_counting scope_guard.func_executed scope_guard.func_not_executed scope_guard.reset serialized_size.empty_call serialized_size.integral_types serialized_size.byte serialized_size.enum serialized_size.strings serialized_size.mixed_types serialized_size.pair serialized_size.tuple serialized_size.visit serialized_size.c_style_array serialized_size.integral_container serialized_size.float_container serialized_size.double_container serialized_size.enum_container serialized_size.string_container serialized_size.visitable_container slot_table.finds_inserted_values slot_table.erased_keys_are_stale slot_table.grows_when_full token_bucket.admits_bursts token_bucket.refills_at_rate token_bucket.does_not_exceed_burst [==[stream_transport_full_integration.mirror<event_based>]==] [==[stream_transport_full_integration.mirror_multiple_rounds<event_based>]==] [==[stream_transport_full_integration.mirror<edge_triggered_event_based>]==] [==[stream_transport_full_integration.mirror_multiple_rounds<edge_triggered_event_based>]==] edge_triggered_multiplexer.avoids_pollset_updates [==[multiplexer_group_tests/multiplexer_group_test.init/reuse_port  # GetParam() = reuse-port]==] [==[multiplexer_group_tests/multiplexer_group_test.init/round_robin  # GetParam() = round-robin]==] [==[multiplexer_group_tests/multiplexer_group_test.init/least_connections  # GetParam() = least-connections]==] [==[multiplexer_group_tests/multiplexer_group_test.init/least_lag  # GetParam() = least-lag]==] [==[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/reuse_port  # GetParam() = reuse-port]==] [==[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/round_robin  # GetParam() = round-robin]==] [==[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/least_connections  # GetParam() = least-connections]==] [==[multiplexer_group_tests/multiplexer_group_test.connections_are_spread_across_multiplexers/least_lag  # GetParam() = least-lag]==])
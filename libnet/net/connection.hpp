@@ -0,0 +1,210 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      connection.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/fwd.hpp"
+
+#include "net/detail/manager_base.hpp"
+#include "net/detail/transport_base.hpp"
+
+#include "net/receive_policy.hpp"
+
+#include "util/byte_buffer.hpp"
+#include "util/byte_span.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+
+namespace net {
+
+/// @brief Stream connection as seen by a coroutine.
+/// Provides awaitable reads, writes and sleeps on top of a stream transport,
+/// see coroutine_layer. A connection runs a single chain of coroutines, so at
+/// most one operation is pending at any time. The awaitables live in the
+/// coroutine frame. Reads and sleeps allocate no memory of their own, writes
+/// copy their bytes into the write queue of the transport.
+class connection {
+public:
+  using clock_type = std::chrono::steady_clock;
+
+  /// Maximum number of bytes read while no read is pending.
+  static constexpr std::uint32_t idle_read_size = 4096;
+
+  // -- awaitables -------------------------------------------------------------
+
+  /// Resumes with the received bytes once the policy is satisfied. The bytes
+  /// remain valid until the coroutine awaits the next read.
+  class read_awaitable {
+  public:
+    read_awaitable(connection& conn, receive_policy policy) noexcept
+      : conn_{conn}, policy_{policy} {
+      // nop
+    }
+
+    bool await_ready() noexcept { return conn_.try_read(policy_); }
+
+    void await_suspend(std::coroutine_handle<> hdl) {
+      conn_.suspend_read(hdl, policy_);
+    }
+
+    util::const_byte_span await_resume() const noexcept {
+      return conn_.read_result_;
+    }
+
+  private:
+    connection& conn_;
+    receive_policy policy_;
+  };
+
+  /// Copies the bytes to the write queue of the transport right away, so the
+  /// span may point into the bytes of a previous read. Resumes once the
+  /// transport fetches more data, i.e. writers are held back while the queue
+  /// exceeds `transport.max-enqueued-bytes`.
+  class write_awaitable {
+  public:
+    write_awaitable(connection& conn, util::const_byte_span bytes) noexcept
+      : conn_{conn}, bytes_{bytes} {
+      // nop
+    }
+
+    bool await_ready() const noexcept { return bytes_.empty(); }
+
+    void await_suspend(std::coroutine_handle<> hdl) {
+      conn_.suspend_write(hdl, bytes_);
+    }
+
+    void await_resume() const noexcept {
+      // nop
+    }
+
+  private:
+    connection& conn_;
+    util::const_byte_span bytes_;
+  };
+
+  /// Resumes once the timer of the multiplexer fired.
+  class sleep_awaitable {
+  public:
+    sleep_awaitable(connection& conn, clock_type::time_point when) noexcept
+      : conn_{conn}, when_{when} {
+      // nop
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> hdl) {
+      conn_.suspend_sleep(hdl, when_);
+    }
+
+    void await_resume() const noexcept {
+      // nop
+    }
+
+  private:
+    connection& conn_;
+    clock_type::time_point when_;
+  };
+
+  // -- operations -------------------------------------------------------------
+
+  /// @brief Reads from the connection.
+  /// @param policy The number of bytes to wait for, the minimum size must not
+  /// be zero.
+  read_awaitable read(receive_policy policy) noexcept {
+    return {*this, policy};
+  }
+
+  /// @brief Writes bytes to the connection.
+  write_awaitable write(util::const_byte_span bytes) noexcept {
+    return {*this, bytes};
+  }
+
+  /// @brief Suspends the coroutine for the given duration.
+  sleep_awaitable sleep_for(clock_type::duration duration) noexcept {
+    return {*this, clock_type::now() + duration};
+  }
+
+  /// @brief Suspends the coroutine until the given point in time.
+  sleep_awaitable sleep_until(clock_type::time_point when) noexcept {
+    return {*this, when};
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns the manager of the underlying transport.
+  detail::manager_base& manager() const noexcept { return *manager_; }
+
+  /// @brief Returns the number of received bytes not yet read by the
+  /// coroutine.
+  std::size_t num_buffered_bytes() const noexcept {
+    return buffered_.size() - handed_out_;
+  }
+
+  // -- coroutine_layer interface ----------------------------------------------
+
+  /// @brief Binds the connection to its transport.
+  template <class Parent>
+  void attach(Parent& parent) noexcept {
+    transport_ = &parent;
+    manager_ = &parent;
+    parent_ = &parent;
+    enqueue_ = [](void* ptr, util::const_byte_span bytes) {
+      static_cast<Parent*>(ptr)->enqueue(bytes);
+    };
+    transport_->configure_next_read(receive_policy::up_to(idle_read_size));
+  }
+
+  /// @brief Passes received bytes to a pending read or buffers them.
+  void handle_bytes(util::const_byte_span bytes);
+
+  /// @brief Returns whether a write is pending.
+  bool has_pending_write() const noexcept { return state_ == state::writing; }
+
+  /// @brief Resumes the writer, whose bytes have been enqueued already.
+  void handle_write();
+
+  /// @brief Resumes a sleeping coroutine if its timer fired.
+  /// @return true if the timeout belonged to the connection.
+  bool handle_timeout(std::uint64_t id);
+
+private:
+  enum class state {
+    idle,
+    reading,
+    writing,
+    sleeping,
+  };
+
+  bool try_read(receive_policy policy) noexcept;
+
+  void suspend_read(std::coroutine_handle<> hdl, receive_policy policy);
+
+  void suspend_write(std::coroutine_handle<> hdl, util::const_byte_span bytes);
+
+  void suspend_sleep(std::coroutine_handle<> hdl, clock_type::time_point when);
+
+  /// Resumes the suspended coroutine and reads idly unless it awaits a read.
+  void resume();
+
+  detail::transport_base* transport_{nullptr}; ///< Reads are configured here
+  detail::manager_base* manager_{nullptr};     ///< Timers and write interest
+  void* parent_{nullptr};                      ///< The transport itself
+  void (*enqueue_)(void*, util::const_byte_span){nullptr};
+
+  state state_{state::idle};              ///< The pending operation
+  std::coroutine_handle<> suspended_;     ///< The waiting coroutine
+  receive_policy read_policy_{0, 0};      ///< Policy of the pending read
+  util::const_byte_span read_result_;     ///< Result of the last read
+  std::uint64_t sleep_id_{0};             ///< Timer of the pending sleep
+  util::byte_buffer buffered_;            ///< Bytes received while not read
+  std::size_t handed_out_{0};             ///< Buffered bytes read already
+};
+
+} // namespace net
@@ -0,0 +1,123 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      coroutine_layer.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/connection.hpp"
+#include "net/manager_result.hpp"
+#include "net/operation.hpp"
+#include "net/task.hpp"
+
+#include "util/byte_span.hpp"
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/logger.hpp"
+
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <utility>
+
+namespace net {
+
+/// @brief Runs a coroutine as the next layer of a stream transport.
+/// The coroutine is created from `Function` once the transport is
+/// initialized and runs until its first suspension. Its connection is closed
+/// once the coroutine returns, after the queued bytes have been written, or
+/// right away if it exited with an exception. The coroutine is destroyed at
+/// its current suspension point if the connection is closed before.
+/// @code
+/// auto echo = [](connection& conn) -> task<> {
+///   for (;;) {
+///     auto bytes = co_await conn.read(receive_policy::up_to(1024));
+///     co_await conn.write(bytes);
+///   }
+/// };
+/// util::make_intrusive<detail::event_stream_transport<
+///   coroutine_layer<decltype(echo)>>>(handle, mpx, echo);
+/// @endcode
+/// @tparam Function Callable taking a `connection&` and returning a `task<>`.
+template <class Function>
+  requires std::same_as<std::invoke_result_t<Function&, connection&>, task<>>
+class coroutine_layer {
+public:
+  explicit coroutine_layer(Function fn) : fn_{std::move(fn)} {
+    // nop
+  }
+
+  util::error init(auto& parent, const util::config&) {
+    conn_.attach(parent);
+    task_ = std::invoke(fn_, conn_);
+    task_.start();
+    after_resume(parent);
+    return util::none;
+  }
+
+  bool has_more_data() const noexcept { return conn_.has_pending_write(); }
+
+  manager_result produce(auto& parent) {
+    conn_.handle_write();
+    after_resume(parent);
+    return manager_result::ok;
+  }
+
+  manager_result consume(auto& parent, util::const_byte_span bytes) {
+    conn_.handle_bytes(bytes);
+    after_resume(parent);
+    return manager_result::ok;
+  }
+
+  manager_result handle_timeout(auto& parent, uint64_t id) {
+    if (closing_ && (id == close_timeout_)) {
+      // Flushes the write queue before the manager is removed, unless the
+      // coroutine failed
+      const auto op = task_.exception() ? operation::read_write
+                                        : operation::read;
+      parent.deregister(op);
+      return manager_result::done;
+    }
+    if (conn_.handle_timeout(id)) {
+      after_resume(parent);
+    }
+    return manager_result::ok;
+  }
+
+  /// @brief Returns the connection of the coroutine.
+  connection& conn() noexcept { return conn_; }
+
+private:
+  void after_resume(auto& parent) {
+    if (!task_.done() || closing_) {
+      return;
+    }
+    closing_ = true;
+    if (auto ex = task_.exception()) {
+      try {
+        std::rethrow_exception(ex);
+      } catch ([[maybe_unused]] const std::exception& err) {
+        LOG_ERROR("coroutine on ", NET_ARG2("socket", parent.handle().id),
+                  " failed: ", err.what());
+      } catch (...) {
+        LOG_ERROR("coroutine on ", NET_ARG2("socket", parent.handle().id),
+                  " failed");
+      }
+    }
+    // Managers must not remove themselves from within their event handlers
+    close_timeout_ = parent.set_timeout_in(std::chrono::nanoseconds{0});
+  }
+
+  Function fn_;
+  connection conn_;
+  task<> task_;
+  bool closing_{false};
+  std::uint64_t close_timeout_{0};
+};
+
+} // namespace net
@@ -18,31 +18,105 @@
 
 #include "net/manager_result.hpp"
 
+#include "net/ip/v4_address.hpp"
+
 #include "net/socket/tcp_accept_socket.hpp"
 #include "net/socket/tcp_stream_socket.hpp"
 
 #include "util/logger.hpp"
+#include "util/token_bucket.hpp"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
 
 namespace net::detail {
 
 using acceptor_factory = std::function<manager_base_ptr(net::socket)>;
 
 /// @brief Generic base for acceptor implementations.
-/// Contains shared logic for handling accepted connections.
+/// Contains shared logic for handling accepted connections, including
+/// admission control. Once the loop lag of the multiplexer exceeds
+/// `multiplexer.max-loop-lag-us`, accepting is paused and checked again every
+/// `multiplexer.overload-recheck-ms`. With `multiplexer.overload-policy` set
+/// to "shed", or for io_uring acceptors, connections are accepted and closed
+/// right away instead. When the factory places connections on another
+/// multiplexer, as the dedicated acceptor of a multiplexer_group does, the
+/// acceptor's own loop is mostly idle. The lag of the chosen multiplexer is
+/// checked as well then, and connections placed on one that lags behind are
+/// closed.
+///
+/// `multiplexer.per-ip-connection-rate` limits the connections per second and
+/// source address, allowing bursts of `multiplexer.per-ip-connection-burst`
+/// connections. At most `multiplexer.per-ip-max-sources` addresses are
+/// tracked, the address seen least recently is forgotten first.
 template <class ManagerBase>
 class acceptor_base : public ManagerBase {
 public:
+  /// Default for the maximum number of tracked source addresses.
+  static constexpr std::size_t default_max_tracked_sources = 4096;
+
   acceptor_base(tcp_accept_socket handle, multiplexer_base* mpx,
                 acceptor_factory factory);
 
+  /// @brief Initializes the acceptor. With `multiplexer.defer-accept-s` set,
+  /// connections are only reported once they sent data or the given number of
+  /// seconds passed.
+  util::error init(const util::config& cfg) override;
+
+  /// @brief Resumes accepting once the multiplexer caught up.
+  manager_result handle_timeout(uint64_t timeout_id) override;
+
+  /// @brief Returns whether the loop lag exceeds the configured maximum.
+  bool overloaded() const noexcept { return lagging(*ManagerBase::mpx()); }
+
+  /// @brief Returns the number of source addresses tracked for rate limiting.
+  std::size_t num_tracked_sources() const noexcept { return sources_.size(); }
+
+  /// @brief Acceptors are bound to the multiplexer listening on the socket.
+  bool migratable() const noexcept override { return false; }
+
 protected:
+  /// @brief Pauses accepting while overloaded, unless connections are shed.
+  /// @return true if accepting was paused.
+  bool pause_if_overloaded();
+
   /// @brief Common handler for accepted connections.
-  manager_result handle_accepted(tcp_stream_socket accepted);
+  /// @param accepted The accepted socket.
+  /// @param nonblocking Whether the socket was accepted as nonblocking.
+  manager_result handle_accepted(tcp_stream_socket accepted,
+                                 bool nonblocking = false);
 
 private:
+  /// @brief Returns whether the loop lag of `mpx` exceeds the configured
+  /// maximum.
+  bool lagging(const multiplexer_base& mpx) const noexcept;
+
+  /// @brief Decides whether an accepted connection is handed to the factory.
+  bool admit(tcp_stream_socket accepted);
+
+  /// A token bucket and the source address it limits.
+  using source_bucket = std::pair<ip::v4_address, util::token_bucket>;
+
+  /// Tracked sources, ordered by when they were last seen.
+  using source_list = std::list<source_bucket>;
+
   acceptor_factory factory_;
+
+  // Admission control
+  std::chrono::nanoseconds max_loop_lag_{0}; ///< Zero disables the check
+  bool shed_{false}; ///< Whether to close connections instead of pausing
+  std::chrono::milliseconds recheck_interval_{10}; ///< Checks while paused
+  std::uint64_t recheck_timeout_{0};               ///< The pending check
+  double per_ip_rate_{0};  ///< Connections per second and source, or zero
+  double per_ip_burst_{0}; ///< Connections a source may open at once
+  std::size_t max_tracked_sources_{default_max_tracked_sources}; ///< Limit
+  source_list sources_; ///< Most recently seen first
+  std::unordered_map<ip::v4_address, source_list::iterator> buckets_; ///< Index
 };
 
 template <class ManagerBase>
@@ -55,10 +129,21 @@ class acceptor<event_handler> : public acceptor_base<event_handler> {
   using base = acceptor_base<event_handler>;
 
 public:
+  /// Default for the number of connections accepted per read event.
+  static constexpr std::size_t default_accept_batch_size = 16;
+
   using base::base;
 
+  /// @brief Initializes the acceptor. Reads the number of connections to
+  /// accept per read event from `multiplexer.accept-batch-size`.
+  util::error init(const util::config& cfg) override;
+
   /// @brief Handles incoming connection on read event (epoll/kqueue).
   manager_result handle_read_event();
+
+private:
+  /// Connections accepted per read event, one until initialized
+  std::size_t accept_batch_size_{1};
 };
 
 using event_handler_acceptor = acceptor<event_handler>;
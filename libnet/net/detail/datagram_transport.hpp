@@ -12,6 +12,7 @@
 
 #include "net/detail/event_handler.hpp"
 #include "net/detail/multiplexer_base.hpp"
+#include "net/detail/send_channel.hpp"
 #include "net/detail/transport_base.hpp"
 #if defined(LIB_NET_URING)
 #  include "net/detail/uring_manager.hpp"
@@ -20,6 +21,7 @@
 
 #include "net/manager_result.hpp"
 #include "net/receive_policy.hpp"
+#include "net/send_handle.hpp"
 
 #include "net/socket/datagram_socket.hpp"
 #include "net/socket/udp_datagram_socket.hpp"
@@ -84,6 +86,13 @@ struct datagram {
 /// @tparam NextLayer The upper protocol layer to stack on this transport.
 template <class ManagerBase, class NextLayer>
 class datagram_transport : public transport_base, public ManagerBase {
+public:
+  /// @brief Message type accepted by send handles of this transport.
+  using send_message = std::pair<util::byte_buffer, ip::v4_endpoint>;
+
+private:
+  using channel_type = send_channel<send_message>;
+
 protected:
   // TODO Possibly add querying the MTU from the socket?
   static constexpr std::size_t max_datagram_size = 548;
@@ -102,6 +111,13 @@ public:
     LOG_DEBUG("Creating datagram_transport with ", NET_ARG2("id", handle.id));
   }
 
+  /// @brief Destructs the transport and closes its send channel, if any.
+  ~datagram_transport() {
+    if (send_channel_) {
+      send_channel_->close();
+    }
+  }
+
   /// @brief Initializes the transport with configuration.
   /// Sets the socket to non-blocking mode and initializes the next layer.
   /// @param cfg The configuration object.
@@ -123,6 +139,10 @@ public:
     return next_layer_.handle_timeout(*this, id);
   }
 
+  std::size_t num_enqueued_bytes() const noexcept override {
+    return num_enqueued_bytes_;
+  }
+
   // -- transport_base API -----------------------------------------------------
 
   void configure_next_read(receive_policy policy) noexcept override {
@@ -137,9 +157,7 @@ public:
   // -- datagram_transport specific API ----------------------------------------
 
   void enqueue(util::byte_buffer&& datagram, ip::v4_endpoint ep) {
-    // Warn about datagrams that are too big?
-    num_enqueued_bytes_ += datagram.size();
-    write_queue_.emplace_back(std::move(datagram), std::move(ep));
+    append(std::move(datagram), std::move(ep));
     manager_base::register_writing();
   }
 
@@ -149,6 +167,35 @@ public:
     enqueue(std::move(buf), std::move(ep));
   }
 
+  /// @brief Returns a handle for enqueueing datagrams from other threads.
+  /// Must be called from the multiplexer thread. All handles of a transport
+  /// share a single queue, which is spliced into the write queue in batches.
+  /// @return A handle to the send channel of this transport.
+  send_handle<send_message> make_send_handle() {
+    if (!send_channel_) {
+      send_channel_ = util::make_intrusive<channel_type>(
+        manager_base::mpx(), manager_base::handle(), send_queue_capacity_,
+        [this] { splice(*send_channel_); });
+    }
+    return send_handle<send_message>{send_channel_};
+  }
+
+  /// @brief Detaches the send channel before migrating to another
+  /// multiplexer.
+  void handle_detached() override {
+    if (send_channel_) {
+      send_channel_->detach();
+    }
+  }
+
+  /// @brief Attaches the send channel to the new multiplexer and flushes the
+  /// messages queued while migrating.
+  void handle_attached() override {
+    if (send_channel_) {
+      send_channel_->attach(manager_base::mpx());
+    }
+  }
+
 protected:
   manager_result handle_read_result(const net::ip::v4_endpoint& ep,
                                     std::ptrdiff_t read_res) {
@@ -159,6 +206,8 @@ protected:
     } else {
       LOG_DEBUG("Read ", read_res, " bytes from ",
                 NET_ARG2("socket", handle().id));
+      ManagerBase::mpx()->stats().add_bytes_read(
+        static_cast<std::size_t>(read_res));
       received_ += read_res;
       if (received_ >= min_read_size_) {
         const auto consume_result = next_layer_.consume(
@@ -186,6 +235,8 @@ protected:
     }
     LOG_DEBUG("Wrote ", write_res, " bytes to ",
               NET_ARG2("socket", handle().id));
+    ManagerBase::mpx()->stats().add_bytes_written(
+      static_cast<std::size_t>(write_res));
 
     if (static_cast<std::size_t>(write_res) < it->buf_.size()) {
       LOG_ERROR("Datagram with ", NET_ARG(it->id_),
@@ -239,6 +290,28 @@ protected:
 
   datagram read_buffer_;
   mutable std::deque<datagram> write_queue_;
+
+  send_channel_ptr<send_message> send_channel_;
+
+private:
+  void append(util::byte_buffer&& datagram, ip::v4_endpoint ep) {
+    // Warn about datagrams that are too big?
+    num_enqueued_bytes_ += datagram.size();
+    write_queue_.emplace_back(std::move(datagram), std::move(ep));
+  }
+
+  /// @brief Moves all datagrams queued by other threads to the write queue.
+  void splice(channel_type& channel) {
+    send_message msg;
+    std::size_t num_spliced = 0;
+    while (channel.try_pop(msg)) {
+      append(std::move(msg.first), msg.second);
+      ++num_spliced;
+    }
+    if (num_spliced > 0) {
+      manager_base::register_writing();
+    }
+  }
 };
 
 template <class ManagerBase, class NextLayer>
@@ -18,9 +18,11 @@
 #  include "net/detail/event_handler.hpp"
 #  include "net/detail/multiplexer_base.hpp"
 
-#  include <array>
+#  include <chrono>
 #  include <cstdint>
+#  include <optional>
 #  include <span>
+#  include <utility>
 #  include <vector>
 
 #  include <sys/epoll.h>
@@ -31,11 +33,26 @@ namespace net::detail {
 /// Implements the multiplexer interface for Linux systems using the epoll
 /// mechanism for scalable I/O event handling. Manages sockets and coordinates
 /// with event handlers for read/write operations. Only available on Linux.
+///
+/// Timeouts are waited for with nanosecond precision using epoll_pwait2. On
+/// kernels without epoll_pwait2, or with `multiplexer.use-timerfd` enabled, a
+/// timerfd armed with the next timeout is polled alongside the sockets.
+///
+/// Each handler call is bounded by the per-call limits of the managers, e.g.
+/// `transport.max-consecutive-reads`. With `multiplexer.fair-scheduling`
+/// enabled, managers that exhaust their limit are queued on the ready list
+/// instead of waiting for the next event, and the ready list is handled
+/// round-robin for up to `multiplexer.max-ready-rounds` turns before polling
+/// again. The number of events fetched per poll adapts to the load between
+/// `multiplexer.max-events` and `multiplexer.max-events-limit`.
 class epoll_multiplexer : public multiplexer_base {
 public:
-  /// @brief Maximum number of events returned by a single poll.
+  /// @brief Default number of events returned by a single poll.
   static constexpr std::size_t max_events = 32;
 
+  /// @brief Default upper bound for the number of events per poll.
+  static constexpr std::size_t max_events_limit = 1024;
+
   /// @brief Factory function type for creating event handlers.
   using manager_factory
     = std::function<event_handler_ptr(net::socket, multiplexer_base*)>;
@@ -46,9 +63,11 @@ private:
 
   // Pollset types
   /// @brief Container for events returned from epoll.
-  using pollset = std::array<event_type, max_events>;
+  using pollset = std::vector<event_type>;
   /// @brief Pending epoll modifications.
   using update_list = std::vector<event_type>;
+  /// @brief Managers that must be handled without waiting for an event.
+  using ready_list = std::vector<std::pair<event_handler_ptr, operation>>;
   /// @brief View over event arrays.
   using event_span = std::span<event_type>;
 
@@ -62,17 +81,17 @@ public:
   /// descriptor.
   virtual ~epoll_multiplexer();
 
-  /// @brief Copy constructor.
-  epoll_multiplexer(const epoll_multiplexer& other) = default;
+  /// @brief Copy construction is deleted.
+  epoll_multiplexer(const epoll_multiplexer& other) = delete;
 
-  /// @brief Move constructor.
-  epoll_multiplexer(epoll_multiplexer&& other) noexcept = default;
+  /// @brief Move construction is deleted.
+  epoll_multiplexer(epoll_multiplexer&& other) noexcept = delete;
 
-  /// @brief Copy assignment.
-  epoll_multiplexer& operator=(const epoll_multiplexer& other) = default;
+  /// @brief Copy assignment is deleted.
+  epoll_multiplexer& operator=(const epoll_multiplexer& other) = delete;
 
-  /// @brief Move assignment.
-  epoll_multiplexer& operator=(epoll_multiplexer&& other) noexcept = default;
+  /// @brief Move assignment is deleted.
+  epoll_multiplexer& operator=(epoll_multiplexer&& other) noexcept = delete;
 
   /// @brief Initializes the epoll multiplexer with the given configuration.
   /// Creates an epoll file descriptor and sets up event monitoring.
@@ -106,11 +125,76 @@ public:
   /// @return An error on failure, none on success.
   util::error poll_once(bool blocking) override;
 
+  /// @brief Managers can be moved between epoll multiplexers.
+  bool supports_migration() const noexcept override { return true; }
+
+  /// @brief Returns the number of epoll_ctl calls issued so far.
+  std::size_t num_pollset_updates() const noexcept {
+    return num_pollset_updates_;
+  }
+
+  /// @brief Returns whether sockets are polled in edge-triggered mode.
+  bool edge_triggered() const noexcept { return edge_triggered_; }
+
+  /// @brief Returns whether managers that exhausted their per-call limit are
+  /// handled again without waiting for further events.
+  bool fair_scheduling() const noexcept { return fair_scheduling_; }
+
+  /// @brief Returns the number of events fetched by the next poll.
+  std::size_t event_batch_size() const noexcept { return batch_size_; }
+
+  /// @brief Returns whether timeouts are waited for using a timerfd instead
+  /// of epoll_pwait2.
+  bool uses_timerfd() const noexcept { return timer_fd_ != invalid_socket_id; }
+
 private:
+  /// @brief Creates the timerfd and adds it to the epoll set.
+  /// @return An error on failure, none on success.
+  util::error init_timerfd();
+
+  /// @brief Arms the timerfd to expire at the given time, unless it already
+  /// is.
+  /// @param when The time of the next timeout.
+  void arm_timer(std::chrono::steady_clock::time_point when);
+
+  /// @brief Waits for events using the timerfd for timeouts.
+  /// @param timeout The maximum time to wait, infinite if not set.
+  /// @return The number of events, or -1 on error.
+  int wait_with_timerfd(std::optional<std::chrono::nanoseconds> timeout);
+
   /// @brief Dispatches all ready events to their associated handlers.
   /// @param events The events returned by epoll_wait.
   void handle_events(event_span events);
 
+  /// @brief Dispatches all managers that were marked ready in edge-triggered
+  /// mode, i.e., that did not drain their socket or were newly enabled.
+  /// Managers marked ready while handling the list are handled next turn.
+  void handle_ready_list();
+
+  /// @brief Queues `mgr` on the ready list for `op`, unless it is queued for
+  /// `op` already.
+  void mark_ready(event_handler& mgr, operation op);
+
+  /// @brief Adapts the number of events fetched per poll to the last poll.
+  /// @param num_events The number of events returned by the last poll.
+  void adapt_batch_size(std::size_t num_events);
+
+  /// @brief Applies the result of an event handler.
+  /// @param mgr The manager that handled the event.
+  /// @param res The result returned by the handler.
+  /// @param op The operation that was handled.
+  /// @return false if the manager was removed, true otherwise.
+  bool handle_result(event_handler& mgr, manager_result res, operation op);
+
+  /// @brief Removes a migrating manager from the epoll set and the registry.
+  /// @param mgr The manager to remove.
+  void detach(manager_base& mgr) override;
+
+  /// @brief Registers a manager with the epoll set without initializing it.
+  /// @param mgr The manager to register.
+  /// @param mask The operations to monitor.
+  void attach(manager_base_ptr mgr, operation mask) override;
+
   /// @brief Unregisters a socket manager from the epoll set.
   /// @param handle The socket identifier.
   void del(socket handle);
@@ -127,9 +211,23 @@ private:
   void mod(int fd, int op, operation events);
 
   // Multiplexing variables
-  mpx_fd mpx_fd_{invalid_socket_id}; ///< The epoll file descriptor
-  pollset pollset_;                  ///< Buffer for events returned by epoll
-  update_list update_cache_;         ///< Pending epoll modifications
+  mpx_fd mpx_fd_{invalid_socket_id};   ///< The epoll file descriptor
+  pollset pollset_;                    ///< Buffer for events returned by epoll
+  std::size_t batch_size_{max_events}; ///< Events fetched by the next poll
+  std::size_t min_batch_size_{0};      ///< Lower bound of the batch size
+  update_list update_cache_;           ///< Pending epoll modifications
+  std::size_t num_pollset_updates_{0}; ///< Number of epoll_ctl calls
+
+  // Timer fallback
+  int timer_fd_{invalid_socket_id}; ///< timerfd, if epoll_pwait2 is not used
+  std::optional<std::chrono::steady_clock::time_point> armed_timer_; ///< Due
+
+  // Edge-triggered mode and fair scheduling
+  bool edge_triggered_{false};      ///< Whether sockets use EPOLLET
+  bool fair_scheduling_{false};     ///< Whether exhausted managers are queued
+  std::size_t max_ready_rounds_{1}; ///< Ready list turns per iteration
+  ready_list ready_list_;           ///< Managers to handle in the next turn
+  ready_list ready_cache_;          ///< Managers handled in the current turn
 };
 
 } // namespace net::detail
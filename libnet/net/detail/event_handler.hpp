@@ -15,6 +15,7 @@
 
 #include "net/detail/manager_base.hpp"
 
+#include "util/config.hpp"
 #include "util/exception.hpp"
 #include "util/logger.hpp"
 
@@ -24,7 +25,17 @@ namespace net::detail {
 /// Provides virtual methods for handling read and write events on sockets.
 /// Subclasses override these methods to implement protocol-specific event
 /// handling.
+///
+/// With `multiplexer.edge-triggered` enabled, the epoll multiplexer only
+/// signals state changes of a socket. Handlers must then report via their
+/// results whether the socket has been drained:
+/// - manager_result::temporary_error: the socket returned EAGAIN, the handler
+///   waits for the next edge.
+/// - manager_result::ok: the handler stopped early, e.g., because its budget
+///   was exhausted. The multiplexer calls it again in the next iteration.
 class event_handler : public manager_base {
+  friend class epoll_multiplexer;
+
 public:
   /// @brief Constructs an event handler for the given socket.
   /// Sets the socket to non-blocking mode for event-driven I/O.
@@ -40,13 +51,26 @@ public:
     if (auto err = manager_base::init(cfg)) {
       return err;
     }
-    if (!nonblocking(handle(), true)) {
+    if (!assumes_nonblocking() && !nonblocking(handle(), true)) {
       return util::error{util::error_code::runtime_error,
                          "Failed to set nonblocking"};
     }
+    edge_triggered_ = cfg.get_or("multiplexer.edge-triggered", false);
+    fair_scheduling_ = cfg.get_or("multiplexer.fair-scheduling", false);
     return util::none;
   }
 
+  /// @brief Returns whether events are delivered edge-triggered, in which case
+  /// the handler must drain its socket until EAGAIN.
+  bool edge_triggered() const noexcept { return edge_triggered_; }
+
+  /// @brief Returns whether the multiplexer handles the manager again without
+  /// waiting for an event once a handler returned manager_result::ok. Handlers
+  /// that drained their socket must return manager_result::temporary_error.
+  bool requeued_on_ok() const noexcept {
+    return edge_triggered_ || fair_scheduling_;
+  }
+
   // -- Event handling ---------------------------------------------------------
 
   /// @brief Handles a read event on the managed socket.
@@ -62,6 +86,14 @@ public:
   /// failure,
   ///         manager_result::done if the handler is finished.
   virtual manager_result handle_write_event() { return manager_result::error; }
+
+private:
+  /// Whether the socket is polled in edge-triggered mode
+  bool edge_triggered_{false};
+  /// Whether busy managers are queued for another turn by the multiplexer
+  bool fair_scheduling_{false};
+  /// Operations queued on the ready list of the multiplexer
+  operation ready_ops_{operation::none};
 };
 
 /// @brief Shared pointer type for event handlers.
@@ -0,0 +1,84 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      frame_allocator.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace net::detail {
+
+/// @brief Caches coroutine frames for reuse by later coroutines.
+/// Frames are rounded up to size classes of `granularity` bytes and kept in a
+/// free list per class once released, so that coroutines started per request
+/// stop allocating after warm-up. Frames exceeding the largest class are
+/// passed to the global allocator directly.
+/// Each multiplexer thread uses its own allocator, returned by `local()`. All
+/// frames are plain heap blocks, so a frame released on another thread, e.g.
+/// after its manager migrated, is simply cached by that thread instead.
+class frame_allocator {
+public:
+  /// Size classes are multiples of this size.
+  static constexpr std::size_t granularity = 64;
+
+  /// Number of size classes, the largest class holds 2 KiB.
+  static constexpr std::size_t num_size_classes = 32;
+
+  /// Maximum number of frames cached per size class.
+  static constexpr std::size_t max_cached_frames = 256;
+
+  frame_allocator() = default;
+
+  ~frame_allocator();
+
+  frame_allocator(const frame_allocator&) = delete;
+  frame_allocator& operator=(const frame_allocator&) = delete;
+
+  /// @brief Returns the allocator of the calling thread.
+  static frame_allocator& local() noexcept;
+
+  /// @brief Allocates a frame of at least `size` bytes.
+  void* allocate(std::size_t size);
+
+  /// @brief Releases a frame, `size` must match the size it was allocated
+  /// with.
+  void deallocate(void* ptr, std::size_t size) noexcept;
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns the number of frames requested from the global allocator.
+  std::size_t num_heap_allocations() const noexcept {
+    return num_heap_allocations_;
+  }
+
+  /// @brief Returns the number of frames served from the cache.
+  std::size_t num_reused() const noexcept { return num_reused_; }
+
+  /// @brief Returns the number of frames currently cached.
+  std::size_t num_cached() const noexcept;
+
+private:
+  struct free_frame {
+    free_frame* next;
+  };
+
+  struct size_class {
+    free_frame* head{nullptr};
+    std::size_t size{0};
+  };
+
+  static std::size_t class_index(std::size_t size) noexcept {
+    return (size + granularity - 1) / granularity - 1;
+  }
+
+  std::array<size_class, num_size_classes> classes_{};
+  std::size_t num_heap_allocations_{0};
+  std::size_t num_reused_{0};
+};
+
+} // namespace net::detail
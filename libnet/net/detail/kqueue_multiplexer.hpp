@@ -96,11 +96,23 @@ public:
   /// @return An error on failure, none on success.
   util::error poll_once(bool blocking) override;
 
+  /// @brief Managers can be moved between kqueue multiplexers.
+  bool supports_migration() const noexcept override { return true; }
+
 private:
   /// @brief Dispatches all ready events to their associated handlers.
   /// @param events The events returned by kevent.
   void handle_events(event_span events);
 
+  /// @brief Removes a migrating manager from the kqueue and the registry.
+  /// @param mgr The manager to remove.
+  void detach(manager_base& mgr) override;
+
+  /// @brief Registers a manager with the kqueue without initializing it.
+  /// @param mgr The manager to register.
+  /// @param mask The operations to monitor.
+  void attach(manager_base_ptr mgr, operation mask) override;
+
   /// @brief Unregisters a socket manager from the kqueue.
   /// @param handle The socket identifier.
   void del(socket handle) override;
@@ -11,6 +11,8 @@
 #include "net/fwd.hpp"
 #include "util/fwd.hpp"
 
+#include "net/detail/timer_wheel.hpp"
+
 #include "net/operation.hpp"
 #include "net/socket/socket.hpp"
 
@@ -18,11 +20,16 @@
 #include "util/ref_counted.hpp"
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 
 namespace net::detail {
 
 /// Manages the lifetime of a socket and its events.
 class manager_base : public util::ref_counted {
+  friend class multiplexer_base;
+
 public:
   // -- Constructors, destructors, initialization ------------------------------
 
@@ -59,6 +66,11 @@ public:
     return operation::read;
   }
 
+  /// @brief Returns the number of bytes queued for writing.
+  /// Managers with queued bytes keep their write interest on shutdown until
+  /// the queue is flushed or `multiplexer.drain-timeout-ms` has passed.
+  virtual std::size_t num_enqueued_bytes() const noexcept { return 0; }
+
   /// @brief Retrieves the managed handle
   /// @tparam Socket  The type to cast the handle to, net::socket by default
   /// @returns the managed handle
@@ -97,14 +109,36 @@ public:
 
   bool mask_contains(operation flag) const noexcept;
 
+  /// @brief Returns whether reading has been paused by pause_reading().
+  bool reading_paused() const noexcept { return reading_paused_; }
+
+  /// @brief Marks the handle as nonblocking, e.g. for sockets returned by
+  /// accept_nonblocking(), so that initialization need not set the flag.
+  void assume_nonblocking() noexcept { nonblocking_ = true; }
+
+  /// @brief Returns whether the handle is known to be nonblocking.
+  bool assumes_nonblocking() const noexcept { return nonblocking_; }
+
   // -- Event handling ---------------------------------------------------------
 
-  /// @brief Registers this manager for read events on its socket.
+  /// @brief Registers this manager for read events on its socket, resuming
+  /// reads paused by pause_reading().
   void register_reading();
 
+  /// @brief Stops read events on the socket, e.g. to apply backpressure.
+  /// Unlike other disabled operations, paused reads keep the manager
+  /// registered with its multiplexer.
+  void pause_reading();
+
   /// @brief Registers this manager for write events on its socket.
   void register_writing();
 
+  /// @brief Stops monitoring the given operations and removes this manager
+  /// once no operations remain. Read and write handlers signal this by
+  /// returning manager_result::done instead, as the manager may be destroyed.
+  /// @param op The operations to stop monitoring
+  void deregister(operation op);
+
   // -- Timeout handling -------------------------------------------------------
 
   /// @brief Sets a timeout to trigger after the specified duration.
@@ -119,22 +153,107 @@ public:
   ///         the timeout
   uint64_t set_timeout_at(std::chrono::steady_clock::time_point when);
 
+  /// @brief Cancels a pending timeout.
+  /// @param timeout_id The identifier of the timeout to cancel
+  /// @return true if the timeout was cancelled, false if it was not pending
+  bool cancel_timeout(uint64_t timeout_id);
+
+  /// @brief Moves a pending timeout to a new point in time, e.g. to reset an
+  /// idle timeout on every read without scheduling a new one.
+  /// @param timeout_id The identifier of the timeout to reschedule
+  /// @param when The absolute time point at which the timeout should fire
+  /// @return true if the timeout was rescheduled, false if it was not pending
+  bool reschedule_timeout(uint64_t timeout_id,
+                          std::chrono::steady_clock::time_point when);
+
   /// @brief Handles a timeout event for this manager.
   /// @param timeout_id The identifier of the timeout that fired
   /// @return The result of handling the timeout event
   virtual manager_result handle_timeout(uint64_t timeout_id);
 
+  // -- Migration --------------------------------------------------------------
+
+  /// @brief Returns whether this manager may be moved to another multiplexer.
+  /// Internal managers of a multiplexer are bound to it.
+  virtual bool migratable() const noexcept { return true; }
+
+  /// @brief Called on the current multiplexer thread right before the
+  /// manager is handed to another multiplexer.
+  virtual void handle_detached() {
+    // nop
+  }
+
+  /// @brief Called on the new multiplexer thread once the manager and its
+  /// pending timeouts have been registered with it.
+  virtual void handle_attached() {
+    // nop
+  }
+
+  // -- CPU time accounting ----------------------------------------------------
+
+  /// @brief Returns the time spent in the handlers of this manager. Only
+  /// measured with `multiplexer.profile-handlers` enabled.
+  /// @return The accumulated handler time.
+  std::chrono::nanoseconds cpu_time() const noexcept;
+
+  /// @brief Returns the number of profiled handler invocations.
+  std::uint64_t num_handler_calls() const noexcept {
+    return num_handler_calls_;
+  }
+
+  /// @brief Returns the number of handler invocations that exceeded the
+  /// configured `multiplexer.handler-budget-us`.
+  std::uint64_t num_slow_handler_calls() const noexcept {
+    return num_slow_handler_calls_;
+  }
+
   // -- Error handling ---------------------------------------------------------
 
   virtual void handle_error(util::error err) const;
 
+protected:
+  // -- Recycling --------------------------------------------------------------
+
+  /// @brief Called once the last reference is gone and the socket has been
+  /// closed, right before the manager is cached for reuse. Managers return
+  /// their buffers here, keeping their capacity.
+  virtual void handle_released() {
+    // nop
+  }
+
+  /// @brief Resets the manager to manage `handle`, as if newly constructed.
+  /// Called by the `recycle` member of managers created by
+  /// multiplexer_base::make_manager.
+  /// @param handle The handle to manage
+  void reset(socket handle) noexcept;
+
+  /// @brief Caches the manager in the pool of its multiplexer, if any.
+  void dispose() noexcept override;
+
 private:
+  /// @brief Cancels the pending timeouts and closes the managed socket.
+  void release() noexcept;
+
   /// The managed socket handle
   socket handle_{invalid_socket};
   /// Reference to the multiplexer owning this manager_base
   multiplexer_base* mpx_{nullptr};
   /// The mask containing all currently registered events
   operation mask_{operation::none};
+  /// Whether reading has been paused
+  bool reading_paused_{false};
+  /// Whether the handle was created nonblocking
+  bool nonblocking_{false};
+  /// The pending timeouts of this manager
+  timer_wheel::timer_list timeouts_;
+  /// Cycle clock ticks spent in the handlers of this manager
+  std::uint64_t cpu_ticks_{0};
+  /// Number of profiled handler invocations
+  std::uint64_t num_handler_calls_{0};
+  /// Number of handler invocations exceeding the budget
+  std::uint64_t num_slow_handler_calls_{0};
+  /// The pool this manager is returned to once released
+  std::weak_ptr<manager_pool> pool_;
 };
 
 /// @brief Alias for util::intrusive_ptr<manager_base>
@@ -0,0 +1,88 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      manager_pool.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/fwd.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace net::detail {
+
+/// @brief Caches released managers of a multiplexer for reuse.
+/// Managers are cached by their concrete type once their last reference is
+/// gone, keeping the capacity of their buffers, and handed out again by
+/// multiplexer_base::make_manager. The pool is only used on the multiplexer
+/// thread, managers released on other threads are deleted instead and
+/// managers created on other threads are constructed anew.
+class manager_pool {
+public:
+  /// @brief Constructs a pool.
+  /// @param max_cached_per_type Maximum number of cached managers per type.
+  explicit manager_pool(std::size_t max_cached_per_type) noexcept;
+
+  /// @brief Deletes all cached managers.
+  ~manager_pool();
+
+  manager_pool(const manager_pool&) = delete;
+  manager_pool& operator=(const manager_pool&) = delete;
+
+  /// @brief Takes a cached manager of type `T`.
+  /// @return The manager without any references, or nullptr if none is cached
+  /// or the caller is not the owning thread.
+  template <class T>
+  T* take() noexcept {
+    if (std::this_thread::get_id() != owner_.load(std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    auto it = cache_.find(std::type_index{typeid(T)});
+    if ((it == cache_.end()) || it->second.empty()) {
+      return nullptr;
+    }
+    auto* mgr = it->second.back();
+    it->second.pop_back();
+    --num_cached_;
+    ++num_reused_;
+    return static_cast<T*>(mgr);
+  }
+
+  /// @brief Caches a released manager.
+  /// @return false if the manager must be deleted instead.
+  bool put(manager_base& mgr);
+
+  /// @brief Sets the thread managers may be taken and released on.
+  void set_owner(std::thread::id owner) noexcept {
+    owner_.store(owner, std::memory_order_relaxed);
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns the number of cached managers.
+  std::size_t num_cached() const noexcept { return num_cached_; }
+
+  /// @brief Returns the number of managers handed out again.
+  std::size_t num_reused() const noexcept { return num_reused_; }
+
+private:
+  using manager_list = std::vector<manager_base*>;
+  using cache_map = std::unordered_map<std::type_index, manager_list>;
+
+  std::size_t max_cached_per_type_;    ///< Bound per type
+  std::atomic<std::thread::id> owner_; ///< Releasing thread
+  cache_map cache_;                    ///< Cached managers per type
+  std::size_t num_cached_{0};          ///< Cached managers
+  std::size_t num_reused_{0};          ///< Reused managers
+};
+
+} // namespace net::detail
@@ -0,0 +1,170 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      manager_table.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/fwd.hpp"
+
+#include "net/detail/manager_base.hpp"
+
+#include "net/socket/socket_id.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace net::detail {
+
+/// @brief Dense table of socket managers, indexed by their file descriptor.
+/// The kernel hands out the lowest free descriptor, so the table stays dense
+/// and looking up a manager is a plain array access. Every slot carries a
+/// generation that is incremented whenever a manager is placed into it.
+/// Backends store the generation alongside the descriptor in their events to
+/// detect events that refer to a previous manager of a reused descriptor.
+class manager_table {
+public:
+  /// @brief Generation counter type of a slot.
+  using generation_type = std::uint32_t;
+
+  /// @brief A single slot of the table.
+  struct slot {
+    manager_base_ptr mgr;          ///< The manager, if any
+    generation_type generation{0}; ///< Incremented on every emplace
+  };
+
+  /// @brief Forward iterator over all occupied slots.
+  class iterator {
+    friend class manager_table;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = manager_base_ptr;
+    using difference_type = std::ptrdiff_t;
+    using pointer = manager_base_ptr*;
+    using reference = manager_base_ptr&;
+
+    /// @brief Default constructs an invalid iterator.
+    iterator() = default;
+
+    reference operator*() const noexcept { return pos_->mgr; }
+
+    pointer operator->() const noexcept { return &pos_->mgr; }
+
+    iterator& operator++() noexcept {
+      ++pos_;
+      skip_empty();
+      return *this;
+    }
+
+    iterator operator++(int) noexcept {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const iterator& other) const noexcept {
+      return pos_ == other.pos_;
+    }
+
+  private:
+    iterator(slot* pos, slot* end) noexcept : pos_{pos}, end_{end} {
+      skip_empty();
+    }
+
+    void skip_empty() noexcept {
+      while ((pos_ != end_) && !pos_->mgr) {
+        ++pos_;
+      }
+    }
+
+    slot* pos_{nullptr}; ///< The current slot
+    slot* end_{nullptr}; ///< One past the last slot
+  };
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// @brief Places a manager into the slot of its socket.
+  /// Replaces any manager occupying the slot.
+  /// @param mgr The manager to place.
+  /// @return Reference to the placed manager.
+  manager_base_ptr& emplace(manager_base_ptr mgr);
+
+  /// @brief Removes the manager of a socket.
+  /// @param handle The socket to remove.
+  /// @return True if a manager was removed.
+  bool erase(socket_id handle) noexcept;
+
+  /// @brief Removes the manager at the given position.
+  /// @param it Iterator to the manager to remove.
+  /// @return Iterator to the next occupied slot.
+  iterator erase(iterator it) noexcept;
+
+  // -- lookup -----------------------------------------------------------------
+
+  /// @brief Returns the manager of a socket.
+  /// @param handle The socket to look up.
+  /// @return Pointer to the manager, or nullptr if there is none.
+  manager_base* find(socket_id handle) const noexcept {
+    return in_range(handle) ? slots_[index(handle)].mgr.get() : nullptr;
+  }
+
+  /// @brief Returns the manager of a socket, if it is of the given generation.
+  /// @param handle The socket to look up.
+  /// @param generation The generation the manager was placed with.
+  /// @return Pointer to the manager, or nullptr for a stale generation.
+  manager_base* find(socket_id handle,
+                     generation_type generation) const noexcept {
+    if (!in_range(handle)) {
+      return nullptr;
+    }
+    const auto& entry = slots_[index(handle)];
+    return (entry.generation == generation) ? entry.mgr.get() : nullptr;
+  }
+
+  /// @brief Returns the current generation of the slot of a socket.
+  /// @param handle The socket to look up.
+  /// @return The generation, 0 if no manager was ever placed for the socket.
+  generation_type generation(socket_id handle) const noexcept {
+    return in_range(handle) ? slots_[index(handle)].generation : 0;
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns the number of managers in the table.
+  std::size_t size() const noexcept { return size_; }
+
+  /// @brief Returns whether the table contains no managers.
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// @brief Returns an iterator to the first manager.
+  iterator begin() noexcept {
+    return iterator{slots_.data(), slots_.data() + slots_.size()};
+  }
+
+  /// @brief Returns the past-the-end iterator.
+  iterator end() noexcept {
+    auto* last = slots_.data() + slots_.size();
+    return iterator{last, last};
+  }
+
+private:
+  static std::size_t index(socket_id handle) noexcept {
+    return static_cast<std::size_t>(handle);
+  }
+
+  bool in_range(socket_id handle) const noexcept {
+    return (handle >= 0) && (index(handle) < slots_.size());
+  }
+
+  std::vector<slot> slots_; ///< Slots indexed by file descriptor
+  std::size_t size_{0};     ///< Number of occupied slots
+};
+
+} // namespace net::detail
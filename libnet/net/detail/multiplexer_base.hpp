@@ -13,77 +13,126 @@
 
 #include "net/detail/acceptor.hpp"
 #include "net/detail/manager_base.hpp"
+#include "net/detail/manager_pool.hpp"
+#include "net/detail/manager_table.hpp"
+#include "net/detail/multiplexer_stats.hpp"
 #include "net/detail/pollset_updater.hpp"
+#include "net/detail/timer_wheel.hpp"
 #include "net/detail/uring_manager.hpp"
 
 #include "net/operation.hpp"
-#include "net/socket/pipe_socket.hpp"
+#include "net/socket/event_socket.hpp"
 #include "net/socket/socket_id.hpp"
-#include "net/timeout_entry.hpp"
 
 #include "net/socket/tcp_accept_socket.hpp"
 
 #include "net/ip/v4_address.hpp"
 #include "net/ip/v4_endpoint.hpp"
 
-#include "util/binary_serializer.hpp"
-#include "util/byte_buffer.hpp"
 #include "util/config.hpp"
+#include "util/cpu_affinity.hpp"
+#include "util/cycle_clock.hpp"
 #include "util/error.hpp"
 #include "util/error_or.hpp"
+#include "util/intrusive_ptr.hpp"
+#include "util/mpsc_queue.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
-#include <set>
+#include <optional>
 #include <thread>
-#include <unordered_map>
+#include <vector>
 
 namespace net::detail {
 
+/// @brief Time spent in the handlers of a single manager.
+struct manager_cost {
+  socket handle;                     ///< The socket of the manager
+  std::chrono::nanoseconds cpu_time; ///< Time spent in its handlers
+  std::uint64_t num_calls;           ///< Number of handler invocations
+  std::uint64_t num_slow_calls;      ///< Invocations exceeding the budget
+};
+
+/// @brief Outcome of draining the managers of a multiplexer on shutdown.
+struct drain_stats {
+  std::size_t num_managers{0};  ///< Managers with pending writes at shutdown
+  std::size_t num_closed{0};    ///< Managers closed at the deadline
+  std::size_t bytes_pending{0}; ///< Bytes queued at shutdown
+  std::size_t bytes_dropped{0}; ///< Bytes still queued at the deadline
+
+  /// @brief Returns the number of queued bytes written while draining.
+  std::size_t bytes_flushed() const noexcept {
+    return (bytes_dropped < bytes_pending) ? (bytes_pending - bytes_dropped)
+                                           : 0;
+  }
+};
+
+/// @brief Callback invoked for handlers that exceeded their budget, with the
+/// offending manager and the time spent in the handler.
+using slow_handler_callback
+  = std::function<void(manager_base&, std::chrono::nanoseconds)>;
+
 /// @brief Abstract base class for event-driven multiplexers.
 /// Defines the interface and common functionality for socket management and
 /// event handling. Concrete implementations (epoll, kqueue, uring) override
 /// the event-specific methods. Manages socket managers, timeouts, and provides
-/// thread-safe operation queueing via pipes.
+/// thread-safe operation queueing via a lock-free command queue.
 class multiplexer_base {
   friend class manager_base;
 
+  template <class ManagerBase>
+  friend class pollset_updater_base;
+
 protected:
   /// @brief Container type for socket managers.
-  using manager_map = std::unordered_map<socket_id, manager_base_ptr>;
+  using manager_map = manager_table;
 
   // Timeout handling types
   /// @brief Optional time point for timeout tracking.
   using optional_timepoint
     = std::optional<std::chrono::steady_clock::time_point>;
-  /// @brief Set of scheduled timeouts.
-  using timeout_entry_set = std::set<timeout_entry>;
 
 public:
   // -- constructors, destructors, initialization ------------------------------
 
-  /// @brief Default constructs a multiplexer base.
-  multiplexer_base() = default;
+  /// @brief Default capacity of the command queue.
+  static constexpr std::size_t default_command_queue_capacity = 1024;
+
+  /// @brief Attempts of a multiplexer thread to push to a full command queue
+  /// of another multiplexer before giving up.
+  static constexpr std::size_t max_push_attempts = 1024;
+
+  /// @brief Default time granted to managers for flushing on shutdown.
+  static constexpr std::chrono::milliseconds default_drain_timeout{5000};
+
+  /// @brief Default number of released managers cached per type.
+  static constexpr std::size_t default_max_pooled_managers = 64;
+
+  /// @brief Constructs a multiplexer base.
+  multiplexer_base();
 
   /// @brief Virtual destructor.
-  virtual ~multiplexer_base() = default;
+  /// Releases managers that were handed over but never added.
+  virtual ~multiplexer_base();
 
   /// @brief Copy construction is deleted.
   multiplexer_base(const multiplexer_base& other) = delete;
 
-  /// @brief Move constructor.
-  multiplexer_base(multiplexer_base&& other) noexcept = default;
+  /// @brief Move construction is deleted.
+  /// Managers and the multiplexer thread refer to the multiplexer by address.
+  multiplexer_base(multiplexer_base&& other) noexcept = delete;
 
   /// @brief Copy assignment is deleted.
   multiplexer_base& operator=(const multiplexer_base& other) = delete;
 
-  /// @brief Move assignment.
-  multiplexer_base& operator=(multiplexer_base&& other) noexcept = default;
+  /// @brief Move assignment is deleted.
+  multiplexer_base& operator=(multiplexer_base&& other) noexcept = delete;
 
   /// @brief Initializes the multiplexer with factory and configuration.
   /// Creates the acceptance socket listening on the configured address and
-  /// port, sets up the pollset updater pipe for thread-safe operations, and
+  /// port, sets up the command queue for thread-safe operations, and
   /// prepares the event handling infrastructure.
   /// @tparam ManagerBase The concrete manager type to use.
   /// @param factory Factory function for creating managers for accepted
@@ -98,26 +147,77 @@ public:
                          "multiplexer_base was already initialized"};
     }
     cfg_ = std::addressof(cfg);
+    // Admission control of the acceptor is driven by the loop lag
+    const auto max_loop_lag_us = cfg.get_or<std::int64_t>(
+      "multiplexer.max-loop-lag-us", 0);
+    track_loop_lag_ = cfg.get_or("multiplexer.track-loop-lag", false)
+                      || (max_loop_lag_us > 0);
+    collect_stats_ = cfg.get_or("multiplexer.collect-stats", false);
+    profile_handlers_ = cfg.get_or("multiplexer.profile-handlers", false);
+    const auto budget_us = cfg.get_or<std::int64_t>(
+      "multiplexer.handler-budget-us", 0);
+    if (budget_us < 0) {
+      return util::error{util::error_code::invalid_argument,
+                         "multiplexer.handler-budget-us must not be negative"};
+    }
+    if (profile_handlers_) {
+      // Calibrates the cycle clock before entering the event loop
+      handler_budget_ = util::cycle_clock::to_ticks(
+        std::chrono::microseconds{budget_us});
+    }
+    const auto drain_ms = cfg.get_or<std::int64_t>(
+      "multiplexer.drain-timeout-ms", default_drain_timeout.count());
+    if (drain_ms < 0) {
+      return util::error{util::error_code::invalid_argument,
+                         "multiplexer.drain-timeout-ms must not be negative"};
+    }
+    drain_timeout_ = std::chrono::milliseconds{drain_ms};
+    if (auto err = init_pool(cfg)) {
+      return err;
+    }
+    if (auto err = init_placement(cfg)) {
+      return err;
+    }
+    const auto capacity = cfg.get_or<std::int64_t>(
+      "multiplexer.command-queue-capacity",
+      static_cast<std::int64_t>(default_command_queue_capacity));
+    if (capacity <= 0) {
+      return util::error{util::error_code::invalid_argument,
+                         "multiplexer.command-queue-capacity must be positive"};
+    }
+    if (static_cast<std::size_t>(capacity) != commands_->capacity()) {
+      commands_ = std::make_unique<command_queue>(
+        static_cast<std::size_t>(capacity));
+    }
     // Create pollset updater
-    auto pipe_res = make_pipe();
-    if (auto err = util::get_error(pipe_res)) {
+    auto event_res = make_event_socket();
+    if (auto err = util::get_error(event_res)) {
       return *err;
     }
-    auto pipe_fds = std::get<pipe_socket_pair>(pipe_res);
-    pipe_reader_ = pipe_fds.first;
-    pipe_writer_ = pipe_fds.second;
+    auto event_fds = std::get<event_socket_pair>(event_res);
+    wakeup_reader_ = event_fds.first;
+    wakeup_writer_ = event_fds.second;
     {
       auto updater = util::make_intrusive<pollset_updater<ManagerBase>>(
-        pipe_reader_, this);
+        wakeup_reader_, this);
       const auto initial = updater->initial_operation();
       add(std::move(updater), initial);
     }
 
+    // Workers of a dedicated acceptor receive their connections via the queue
+    if (!cfg.get_or("multiplexer.listen", true)) {
+      initialized_ = true;
+      return util::none;
+    }
+
     // Create Acceptor
-    auto res = net::make_tcp_accept_socket(ip::v4_endpoint(
-      (cfg.get_or("multiplexer.local", true) ? ip::v4_address::localhost
-                                             : ip::v4_address::any),
-      cfg.get_or<std::int64_t>("multiplexer.port", 0)));
+    auto res = net::make_tcp_accept_socket(
+      ip::v4_endpoint((cfg.get_or("multiplexer.local", true)
+                         ? ip::v4_address::localhost
+                         : ip::v4_address::any),
+                      cfg.get_or<std::int64_t>("multiplexer.port", 0)),
+      cfg.get_or<std::int64_t>("multiplexer.backlog", 10),
+      cfg.get_or("multiplexer.reuse-port", false));
     if (auto err = util::get_error(res)) {
       return *err;
     }
@@ -145,30 +245,215 @@ private:
   /// @brief Main event loop function (runs in multiplexer thread).
   void run();
 
+  /// @brief Reads `multiplexer.max-pooled-managers`.
+  /// @param cfg Configuration parameters.
+  /// @return Error on invalid values, none on success.
+  util::error init_pool(const util::config& cfg);
+
+  /// @brief Reads `multiplexer.cpu-affinity` and `multiplexer.numa-node`.
+  /// @param cfg Configuration parameters.
+  /// @return Error on invalid values, none on success.
+  util::error init_placement(const util::config& cfg);
+
+  /// @brief Pins the calling thread to the configured CPUs and makes it
+  /// allocate from the configured NUMA node. Called by the multiplexer thread
+  /// before entering the event loop, so that managers, which are initialized
+  /// on the multiplexer thread, allocate their buffers from the local node.
+  void apply_placement();
+
 public:
   /// @brief Initiates graceful shutdown of the multiplexer.
-  /// Signals the event loop to exit and stops accepting new connections.
+  /// Stops accepting new connections and reading from all sockets. Managers
+  /// with pending writes keep their write interest until they have flushed
+  /// their queues, and are closed once `multiplexer.drain-timeout-ms` (5s by
+  /// default, 0 closes them immediately) has passed. The event loop exits
+  /// once all managers have been removed.
   virtual void shutdown();
 
   /// @brief Blocks until the multiplexer thread completes.
   void join();
 
+  // -- Task execution ---------------------------------------------------------
+
+  /// @brief Runs a task on the multiplexer thread. Safe to call from any
+  /// thread.
+  /// Tasks are never run inline. Tasks from other threads are handed over via
+  /// the command queue, tasks from the multiplexer thread itself are collected
+  /// locally. Both are run in batches once per event loop iteration, in the
+  /// order they were posted by the respective thread.
+  /// While the command queue is full, other threads wait for the multiplexer
+  /// to catch up. Threads running another multiplexer give up after
+  /// `max_push_attempts` instead, so that multiplexers never wait on each
+  /// other.
+  /// @param fn The task to run.
+  /// @return false if the multiplexer is shut down, or if the queue stayed
+  /// full for a multiplexer thread. The task is destroyed without being run
+  /// in that case.
+  bool post(task fn);
+
+  /// @brief Runs a task on the multiplexer thread. Safe to call from any
+  /// thread.
+  /// Runs the task inline when called from the multiplexer thread, and
+  /// behaves like post() otherwise.
+  /// @param fn The task to run.
+  /// @return false if the multiplexer is shut down, the task is destroyed
+  /// without being run in that case.
+  bool dispatch(task fn);
+
+  // -- Migration --------------------------------------------------------------
+
+  /// @brief Returns whether managers can be moved between multiplexers of
+  /// this type.
+  virtual bool supports_migration() const noexcept { return false; }
+
+  /// @brief Moves a manager to another multiplexer. Safe to call from any
+  /// thread.
+  /// The manager keeps its state, e.g. the buffers of a transport, and its
+  /// pending timeouts with their IDs. The migration is run as a task on this
+  /// multiplexer, i.e. never from within a handler, and is skipped if the
+  /// manager has been removed in the meantime. Messages sent via send handles
+  /// while migrating are delivered on the target.
+  /// @param mgr The manager to move.
+  /// @param target The multiplexer to move the manager to.
+  /// @return false if migration is not supported, the manager is bound to
+  /// this multiplexer, or this multiplexer is shut down.
+  bool migrate(manager_base_ptr mgr, multiplexer_base& target);
+
+  /// @brief Moves up to `n` managers to another multiplexer. Safe to call
+  /// from any thread.
+  /// With `multiplexer.profile-handlers` enabled, the managers that spent the
+  /// most time in their handlers are moved first.
+  /// @param target The multiplexer to move the managers to.
+  /// @param n The maximum number of managers to move.
+  /// @return false if migration is not supported or this multiplexer is shut
+  /// down.
+  bool migrate_managers(multiplexer_base& target, std::size_t n);
+
   /// @brief Returns whether the multiplexer is currently running.
   /// @return True if the event loop is active.
   bool is_running() const noexcept;
 
+  // -- Placement --------------------------------------------------------------
+
+  /// @brief Returns the CPUs the multiplexer thread runs on.
+  /// Configured via `multiplexer.cpu-affinity`, a list of CPUs in the format
+  /// used by taskset, e.g. "0-3,8". With `multiplexer.numa-node` set, the
+  /// list is restricted to the CPUs of that node.
+  /// @return The CPUs, empty if the thread is not pinned.
+  const util::cpu_list& cpu_affinity() const noexcept { return cpu_affinity_; }
+
+  /// @brief Overrides the CPUs the multiplexer thread is pinned to. Takes
+  /// effect when the thread is started by start().
+  /// @param cpus The CPUs to run on, empty to not pin the thread.
+  void set_cpu_affinity(util::cpu_list cpus) noexcept {
+    cpu_affinity_ = std::move(cpus);
+  }
+
   /// @brief Sets the ID of the multiplexer thread (for debugging).
   /// @param tid The thread ID; defaults to empty/unset.
   void set_thread_id(std::thread::id tid = {}) noexcept;
 
+  // -- Manager creation -------------------------------------------------------
+
+  /// @brief Creates a manager of type `Manager` for `handle`, reusing a
+  /// released one if possible. Managers opt in to reuse by providing
+  /// `recycle(handle, xs...)`, which resets them as if they were constructed
+  /// from these arguments. Managers created this way are cached in the pool
+  /// of the multiplexer once their last reference is gone on the multiplexer
+  /// thread, up to `multiplexer.max-pooled-managers` per type (64 by default,
+  /// 0 disables pooling).
+  /// May be called from any thread, e.g. from the factory that a dedicated
+  /// acceptor of a multiplexer_group invokes for a worker. Cached managers are
+  /// only reused when called on the multiplexer thread, other threads always
+  /// construct a new manager, which is cached once released.
+  /// @param handle The handle to manage.
+  /// @param xs Further arguments for the constructor or `recycle`.
+  /// @return The manager.
+  template <class Manager, std::derived_from<socket> Socket, class... Ts>
+  util::intrusive_ptr<Manager> make_manager(Socket handle, Ts&&... xs) {
+    if constexpr (requires(Manager & mgr) {
+                    mgr.recycle(handle, std::forward<Ts>(xs)...);
+                  }) {
+      if (pool_) {
+        if (auto* cached = pool_->take<Manager>()) {
+          // Returned to the pool if recycling throws
+          util::intrusive_ptr<Manager> mgr{cached, true};
+          mgr->mpx_ = this;
+          mgr->recycle(handle, std::forward<Ts>(xs)...);
+          return mgr;
+        }
+        auto mgr = util::make_intrusive<Manager>(handle, this,
+                                                 std::forward<Ts>(xs)...);
+        mgr->pool_ = pool_;
+        return mgr;
+      }
+    }
+    return util::make_intrusive<Manager>(handle, this,
+                                         std::forward<Ts>(xs)...);
+  }
+
+  /// @brief Returns the pool of released managers.
+  /// @return The pool, or nullptr if pooling is disabled.
+  manager_pool* pool() noexcept { return pool_.get(); }
+
   // -- members ----------------------------------------------------------------
 
   /// @brief Returns the current number of active socket managers.
+  /// Safe to call from threads other than the multiplexer thread.
   /// @return The count of managed sockets.
-  std::uint16_t num_socket_managers() const noexcept {
-    return managers_.size();
+  std::size_t num_socket_managers() const noexcept {
+    return num_managers_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Returns the load of this multiplexer, i.e. the number of active
+  /// socket managers plus those handed over but not yet added by the
+  /// multiplexer thread. Safe to call from other threads.
+  /// @return The number of managers on this multiplexer.
+  std::size_t load() const noexcept {
+    return num_socket_managers()
+           + num_pending_managers_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Returns the smoothed time the event loop spent handling events and
+  /// timeouts per iteration. Only measured with `multiplexer.track-loop-lag`
+  /// enabled. Safe to call from other threads.
+  /// @return The exponentially weighted moving average of the loop lag.
+  std::chrono::nanoseconds loop_lag() const noexcept {
+    return std::chrono::nanoseconds{
+      loop_lag_ns_.load(std::memory_order_relaxed)};
+  }
+
+  /// @brief Returns the instrumentation of the event loop. Only populated
+  /// with `multiplexer.collect-stats` enabled. Snapshots may be taken from any
+  /// thread, recording is restricted to the multiplexer thread.
+  /// @return The statistics of this multiplexer.
+  multiplexer_stats& stats() noexcept { return stats_; }
+
+  /// @brief Returns the instrumentation of the event loop.
+  /// @return The statistics of this multiplexer.
+  const multiplexer_stats& stats() const noexcept { return stats_; }
+
+  /// @brief Returns how much data was flushed and dropped while draining on
+  /// shutdown. Must only be read from the multiplexer thread or after joining
+  /// it.
+  /// @return The drain statistics, all zero before shutdown.
+  const drain_stats& shutdown_stats() const noexcept { return drain_stats_; }
+
+  /// @brief Sets the callback invoked for every handler exceeding
+  /// `multiplexer.handler-budget-us`. Must be set before the multiplexer is
+  /// started. Without a callback, slow handlers are logged as warnings.
+  /// @param callback The callback to invoke.
+  void set_slow_handler_callback(slow_handler_callback callback) {
+    slow_handler_callback_ = std::move(callback);
   }
 
+  /// @brief Returns the managers that spent the most time in their handlers.
+  /// Only measured with `multiplexer.profile-handlers` enabled. Must be called
+  /// from the multiplexer thread, e.g. from a task passed to post().
+  /// @param k The maximum number of managers to return.
+  /// @return Up to `k` managers, ordered by descending handler time.
+  std::vector<manager_cost> most_expensive_managers(std::size_t k);
+
   /// @brief Returns the port the multiplexer is listening on.
   /// @return The listening port number.
   uint16_t port() const noexcept { return port_; }
@@ -182,6 +467,14 @@ public:
   /// @return True if shutdown has been initiated.
   bool shutting_down() const noexcept { return shutting_down_; }
 
+  /// @brief Returns the time read once at the start of the current event loop
+  /// iteration. Cheaper than reading the clock in every handler, at the cost
+  /// of lagging behind by the time spent in the current iteration.
+  /// @return The cached time of the event loop.
+  std::chrono::steady_clock::time_point loop_now() const noexcept {
+    return loop_now_;
+  }
+
 protected:
   /// @brief Adds a manager to the internal registry without event registration.
   /// Must be followed by a call to add(manager_ptr, operation) for event
@@ -189,19 +482,31 @@ protected:
   /// @param mgr The manager to register.
   /// @return Reference to the registered manager.
   manager_base_ptr& add(manager_base_ptr mgr) {
-    auto [it, success] = managers_.emplace(mgr->handle().id, std::move(mgr));
-    return it->second;
+    auto& added = managers_.emplace(std::move(mgr));
+    update_num_managers();
+    return added;
   }
 
   /// @brief Removes a manager from the registry by socket handle.
+  /// Pending timeouts of the manager are cancelled.
   /// @param handle The socket to remove.
-  virtual void del(net::socket handle) { managers_.erase(handle.id); }
+  virtual void del(net::socket handle) {
+    if (auto* mgr = managers_.find(handle.id)) {
+      cancel_timeouts(*mgr);
+      managers_.erase(handle.id);
+    }
+    update_num_managers();
+  }
 
   /// @brief Removes a manager from the registry by iterator.
+  /// Pending timeouts of the manager are cancelled.
   /// @param it Iterator to the manager to remove.
   /// @return Iterator to the element following the erased element.
   virtual manager_map::iterator del(manager_map::iterator it) {
-    return managers_.erase(it);
+    cancel_timeouts(**it);
+    auto next = managers_.erase(it);
+    update_num_managers();
+    return next;
   }
 
   /// @brief Retrieves a manager by socket handle with type casting.
@@ -210,11 +515,7 @@ protected:
   /// @return Pointer to the manager, or nullptr if not found.
   template <class Manager = manager_base>
   const Manager* manager(net::socket handle) const noexcept {
-    auto it = managers_.find(handle.id);
-    if (it != managers_.end()) {
-      return static_cast<Manager*>(it->second.get());
-    }
-    return nullptr;
+    return static_cast<Manager*>(managers_.find(handle.id));
   }
 
   /// @brief Mutable version of manager retrieval.
@@ -226,6 +527,26 @@ protected:
     return const_cast<Manager*>(std::as_const(*this).manager<Manager>(handle));
   }
 
+  /// @brief Retrieves a manager by socket handle and generation.
+  /// Events referring to a previous manager of a reused socket yield nullptr.
+  /// @tparam Manager The typed manager class.
+  /// @param handle The socket identifier.
+  /// @param generation The generation the manager was registered with.
+  /// @return Pointer to the manager, or nullptr if not found or stale.
+  template <class Manager = manager_base>
+  Manager* manager(net::socket handle,
+                   manager_table::generation_type generation) noexcept {
+    return static_cast<Manager*>(managers_.find(handle.id, generation));
+  }
+
+  /// @brief Returns the generation of the manager registered for a socket.
+  /// @param handle The socket identifier.
+  /// @return The generation of the slot of the socket.
+  manager_table::generation_type
+  generation(net::socket handle) const noexcept {
+    return managers_.generation(handle.id);
+  }
+
   /// @brief Checks if any managers are currently registered.
   /// @return True if managers exist.
   bool has_managers() const noexcept { return !managers_.empty(); }
@@ -253,6 +574,31 @@ private:
   /// @param remove If true, delete the manager when no operations remain.
   virtual void disable(manager_base& mgr, operation op, bool remove) = 0;
 
+  /// @brief Removes a manager from the pollset and the registry of this
+  /// multiplexer without closing its socket. Only called for multiplexers
+  /// supporting migration.
+  /// @param mgr The manager to remove.
+  virtual void detach(manager_base& mgr);
+
+  /// @brief Registers a migrated manager for the given operations, without
+  /// initializing it again. Only called for multiplexers supporting
+  /// migration.
+  /// @param mgr The manager to register.
+  /// @param mask The operations the manager was registered for.
+  virtual void attach(manager_base_ptr mgr, operation mask);
+
+  /// @brief Hands a manager to another multiplexer.
+  /// @param mgr The manager to move.
+  /// @param target The multiplexer to move the manager to.
+  void migrate_now(manager_base_ptr mgr, multiplexer_base& target);
+
+  /// @brief Registers a manager handed over by another multiplexer.
+  /// @param mgr The manager to register.
+  /// @param mask The operations the manager was registered for.
+  /// @param timeouts The pending timeouts of the manager.
+  void adopt(manager_base_ptr mgr, operation mask,
+             std::vector<timeout_entry> timeouts);
+
 public:
   /// @brief Performs a single event polling iteration.
   /// Subclasses implement backend-specific event retrieval and dispatch.
@@ -271,10 +617,79 @@ private:
   std::uint64_t set_timeout(manager_base& mgr,
                             std::chrono::steady_clock::time_point when);
 
+  /// @brief Cancels a pending timeout of a manager.
+  /// @param mgr The manager that requested the timeout.
+  /// @param id The ID of the timeout.
+  /// @return True if the timeout was pending.
+  bool cancel_timeout(manager_base& mgr, std::uint64_t id);
+
+  /// @brief Moves a pending timeout of a manager to a new time point.
+  /// @param mgr The manager that requested the timeout.
+  /// @param id The ID of the timeout.
+  /// @param when The new time point at which the timeout should fire.
+  /// @return True if the timeout was pending.
+  bool reschedule_timeout(manager_base& mgr, std::uint64_t id,
+                          std::chrono::steady_clock::time_point when);
+
+  /// @brief Cancels all pending timeouts of a manager.
+  /// @param mgr The manager whose timeouts are cancelled.
+  void cancel_timeouts(manager_base& mgr) noexcept;
+
 protected:
-  /// @brief Processes all timeouts that have expired.
+  /// @brief Refreshes the cached time of the event loop.
+  /// Called once per iteration after waiting for events.
+  void update_loop_now() noexcept {
+    loop_now_ = std::chrono::steady_clock::now();
+  }
+
+  /// @brief Processes all timeouts that have expired at loop_now().
   void handle_timeouts();
 
+  // -- Instrumentation --------------------------------------------------------
+
+  /// @brief Invokes an event handler of a manager, accounting the time spent
+  /// to the manager with `multiplexer.profile-handlers` enabled.
+  /// @param mgr The manager whose handler is invoked.
+  /// @param handler Calls the handler and returns its result.
+  /// @return The result of the handler.
+  template <class Handler>
+  manager_result invoke_handler(manager_base& mgr, Handler&& handler) {
+    if (!profile_handlers_) {
+      return handler();
+    }
+    const auto start = util::cycle_clock::now();
+    const auto res = handler();
+    account_handler(mgr, util::cycle_clock::now() - start);
+    return res;
+  }
+
+  /// @brief Marks the start of waiting for events in the kernel.
+  void stats_begin_wait() noexcept {
+    if (collect_stats_) {
+      wait_start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  /// @brief Marks the end of handling timeouts, called after
+  /// handle_timeouts().
+  void stats_timeouts_handled() noexcept {
+    if (collect_stats_) {
+      timeouts_handled_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  /// @brief Publishes the statistics of the current iteration.
+  /// @param num_events Number of events returned by the kernel.
+  void stats_end_iteration(std::size_t num_events) noexcept {
+    if (!collect_stats_) {
+      stats_.discard();
+      return;
+    }
+    stats_.record({num_events, loop_now_ - wait_start_,
+                   timeouts_handled_ - loop_now_,
+                   std::chrono::steady_clock::now() - timeouts_handled_});
+  }
+
   // -- Error handling ---------------------------------------------------------
 
   /// @brief Handles errors from event processing.
@@ -285,20 +700,39 @@ protected:
 
   /// @brief Checks whether the current thread is the multiplexer thread.
   /// @return True if running in the multiplexer thread.
-  bool is_multiplexer_thread() {
-    return (std::this_thread::get_id() == mpx_thread_id_);
+  bool is_multiplexer_thread() const noexcept {
+    return (std::this_thread::get_id()
+            == mpx_thread_id_.load(std::memory_order_relaxed));
   }
 
-  /// @brief Writes binary data to the synchronization pipe for thread-safe
-  /// operations. Allows external threads to queue operations safely.
-  /// @param ts Arguments to serialize and send.
-  /// @return Number of bytes written, or negative on error.
-  template <class... Ts>
-  ptrdiff_t write_to_pipe(Ts&&... ts) {
-    util::byte_buffer buf;
-    util::binary_serializer bs{buf};
-    bs(std::forward<Ts>(ts)...);
-    return write(pipe_writer_, util::as_const_bytes(buf));
+  /// @brief Hands a command over to the multiplexer thread.
+  /// Signals the event socket only if the queue may have been empty, and
+  /// yields while the queue is full. Threads running a multiplexer yield at
+  /// most `max_push_attempts` times, two multiplexers filling each other's
+  /// queues would wait forever otherwise. Safe to call from any thread.
+  /// @param cmd The command to push.
+  /// @return false if the multiplexer no longer accepts commands, or if the
+  /// queue stayed full for a multiplexer thread.
+  bool push_command(pollset_command cmd);
+
+  /// @brief Runs all tasks posted from the multiplexer thread so far.
+  /// Tasks posted while running are deferred to the next call.
+  void run_local_tasks();
+
+  /// @brief Hands a manager over to the multiplexer thread via the queue.
+  /// Used by add() when called from any other thread.
+  /// @param mgr The manager to add.
+  /// @param initial The operations to monitor once added.
+  void request_add(manager_base_ptr mgr, operation initial);
+
+  /// @brief Feeds the time spent in one loop iteration into the loop lag.
+  /// @param elapsed Time spent handling events and timeouts.
+  void record_loop_lag(std::chrono::steady_clock::duration elapsed) noexcept {
+    // Single writer, so no read-modify-write is necessary
+    const auto sample
+      = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    const auto old = loop_lag_ns_.load(std::memory_order_relaxed);
+    loop_lag_ns_.store(old + ((sample - old) / 8), std::memory_order_relaxed);
   }
 
   /// @brief Internal helper to record the listening port.
@@ -306,28 +740,79 @@ protected:
   void set_port(uint16_t port) noexcept { port_ = port; }
 
 private:
-  uint16_t port_{0};                 ///< Listening port
-  manager_map managers_;             ///< Active socket managers
-  const util::config* cfg_{nullptr}; ///< Configuration reference
+  /// @brief Closes all managers that are still draining at the deadline.
+  void close_draining_managers();
+
+  /// @brief Accounts the time spent in a handler to its manager and reports
+  /// handlers exceeding the budget.
+  /// @param mgr The manager whose handler was invoked.
+  /// @param ticks The cycle clock ticks spent in the handler.
+  void account_handler(manager_base& mgr, std::uint64_t ticks);
+
+  /// @brief Publishes the size of the manager map for other threads.
+  void update_num_managers() noexcept {
+    num_managers_.store(managers_.size(), std::memory_order_relaxed);
+  }
+
+  uint16_t port_{0};                         ///< Listening port
+  // Declared before managers_, which are released into the pool and cancel
+  // their timeouts on destruction
+  std::shared_ptr<manager_pool> pool_;       ///< Released managers
+  timer_wheel timeouts_;                     ///< Scheduled timeouts
+  manager_map managers_;                     ///< Active socket managers
+  std::atomic<std::size_t> num_managers_{0}; ///< Published manager count
+  const util::config* cfg_{nullptr};         ///< Configuration reference
 
   // thread context
-  std::thread mpx_thread_;        ///< The multiplexer thread
-  std::thread::id mpx_thread_id_; ///< ID of multiplexer thread
+  std::thread mpx_thread_;                     ///< The multiplexer thread
+  std::atomic<std::thread::id> mpx_thread_id_; ///< ID of multiplexer thread
+
+  // placement
+  util::cpu_list cpu_affinity_;          ///< CPUs of the thread, empty is all
+  std::optional<std::size_t> numa_node_; ///< Node allocated from, if any
+
+  // load tracking
+  std::atomic<std::size_t> num_pending_managers_{0}; ///< Managers in queue
+  std::atomic<std::int64_t> loop_lag_ns_{0};         ///< EWMA of the loop lag
 
 protected:
-  bool shutting_down_{false}; ///< Shutdown flag
-  bool running_{false};       ///< Running flag
-  bool initialized_{false};   ///< Whether the mpx has been initialized
+  bool shutting_down_{false};    ///< Shutdown flag
+  bool running_{false};          ///< Running flag
+  bool initialized_{false};      ///< Whether the mpx has been initialized
+  bool track_loop_lag_{false};   ///< Whether the loop lag is measured
+  bool collect_stats_{false};    ///< Whether stats_ are populated
+  bool profile_handlers_{false}; ///< Whether handlers are timed
 
 private:
-  // pipe for synchronous access to mpx
-  pipe_socket pipe_writer_{invalid_socket_id}; ///< Write end of sync pipe
-  pipe_socket pipe_reader_{invalid_socket_id}; ///< Read end of sync pipe
+  /// @brief Queue type for commands from other threads.
+  using command_queue = util::mpsc_queue<pollset_command>;
+
+  // command queue for synchronous access to mpx
+  std::unique_ptr<command_queue> commands_;       ///< Pending commands
+  std::atomic<bool> notified_{false};             ///< Wakeup is pending
+  std::atomic<bool> commands_closed_{false};      ///< Rejects new commands
+  event_socket wakeup_writer_{invalid_socket_id}; ///< Signals the updater
+  event_socket wakeup_reader_{invalid_socket_id}; ///< Read by the updater
+  std::vector<task> local_tasks_;                 ///< Posted by the mpx thread
+  std::vector<task> running_tasks_;               ///< Local tasks being run
 
   // timeout handling
-  timeout_entry_set timeouts_;          ///< Scheduled timeouts
-  timeout_entry_set cached_timeouts_;   ///< Cached set for processing
-  std::uint64_t current_timeout_id_{0}; ///< Next timeout ID
+  std::uint64_t current_timeout_id_{0};              ///< Next timeout ID
+  std::chrono::steady_clock::time_point loop_now_{}; ///< Cached loop time
+
+  // instrumentation
+  multiplexer_stats stats_;                                  ///< Statistics
+  std::chrono::steady_clock::time_point wait_start_{};       ///< Wait started
+  std::chrono::steady_clock::time_point timeouts_handled_{}; ///< Timeouts done
+
+  // draining on shutdown
+  std::chrono::milliseconds drain_timeout_{default_drain_timeout}; ///< Grace
+  optional_timepoint drain_deadline_{std::nullopt}; ///< Force close at
+  drain_stats drain_stats_;                         ///< Flushed and dropped
+
+  // handler profiling
+  std::uint64_t handler_budget_{0};             ///< Budget in ticks, 0 is none
+  slow_handler_callback slow_handler_callback_; ///< Reports slow handlers
 
 protected:
   optional_timepoint current_timeout_{std::nullopt}; ///< Next timeout
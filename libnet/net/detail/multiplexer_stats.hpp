@@ -0,0 +1,125 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      multiplexer_stats.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "util/histogram.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace net::detail {
+
+/// @brief Instrumentation of the event loop of a multiplexer.
+/// Collects per-iteration histograms and running totals. The multiplexer
+/// thread accumulates the counters of an iteration in plain members and
+/// publishes them once at the end of the iteration, so recording does not
+/// use read-modify-write operations. Snapshots may be taken from any thread.
+class multiplexer_stats {
+public:
+  /// @brief The clock used for timestamps.
+  using clock_type = std::chrono::steady_clock;
+
+  /// @brief Timings of a single event loop iteration.
+  struct iteration {
+    std::size_t num_events{0};       ///< Events returned by the kernel
+    clock_type::duration blocked{};  ///< Time spent waiting in the kernel
+    clock_type::duration timeouts{}; ///< Time spent handling timeouts
+    clock_type::duration events{};   ///< Time spent handling events
+  };
+
+  /// @brief A copy of the statistics at some point in time.
+  struct snapshot {
+    clock_type::time_point time{}; ///< Time the snapshot was taken
+
+    std::uint64_t num_iterations{0}; ///< Event loop iterations
+    std::uint64_t num_events{0};     ///< Events handled
+    std::uint64_t num_accepted{0};   ///< Accepted connections
+    std::uint64_t num_rejected{0};   ///< Connections closed on admission
+    std::uint64_t bytes_read{0};     ///< Bytes read by transports
+    std::uint64_t bytes_written{0};  ///< Bytes written by transports
+
+    util::histogram::snapshot events_per_iteration;        ///< Batch sizes
+    util::histogram::snapshot blocked_ns;                  ///< Kernel waits
+    util::histogram::snapshot timeouts_ns;                 ///< Timeout handling
+    util::histogram::snapshot events_ns;                   ///< Event handling
+    util::histogram::snapshot bytes_read_per_iteration;    ///< Reads per loop
+    util::histogram::snapshot bytes_written_per_iteration; ///< Writes per loop
+  };
+
+  // -- recording (multiplexer thread only) ------------------------------------
+
+  /// @brief Adds bytes read during the current iteration.
+  void add_bytes_read(std::size_t num_bytes) noexcept {
+    bytes_read_ += num_bytes;
+  }
+
+  /// @brief Adds bytes written during the current iteration.
+  void add_bytes_written(std::size_t num_bytes) noexcept {
+    bytes_written_ += num_bytes;
+  }
+
+  /// @brief Counts a connection accepted during the current iteration.
+  void add_accepted() noexcept { ++accepted_; }
+
+  /// @brief Counts a connection closed by admission control during the
+  /// current iteration.
+  void add_rejected() noexcept { ++rejected_; }
+
+  /// @brief Publishes the current iteration and starts the next one.
+  /// @param it The timings of the iteration.
+  void record(const iteration& it) noexcept;
+
+  /// @brief Drops the counters of the current iteration without publishing.
+  void discard() noexcept {
+    bytes_read_ = 0;
+    bytes_written_ = 0;
+    accepted_ = 0;
+    rejected_ = 0;
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns a snapshot of the statistics. Safe to call from any
+  /// thread.
+  snapshot read() const noexcept;
+
+private:
+  // Counters of the current iteration
+  std::size_t bytes_read_{0};    ///< Bytes read in this iteration
+  std::size_t bytes_written_{0}; ///< Bytes written in this iteration
+  std::size_t accepted_{0};      ///< Connections accepted in this iteration
+  std::size_t rejected_{0};      ///< Connections rejected in this iteration
+
+  // Published totals
+  std::atomic<std::uint64_t> num_iterations_{0};      ///< Loop iterations
+  std::atomic<std::uint64_t> num_events_{0};          ///< Events handled
+  std::atomic<std::uint64_t> num_accepted_{0};        ///< Accepted connections
+  std::atomic<std::uint64_t> num_rejected_{0};        ///< Rejected connections
+  std::atomic<std::uint64_t> bytes_read_total_{0};    ///< Bytes read
+  std::atomic<std::uint64_t> bytes_written_total_{0}; ///< Bytes written
+
+  // Published histograms
+  util::histogram events_per_iteration_;        ///< Events per iteration
+  util::histogram blocked_ns_;                  ///< Waiting in the kernel
+  util::histogram timeouts_ns_;                 ///< Handling timeouts
+  util::histogram events_ns_;                   ///< Handling events
+  util::histogram bytes_read_per_iteration_;    ///< Bytes read per iteration
+  util::histogram bytes_written_per_iteration_; ///< Bytes written per iteration
+};
+
+/// @brief Computes the rate of accepted connections between two snapshots.
+/// @param before The earlier snapshot.
+/// @param after The later snapshot.
+/// @return Accepted connections per second, 0 if no time passed.
+double accepts_per_second(const multiplexer_stats::snapshot& before,
+                          const multiplexer_stats::snapshot& after) noexcept;
+
+} // namespace net::detail
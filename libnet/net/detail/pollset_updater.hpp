@@ -6,8 +6,6 @@
  *             the GNU GPL3 License.
  */
 
-// TODO: Handle multiple operations at once?
-
 #pragma once
 
 #include "net/fwd.hpp"
@@ -22,21 +20,18 @@
 #include "net/manager_result.hpp"
 #include "net/operation.hpp"
 
-#include "net/socket/pipe_socket.hpp"
+#include "net/socket/event_socket.hpp"
 
-#include "util/binary_deserializer.hpp"
-#include "util/byte_buffer.hpp"
-#include "util/byte_span.hpp"
 #include "util/error.hpp"
 #include "util/logger.hpp"
 
 #include <cstdint>
-#include <sys/socket.h>
+#include <functional>
 #include <sys/uio.h>
 
 namespace net::detail {
 
-/// @brief Opcodes for commands sent through the pipe to the pollset updater.
+/// @brief Opcodes for commands sent to the pollset updater.
 /// Used to signal different operations that need to be performed on the
 /// multiplexer's pollset.
 enum class pollset_opcode : std::uint8_t {
@@ -46,54 +41,70 @@ enum class pollset_opcode : std::uint8_t {
   add = 0x01,
   /// Opcode indicating the multiplexer should be shut down.
   shutdown = 0x02,
+  /// Opcode indicating a posted task should be run.
+  run = 0x03,
+};
+
+/// @brief A task run on the multiplexer thread.
+/// Closures of up to three pointers in size are stored without allocating.
+using task = std::move_only_function<void()>;
+
+/// @brief A command handed to the multiplexer thread via its command queue.
+struct pollset_command {
+  pollset_opcode code{pollset_opcode::none}; ///< The requested operation
+  manager_base* mgr{nullptr};                ///< Manager to add, owning
+  operation op{operation::none};             ///< Initial operations of mgr
+  task fn{};                                 ///< Task to run
 };
 
 /// @brief Generic base for pollset updater implementations.
-/// Manages the pollset of the multiplexer from a separate thread. Handles
-/// adding and removing socket managers, and coordinating multiplexer
-/// shutdown in a thread-safe manner via a pipe socket.
+/// Manages the pollset of the multiplexer on behalf of other threads. Handles
+/// adding socket managers, and coordinating multiplexer shutdown in a
+/// thread-safe manner.
 ///
-/// The pollset_updater runs in the multiplexer thread and reads commands
-/// from a pipe that may be written to from other threads, allowing
-/// safe modification of the pollset without race conditions.
+/// Other threads push commands into the lock-free command queue of the
+/// multiplexer and signal an event socket only when the queue was empty. The
+/// pollset_updater runs in the multiplexer thread, waits for the event socket
+/// and drains the whole queue on every wakeup.
 template <class ManagerBase>
 class pollset_updater_base : public ManagerBase {
 public:
-  static constexpr std::size_t message_size
-    = sizeof(pollset_opcode) + sizeof(manager_base*) + sizeof(operation);
-
   // -- constructors, destructors, and assignment operators --------------------
 
   /// @brief Constructs a pollset updater.
-  /// @param handle The read end of the pipe socket for receiving commands.
+  /// @param handle The read end of the event socket of the multiplexer.
   /// @param mpx Pointer to the owning multiplexer.
-  pollset_updater_base(net::pipe_socket handle, multiplexer_base* mpx);
+  pollset_updater_base(net::event_socket handle, multiplexer_base* mpx);
 
   /// @brief Destructs the pollset updater.
   virtual ~pollset_updater_base() = default;
 
+  /// @brief Pollset updaters are bound to the multiplexer they serve.
+  bool migratable() const noexcept override { return false; }
+
 protected:
   // -- protected helper functions for common operations ----------------------
 
-  /// @brief Handles a pollset update operation received from the pipe.
+  /// @brief Handles all commands currently in the queue of the multiplexer,
+  /// followed by the tasks posted from the multiplexer thread itself.
+  /// Must be called after consuming the notification of the event socket.
+  /// @return The result of the last handled command.
+  manager_result handle_commands();
+
+  /// @brief Handles a single pollset update command.
   /// Processes the opcode and updates the pollset accordingly.
+  /// @param cmd The command to handle.
   /// @return The result of the operation.
-  manager_result handle_operation();
-
-  pollset_opcode code_;
-  manager_base* mgr_;
-  operation op_;
-  std::array<iovec, 3> iov_;
-  msghdr msg_;
+  manager_result handle_operation(pollset_command& cmd);
 };
 
 template <class ManagerBase>
 class pollset_updater;
 
 /// @brief Specialization for epoll/kqueue-based managers.
-/// Handles pollset updates via read events on the pipe socket.
-/// When the pipe has data to read, it decodes the command and processes
-/// the pollset update accordingly.
+/// Handles pollset updates via read events on the event socket.
+/// When the event socket is signalled, it consumes the notification and
+/// processes all queued commands.
 template <>
 class pollset_updater<event_handler>
   : public pollset_updater_base<event_handler> {
@@ -102,8 +113,8 @@ class pollset_updater<event_handler>
 public:
   using base::base;
 
-  /// @brief Handles a read event from the pipe socket (epoll/kqueue).
-  /// Reads commands from the pipe and processes pollset updates.
+  /// @brief Handles a read event from the event socket (epoll/kqueue).
+  /// Consumes the notification and processes all queued commands.
   /// @return The result of handling the read event.
   manager_result handle_read_event();
 };
@@ -111,26 +122,33 @@ public:
 #if defined(LIB_NET_URING)
 
 /// @brief Specialization for io_uring-based managers.
-/// Handles pollset updates via io_uring completion events on the pipe read.
-/// When a completion event fires on the pipe socket, it decodes the command
-/// and processes the pollset update accordingly.
+/// Handles pollset updates via io_uring completion events on the event socket.
+/// When a read of the event socket completes, it processes all queued
+/// commands and resubmits the read.
 template <>
 class pollset_updater<uring_manager>
   : public pollset_updater_base<uring_manager> {
   using base = pollset_updater_base<uring_manager>;
 
 public:
-  pollset_updater(net::pipe_socket handle, multiplexer_base* mpx);
+  pollset_updater(net::event_socket handle, multiplexer_base* mpx);
 
   manager_result enable(operation op) override;
 
-  /// @brief Handles a completion event from the pipe socket (io_uring).
-  /// Reads commands from the pipe and processes pollset updates.
+  /// @brief Handles a completion event from the event socket (io_uring).
+  /// Processes all queued commands and resubmits the read.
   /// @param op The operation that completed (should be read).
   /// @param res The result of the io_uring operation (bytes read).
   /// @return The result of handling the completion event.
   manager_result handle_completion(operation op, int res,
                                    std::uint64_t id) override;
+
+private:
+  /// @brief Submits a read of the event socket to the ring.
+  bool submit_read();
+
+  std::uint64_t wakeup_value_{0}; ///< Target of the event socket read
+  iovec wakeup_iov_{};            ///< Single buffer referring to wakeup_value_
 };
 
 #endif // LIB_NET_URING
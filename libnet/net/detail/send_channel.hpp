@@ -0,0 +1,163 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      send_channel.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/fwd.hpp"
+
+#include "net/detail/multiplexer_base.hpp"
+
+#include "net/socket/socket.hpp"
+
+#include "util/intrusive_ptr.hpp"
+#include "util/logger.hpp"
+#include "util/mpsc_queue.hpp"
+#include "util/ref_counted.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace net::detail {
+
+/// @brief Per-connection queue for handing messages to a transport from
+/// other threads.
+/// Producers push into a bounded lock-free queue and post a single flush task
+/// to the multiplexer when the queue transitions from drained to non-empty.
+/// The flush task hands the channel to the transport, which splices all
+/// queued messages into its write queue at once. The channel only refers to
+/// the transport weakly: the transport closes it on destruction, after which
+/// pushing fails and queued messages are dropped.
+/// While the transport migrates to another multiplexer, the channel is
+/// detached. Flush tasks scheduled in the meantime are ignored, and the
+/// transport drains the channel once it is attached to its new multiplexer.
+/// @tparam Message The type of the queued messages.
+template <class Message>
+class send_channel : public util::ref_counted {
+public:
+  /// @brief Callback invoked on the multiplexer thread to drain the channel.
+  using flush_function = std::move_only_function<void()>;
+
+  // -- constructors, destructors ----------------------------------------------
+
+  /// @brief Constructs an open channel.
+  /// @param mpx The multiplexer running the transport.
+  /// @param handle The socket of the transport.
+  /// @param capacity The maximum number of queued messages.
+  /// @param flush Invoked on the multiplexer thread with queued messages.
+  send_channel(multiplexer_base* mpx, socket handle, std::size_t capacity,
+               flush_function flush)
+    : mpx_{mpx}, handle_{handle}, queue_{capacity}, flush_{std::move(flush)} {
+    // nop
+  }
+
+  // -- producer interface -----------------------------------------------------
+
+  /// @brief Queues a message for the transport. Safe to call from any thread.
+  /// @param msg The message to queue, left untouched if the channel is closed
+  /// or full.
+  /// @return false if the message was not queued, or if it was queued but no
+  /// flush could be scheduled because the multiplexer is shut down or busy.
+  /// Such messages are only delivered along with a later message that
+  /// schedules a flush. True otherwise.
+  bool push(Message&& msg) {
+    if (closed()) {
+      return false;
+    }
+    if (!queue_.try_push(std::move(msg))) {
+      return false;
+    }
+    // Only the first message after a flush schedules the next one
+    if (!scheduled_.exchange(true)) {
+      auto* mpx = mpx_.load(std::memory_order_acquire);
+      if (mpx == nullptr) {
+        // Migrating, attach() drains the channel
+        return true;
+      }
+      auto self = util::intrusive_ptr<send_channel>{this};
+      if (!mpx->post([self = std::move(self), mpx] { self->flush(mpx); })) {
+        LOG_DEBUG("Could not schedule flush for ", NET_ARG2("id", handle_.id),
+                  ", multiplexer is shut down or busy");
+        // Later pushes try again instead of relying on the failed flush
+        scheduled_.exchange(false);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // -- consumer interface -----------------------------------------------------
+
+  /// @brief Removes the first queued message. Must only be called from the
+  /// multiplexer thread.
+  /// @param msg Assigned the removed message on success.
+  /// @return false if no message is queued, true otherwise.
+  bool try_pop(Message& msg) noexcept { return queue_.try_pop(msg); }
+
+  /// @brief Detaches the channel from its multiplexer before the transport
+  /// migrates. Must only be called from the multiplexer thread.
+  void detach() noexcept { mpx_.store(nullptr, std::memory_order_release); }
+
+  /// @brief Attaches the channel to the new multiplexer of a migrated
+  /// transport and hands all messages queued in the meantime to it. Must only
+  /// be called from the new multiplexer thread.
+  /// @param mpx The multiplexer now running the transport.
+  void attach(multiplexer_base* mpx) {
+    mpx_.store(mpx, std::memory_order_release);
+    flush(mpx);
+  }
+
+  /// @brief Closes the channel. Must only be called from the multiplexer
+  /// thread, as part of destroying the transport.
+  void close() noexcept {
+    closed_.store(true, std::memory_order_release);
+    flush_ = nullptr;
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns whether the transport of this channel is gone.
+  bool closed() const noexcept {
+    return closed_.load(std::memory_order_acquire);
+  }
+
+  /// @brief Returns the socket of the transport.
+  socket handle() const noexcept { return handle_; }
+
+  /// @brief Returns the maximum number of queued messages.
+  std::size_t capacity() const noexcept { return queue_.capacity(); }
+
+private:
+  /// @brief Hands all queued messages to the transport, if it still exists.
+  /// @param mpx The multiplexer the flush was scheduled on.
+  void flush(multiplexer_base* mpx) {
+    if (mpx != mpx_.load(std::memory_order_acquire)) {
+      // The transport migrated since, the flush is repeated by attach()
+      return;
+    }
+    // Reset before draining, so that later pushes schedule another flush
+    scheduled_.exchange(false);
+    if (flush_) {
+      flush_();
+    }
+  }
+
+  std::atomic<multiplexer_base*> mpx_; ///< Multiplexer running the transport
+  socket handle_;                      ///< Socket of the transport
+  util::mpsc_queue<Message> queue_;    ///< Messages not yet spliced
+  std::atomic<bool> scheduled_{false}; ///< A flush task is pending
+  std::atomic<bool> closed_{false};    ///< The transport is gone
+  flush_function flush_;               ///< Splices messages, mpx thread only
+};
+
+/// @brief Owning pointer to a send channel.
+template <class Message>
+using send_channel_ptr = util::intrusive_ptr<send_channel<Message>>;
+
+} // namespace net::detail
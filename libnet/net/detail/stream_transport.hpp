@@ -12,6 +12,7 @@
 
 #include "net/detail/event_handler.hpp"
 #include "net/detail/multiplexer_base.hpp"
+#include "net/detail/send_channel.hpp"
 #include "net/detail/transport_base.hpp"
 #if defined(LIB_NET_URING)
 #  include "net/detail/uring_manager.hpp"
@@ -20,6 +21,7 @@
 
 #include "net/manager_result.hpp"
 #include "net/receive_policy.hpp"
+#include "net/send_handle.hpp"
 #include "net/socket/stream_socket.hpp"
 
 #include "util/config.hpp"
@@ -27,6 +29,12 @@
 #include "util/format.hpp"
 #include "util/logger.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <optional>
 #include <sys/uio.h>
 #include <utility>
 
@@ -38,9 +46,25 @@ namespace net::detail {
 /// Provides a transport layer for stream-based protocols (TCP) with
 /// buffer management for reading and writing. Supports layering other
 /// protocol handlers on top through the NextLayer template parameter.
+/// Writing counts as blocked once the queued bytes reach
+/// `transport.write-high-watermark` and is unblocked once they drop to
+/// `transport.write-low-watermark`. Both transitions are reported to the
+/// next layer via the optional members `on_write_blocked(parent)` and
+/// `on_write_unblocked(parent)`, and reading is paused in between with
+/// `transport.pause-reads-when-blocked`. A proxy relaying to another
+/// connection pauses the reads of that connection from these callbacks.
+/// Transports created by multiplexer_base::make_manager are reused once
+/// released, keeping the capacity of their buffers. The next layer is
+/// destroyed on release and constructed anew on reuse.
+/// With `multiplexer.provided-buffers` enabled, io_uring transports receive
+/// into the buffer ring shared by all transports of their multiplexer and pass
+/// the bytes to the next layer in place. The read buffer of a transport is
+/// then only allocated for reads that complete across several receives.
 /// @tparam NextLayer The upper protocol layer to stack on this transport.
 template <class ManagerBase, class NextLayer>
 class stream_transport_base : public transport_base, public ManagerBase {
+  using channel_type = send_channel<util::byte_buffer>;
+
 public:
   /// @brief Constructs a stream transport layer.
   /// @param handle The stream socket for this connection.
@@ -49,10 +73,18 @@ public:
   template <class... Ts>
   stream_transport_base(stream_socket handle, detail::multiplexer_base* mpx,
                         Ts&&... xs)
-    : ManagerBase{handle, mpx}, next_layer_(std::forward<Ts>(xs)...) {
+    : ManagerBase{handle, mpx},
+      next_layer_{std::in_place, std::forward<Ts>(xs)...} {
     LOG_DEBUG("Creating stream_transport with ", NET_ARG2("id", handle.id));
   }
 
+  /// @brief Destructs the transport and closes its send channel, if any.
+  ~stream_transport_base() {
+    if (send_channel_) {
+      send_channel_->close();
+    }
+  }
+
   /// @brief Initializes the transport with configuration.
   /// Sets the socket to non-blocking mode and initializes the next layer.
   /// @param cfg The configuration object.
@@ -65,13 +97,37 @@ public:
     if (auto err = transport_base::init(cfg)) {
       return err;
     }
-    return next_layer_.init(*this, cfg);
+    return next_layer_->init(*this, cfg);
+  }
+
+  /// @brief Resets a released transport to manage `handle`, as if it was
+  /// constructed from the given arguments.
+  /// @param handle The stream socket for this connection.
+  /// @param xs Constructor arguments forwarded to NextLayer.
+  template <class... Ts>
+    requires std::constructible_from<NextLayer, Ts...>
+  void recycle(stream_socket handle, Ts&&... xs) {
+    LOG_DEBUG("Recycling stream_transport for ", NET_ARG2("id", handle.id));
+    // Leaves the transport released if the constructor throws
+    next_layer_.emplace(std::forward<Ts>(xs)...);
+    manager_base::reset(handle);
+    received_ = 0;
+    written_ = 0;
+    min_read_size_ = 0;
+    max_read_size_ = 0;
+    num_enqueued_bytes_ = 0;
+    write_blocked_ = false;
+    read_buffer_.clear();
   }
 
   // -- manager_base API -------------------------------------------------------
 
   manager_result handle_timeout(uint64_t id) override {
-    return next_layer_.handle_timeout(*this, id);
+    return next_layer_->handle_timeout(*this, id);
+  }
+
+  std::size_t num_enqueued_bytes() const noexcept override {
+    return num_enqueued_bytes_;
   }
 
   // -- transport_base API -----------------------------------------------------
@@ -82,15 +138,16 @@ public:
               NET_ARG2("max_read_size_", policy.max_size));
     received_ = 0;
     min_read_size_ = policy.min_size;
-    read_buffer_.resize(policy.max_size);
+    max_read_size_ = policy.max_size;
+    if (!lazy_read_buffer_) {
+      read_buffer_.resize(policy.max_size);
+    }
   }
 
   // -- stream_transport specific API ------------------------------------------
 
   void enqueue(util::byte_buffer&& bytes) {
-    iovecs_.emplace_back(bytes.data(), bytes.size());
-    num_enqueued_bytes_ += bytes.size();
-    write_queue_.push_back(std::move(bytes));
+    append(std::move(bytes));
     manager_base::register_writing();
   }
 
@@ -100,7 +157,56 @@ public:
     enqueue(std::move(buf));
   }
 
+  /// @brief Returns whether the queued bytes exceeded the high watermark and
+  /// have not dropped to the low watermark since.
+  bool write_blocked() const noexcept { return write_blocked_; }
+
+  /// @brief Returns a handle for enqueueing data from other threads.
+  /// Must be called from the multiplexer thread. All handles of a transport
+  /// share a single queue, which is spliced into the write queue in batches.
+  /// @return A handle to the send channel of this transport.
+  send_handle<util::byte_buffer> make_send_handle() {
+    if (!send_channel_) {
+      send_channel_ = util::make_intrusive<channel_type>(
+        manager_base::mpx(), manager_base::handle(), send_queue_capacity_,
+        [this] { splice(*send_channel_); });
+    }
+    return send_handle<util::byte_buffer>{send_channel_};
+  }
+
+  /// @brief Detaches the send channel before migrating to another
+  /// multiplexer.
+  void handle_detached() override {
+    if (send_channel_) {
+      send_channel_->detach();
+    }
+  }
+
+  /// @brief Attaches the send channel to the new multiplexer and flushes the
+  /// messages queued while migrating.
+  void handle_attached() override {
+    if (send_channel_) {
+      send_channel_->attach(manager_base::mpx());
+    }
+  }
+
 protected:
+  /// @brief Destroys the next layer, so nothing it holds outlives the
+  /// connection, closes the send channel and caches the queued write buffers.
+  void handle_released() override {
+    next_layer_.reset();
+    if (send_channel_) {
+      send_channel_->close();
+      send_channel_.reset();
+    }
+    for (auto& buf : write_queue_) {
+      buf.clear();
+      transport_base::return_buffer(std::move(buf));
+    }
+    write_queue_.clear();
+    iovecs_.clear();
+  }
+
   manager_result handle_read_result(int read_res) {
     if (read_res < 0) {
       // Check whether the error is temporary, i.e., EAGAIN
@@ -111,9 +217,11 @@ protected:
     } else {
       LOG_DEBUG("Read ", read_res, " bytes from ",
                 NET_ARG2("socket", handle().id));
+      ManagerBase::mpx()->stats().add_bytes_read(
+        static_cast<std::size_t>(read_res));
       received_ += read_res;
       if (received_ >= min_read_size_) {
-        const auto consume_result = next_layer_.consume(
+        const auto consume_result = next_layer_->consume(
           *this, util::const_byte_span{read_buffer_.data(), received_});
         if (consume_result == manager_result::error) {
           return manager_result::error;
@@ -124,6 +232,48 @@ protected:
     }
   }
 
+  /// @brief Passes bytes received outside of the read buffer to the next
+  /// layer, honoring the receive policy. Bytes are only copied to the read
+  /// buffer to complete reads across several calls. Stops once reading has
+  /// been disabled, e.g. by the next layer, leaving the remaining bytes in
+  /// `data`.
+  /// @param data The received bytes, advanced past the consumed ones.
+  manager_result consume_received(util::const_byte_span& data) {
+    while (!data.empty() && manager_base::mask_contains(operation::read)) {
+      if (max_read_size_ == 0) {
+        LOG_ERROR("Received bytes without a configured read on ",
+                  NET_ARG2("socket", manager_base::handle().id));
+        return manager_result::error;
+      }
+      if ((received_ == 0) && (data.size() >= min_read_size_)) {
+        const auto num_bytes = std::min(data.size(), max_read_size_);
+        if (next_layer_->consume(*this, data.first(num_bytes))
+            == manager_result::error) {
+          return manager_result::error;
+        }
+        data = data.subspan(num_bytes);
+        continue;
+      }
+      if (read_buffer_.size() < max_read_size_) {
+        read_buffer_.resize(max_read_size_);
+      }
+      const auto num_bytes = std::min(data.size(),
+                                      max_read_size_ - received_);
+      std::copy_n(data.begin(), num_bytes, read_buffer_.begin() + received_);
+      received_ += num_bytes;
+      data = data.subspan(num_bytes);
+      if (received_ >= min_read_size_) {
+        const auto consume_result = next_layer_->consume(
+          *this, util::const_byte_span{read_buffer_.data(), received_});
+        if (consume_result == manager_result::error) {
+          return manager_result::error;
+        }
+        received_ = 0;
+      }
+    }
+    return manager_result::ok;
+  }
+
   manager_result handle_write_result(int write_res) {
     if (write_res < 0) {
       if (last_socket_error_is_temporary()) {
@@ -134,24 +284,78 @@ protected:
     }
     LOG_DEBUG("Wrote ", write_res, " bytes to ",
               NET_ARG2("socket", handle().id));
+    ManagerBase::mpx()->stats().add_bytes_written(
+      static_cast<std::size_t>(write_res));
     remove_written_data_from_queue(write_res);
     return manager_result::ok;
   }
 
 private:
+  void append(util::byte_buffer&& bytes) {
+    iovecs_.emplace_back(bytes.data(), bytes.size());
+    num_enqueued_bytes_ += bytes.size();
+    write_queue_.push_back(std::move(bytes));
+    if (!write_blocked_ && (transport_base::write_high_watermark_ != 0)
+        && (num_enqueued_bytes_ >= transport_base::write_high_watermark_)) {
+      set_write_blocked(true);
+    }
+  }
+
+  void set_write_blocked(bool blocked) {
+    LOG_DEBUG("Writing ", blocked ? "blocked" : "unblocked", " on ",
+              NET_ARG2("socket", manager_base::handle().id), " with ",
+              NET_ARG(num_enqueued_bytes_));
+    write_blocked_ = blocked;
+    if (transport_base::pause_reads_when_blocked_) {
+      if (blocked) {
+        manager_base::pause_reading();
+      } else if (manager_base::reading_paused()) {
+        manager_base::register_reading();
+      }
+    }
+    if (blocked) {
+      if constexpr (requires { next_layer_->on_write_blocked(*this); }) {
+        next_layer_->on_write_blocked(*this);
+      }
+    } else {
+      if constexpr (requires { next_layer_->on_write_unblocked(*this); }) {
+        next_layer_->on_write_unblocked(*this);
+      }
+    }
+  }
+
+  /// @brief Moves all buffers queued by other threads to the write queue.
+  void splice(channel_type& channel) {
+    util::byte_buffer bytes;
+    std::size_t num_spliced = 0;
+    while (channel.try_pop(bytes)) {
+      append(std::move(bytes));
+      ++num_spliced;
+    }
+    LOG_DEBUG("Spliced ", num_spliced, " buffers into write queue of ",
+              NET_ARG2("socket", manager_base::handle().id));
+    if (num_spliced > 0) {
+      manager_base::register_writing();
+    }
+  }
+
   void remove_written_data_from_queue(std::size_t num_bytes) {
     if (num_bytes == 0) {
       return;
     }
     num_enqueued_bytes_ -= num_bytes;
     std::size_t num_empty_buffers = 0;
-    for (auto& buf : write_queue_) {
+    for (std::size_t i = 0; i < write_queue_.size(); ++i) {
+      auto& buf = write_queue_[i];
       // Remove the bytes from the buffer
       if (buf.size() <= num_bytes) {
         num_bytes -= buf.size();
         buf.clear();
       } else {
         buf.erase(buf.begin(), buf.begin() + num_bytes);
+        // Partially written buffers must not be written again in full
+        iovecs_[i] = iovec{buf.data(), buf.size()};
+        num_bytes = 0;
       }
 
       // Try to return the buffer to the cache for later use
@@ -170,19 +374,23 @@ private:
     write_queue_.erase(write_queue_.begin(),
                        write_queue_.begin() + num_empty_buffers);
     iovecs_.erase(iovecs_.begin(), iovecs_.begin() + num_empty_buffers);
+    if (write_blocked_
+        && (num_enqueued_bytes_ <= transport_base::write_low_watermark_)) {
+      set_write_blocked(false);
+    }
   }
 
 public:
   bool done_writing() const noexcept {
-    return (write_queue_.empty() && !next_layer_.has_more_data());
+    return (write_queue_.empty() && !next_layer_->has_more_data());
   }
 
   manager_result fetch_more_data() {
     size_t i = 0;
     while ((num_enqueued_bytes_ < transport_base::max_enqueued_bytes_)
            && (i < transport_base::max_consecutive_fetches_)) {
-      if (next_layer_.has_more_data()) {
-        next_layer_.produce(*this);
+      if (next_layer_->has_more_data()) {
+        next_layer_->produce(*this);
         ++i;
       } else {
         break;
@@ -206,17 +414,24 @@ public:
   std::span<iovec> iovecs() const noexcept { return iovecs_; }
 
 protected:
-  mutable NextLayer next_layer_; // The next protocol layer in the stack.
+  // The next protocol layer in the stack. Empty while the transport is pooled.
+  mutable std::optional<NextLayer> next_layer_;
 
   size_t received_{0};
   size_t written_{0};
   size_t min_read_size_{0};
+  size_t max_read_size_{0};
+  /// Whether the read buffer is only allocated for partial reads
+  bool lazy_read_buffer_{false};
 
   size_t num_enqueued_bytes_{0};
+  bool write_blocked_{false};
 
   util::byte_buffer read_buffer_;
   mutable std::vector<util::byte_buffer> write_queue_;
   mutable std::vector<iovec> iovecs_;
+
+  send_channel_ptr<util::byte_buffer> send_channel_;
 };
 
 template <class ManagerBase, class NextLayer>
@@ -242,6 +457,9 @@ public:
       if (verdict != manager_result::ok) {
         return verdict;
       }
+      if (manager_base::reading_paused()) {
+        break;
+      }
     }
     return manager_result::ok;
   }
@@ -275,6 +493,11 @@ using event_stream_transport = stream_transport<event_handler, NextLayer>;
 #if defined(LIB_NET_URING)
 
 /// @brief Specialization for uring_manager (io_uring).
+/// With `multiplexer.fixed-buffers` enabled, reads and writes borrow a fixed
+/// buffer of the multiplexer while in flight, falling back to the buffers of
+/// the transport if all fixed buffers are in use. Received bytes are passed to
+/// the next layer in place, and queued bytes are gathered into the fixed buffer
+/// before writing.
 template <class NextLayer>
 class stream_transport<uring_manager, NextLayer>
   : public stream_transport_base<uring_manager, NextLayer> {
@@ -283,23 +506,35 @@ class stream_transport<uring_manager, NextLayer>
 public:
   using base::base;
 
+  util::error init(const util::config& cfg) override {
+    provided_buffers_ = cfg.get_or("multiplexer.provided-buffers", false);
+    fixed_buffers_ = cfg.get_or("multiplexer.fixed-buffers", false);
+    base::lazy_read_buffer_ = provided_buffers_ || fixed_buffers_;
+    return base::init(cfg);
+  }
+
   manager_result enable(operation op) override {
     switch (op) {
       case operation::read: {
-        auto [success, submission_id]
-          = manager_base::mpx<uring_multiplexer>()->submit_read(
-            *this, base::read_buffer());
-        return success ? manager_result::ok : manager_result::error;
+        if (provided_buffers_) {
+          return enable_recv();
+        }
+        if (const auto verdict = consume_pending();
+            verdict != manager_result::ok) {
+          return verdict;
+        }
+        // The next layer may have stopped reading again
+        if (!manager_base::mask_contains(operation::read)) {
+          return manager_result::ok;
+        }
+        return submit_read();
       }
       case operation::write: {
         base::fetch_more_data();
         if (base::done_writing()) {
           return manager_result::done;
         }
-        auto [success, submission_id]
-          = manager_base::mpx<uring_multiplexer>()->submit_writev(
-            *this, base::iovecs());
-        return success ? manager_result::ok : manager_result::error;
+        return submit_write();
       }
 
       default:
@@ -316,6 +551,12 @@ public:
               NET_ARG2("handle", handle().id));
     switch (op) {
       case operation::read: {
+        if (provided_buffers_) {
+          return handle_recv(res);
+        }
+        if (read_index_) {
+          return handle_read_fixed(res);
+        }
         const auto verdict = base::handle_read_result(res);
         if (verdict == manager_result::temporary_error) {
           manager_base::mpx<uring_multiplexer>()->submit_poll_read(*this);
@@ -326,11 +567,19 @@ public:
       }
         [[fallthrough]];
       case operation::poll_read:
-        manager_base::mpx<uring_multiplexer>()->submit_read(
-          *this, base::read_buffer());
+        if (manager_base::reading_paused()) {
+          // Submitted again once reading is resumed
+          return manager_result::ok;
+        }
+        submit_read();
         return manager_result::ok;
 
       case operation::write: {
+        if (write_index_) {
+          manager_base::mpx<uring_multiplexer>()->release_fixed_buffer(
+            *write_index_);
+          write_index_.reset();
+        }
         const auto verdict = base::handle_write_result(res);
         if (verdict == manager_result::temporary_error) {
           manager_base::mpx<uring_multiplexer>()->submit_poll_write(*this);
@@ -345,8 +594,7 @@ public:
         if (base::done_writing()) {
           return manager_result::done;
         }
-        manager_base::mpx<uring_multiplexer>()->submit_writev(*this,
-                                                              base::iovecs());
+        submit_write();
         return manager_result::ok;
 
       default:
@@ -354,6 +602,198 @@ public:
         return manager_result::error;
     }
   }
+
+protected:
+  void handle_released() override {
+    recv_id_ = 0;
+    cancelling_recv_ = false;
+    read_index_.reset();
+    write_index_.reset();
+    pending_bytes_.clear();
+    base::handle_released();
+  }
+
+private:
+  /// @brief Consumes the bytes received while reading was paused.
+  manager_result consume_pending() {
+    if (pending_bytes_.empty()) {
+      return manager_result::ok;
+    }
+    util::const_byte_span data{pending_bytes_};
+    const auto verdict = base::consume_received(data);
+    pending_bytes_.erase(pending_bytes_.begin(),
+                         pending_bytes_.end() - data.size());
+    return verdict;
+  }
+
+  /// @brief Submits a read into a fixed buffer if one is available, and into
+  /// the read buffer of the transport otherwise.
+  manager_result submit_read() {
+    auto* mpx = manager_base::mpx<uring_multiplexer>();
+    if (fixed_buffers_) {
+      if (read_index_) {
+        // Submitted again once the pending read completes
+        return manager_result::ok;
+      }
+      if (const auto index = mpx->acquire_fixed_buffer()) {
+        auto [success, submission_id]
+          = mpx->submit_read_fixed(*this, mpx->fixed_buffer(*index), *index);
+        if (!success) {
+          mpx->release_fixed_buffer(*index);
+          return manager_result::error;
+        }
+        read_index_ = index;
+        return manager_result::ok;
+      }
+      if (base::read_buffer_.size() < base::max_read_size_) {
+        base::read_buffer_.resize(base::max_read_size_);
+      }
+    }
+    auto [success, submission_id] = mpx->submit_read(*this,
+                                                     base::read_buffer());
+    return success ? manager_result::ok : manager_result::error;
+  }
+
+  /// @brief Handles the completion of a read into a fixed buffer, which is
+  /// returned once the next layer consumed its bytes. Bytes received after
+  /// reading was paused are copied and consumed once it is resumed.
+  manager_result handle_read_fixed(int res) {
+    auto* mpx = manager_base::mpx<uring_multiplexer>();
+    const auto index = *read_index_;
+    read_index_.reset();
+    if (res > 0) {
+      const auto num_bytes = static_cast<std::size_t>(res);
+      util::const_byte_span data = mpx->fixed_buffer(index).first(num_bytes);
+      mpx->stats().add_bytes_read(num_bytes);
+      const auto verdict = base::consume_received(data);
+      pending_bytes_.insert(pending_bytes_.end(), data.begin(), data.end());
+      mpx->release_fixed_buffer(index);
+      if (verdict != manager_result::ok) {
+        return verdict;
+      }
+    } else {
+      mpx->release_fixed_buffer(index);
+      if (res == 0) {
+        // Observed again by the read submitted once reading is resumed
+        return manager_base::mask_contains(operation::read)
+                 ? manager_result::done
+                 : manager_result::ok;
+      } else if (res == -EAGAIN) {
+        mpx->submit_poll_read(*this);
+        return manager_result::ok;
+      } else if (res != -ECANCELED) {
+        return manager_result::error;
+      }
+    }
+    if (!manager_base::mask_contains(operation::read)
+        || manager_base::reading_paused()) {
+      return manager_result::ok;
+    }
+    return submit_read();
+  }
+
+  /// @brief Gathers the queued bytes into a fixed buffer if one is available
+  /// and writes them, or writes the queued buffers otherwise.
+  manager_result submit_write() {
+    auto* mpx = manager_base::mpx<uring_multiplexer>();
+    if (fixed_buffers_) {
+      if (write_index_) {
+        // Submitted again once the pending write completes
+        return manager_result::ok;
+      }
+      if (const auto index = mpx->acquire_fixed_buffer()) {
+        const auto buf = mpx->fixed_buffer(*index);
+        std::size_t size = 0;
+        for (const auto& vec : base::iovecs()) {
+          const auto num_bytes = std::min(vec.iov_len, buf.size() - size);
+          std::memcpy(buf.data() + size, vec.iov_base, num_bytes);
+          size += num_bytes;
+          if (size == buf.size()) {
+            break;
+          }
+        }
+        auto [success, submission_id]
+          = mpx->submit_write_fixed(*this, buf.first(size), *index);
+        if (!success) {
+          mpx->release_fixed_buffer(*index);
+          return manager_result::error;
+        }
+        write_index_ = index;
+        return manager_result::ok;
+      }
+    }
+    auto [success, submission_id] = mpx->submit_writev(*this, base::iovecs());
+    return success ? manager_result::ok : manager_result::error;
+  }
+
+  /// @brief Consumes the bytes received while reading was paused and arms the
+  /// multishot receive, unless it is still armed.
+  manager_result enable_recv() {
+    if (const auto verdict = consume_pending();
+        verdict != manager_result::ok) {
+      return verdict;
+    }
+    if ((recv_id_ == 0) && manager_base::mask_contains(operation::read)) {
+      auto [success, submission_id]
+        = manager_base::mpx<uring_multiplexer>()->submit_recv_multishot(*this);
+      if (!success) {
+        return manager_result::error;
+      }
+      recv_id_ = submission_id;
+    }
+    return manager_result::ok;
+  }
+
+  /// @brief Handles a completion of the multishot receive. The provided
+  /// buffer is returned to the ring once the next layer consumed its bytes.
+  /// Bytes received after reading was paused are copied and consumed once it
+  /// is resumed, and the receive is cancelled until then.
+  manager_result handle_recv(int res) {
+    auto* mpx = manager_base::mpx<uring_multiplexer>();
+    const auto flags = mpx->completion_flags();
+    if ((flags & IORING_CQE_F_MORE) == 0) {
+      recv_id_ = 0;
+      cancelling_recv_ = false;
+    }
+    if (res > 0) {
+      const auto num_bytes = static_cast<std::size_t>(res);
+      const auto bid = static_cast<std::uint16_t>(flags
+                                                  >> IORING_CQE_BUFFER_SHIFT);
+      util::const_byte_span data = mpx->provided_buffer(bid, num_bytes);
+      mpx->stats().add_bytes_read(num_bytes);
+      const auto verdict = base::consume_received(data);
+      pending_bytes_.insert(pending_bytes_.end(), data.begin(), data.end());
+      mpx->return_provided_buffer(bid);
+      if (verdict != manager_result::ok) {
+        return verdict;
+      }
+    } else if (res == 0) {
+      // Observed again by the receive armed once reading is resumed
+      return manager_base::mask_contains(operation::read)
+               ? manager_result::done
+               : manager_result::ok;
+    } else if ((res != -ENOBUFS) && (res != -ECANCELED)) {
+      return manager_result::error;
+    }
+    if (!manager_base::mask_contains(operation::read)) {
+      if ((recv_id_ != 0) && !cancelling_recv_) {
+        cancelling_recv_ = mpx->submit_cancel(recv_id_);
+      }
+      return manager_result::ok;
+    }
+    // Rearmed after running out of buffers or being cancelled
+    return enable_recv();
+  }
+
+  bool provided_buffers_{false}; ///< Whether to receive into the buffer ring
+  bool fixed_buffers_{false};    ///< Whether to borrow fixed buffers
+
+  std::uint64_t recv_id_{0};        ///< ID of the armed multishot receive
+  bool cancelling_recv_{false};     ///< Whether the receive is cancelled
+  util::byte_buffer pending_bytes_; ///< Received while reading was paused
+
+  std::optional<std::uint16_t> read_index_;  ///< Fixed buffer of the read
+  std::optional<std::uint16_t> write_index_; ///< Fixed buffer of the write
 };
 
 template <class NextLayer>
@@ -0,0 +1,256 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      timer_wheel.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/timeout_entry.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace net::detail {
+
+/// @brief Hashed hierarchical timer wheel for scheduling timeouts.
+/// Time is divided into ticks of a fixed resolution. The wheel consists of
+/// `num_levels` levels with `num_slots` slots each, where a slot on level `n`
+/// spans `num_slots^n` ticks. Timers are hashed into the slot of the lowest
+/// level covering their deadline, and cascade down to lower levels as time
+/// advances. Inserting and expiring a timer is O(1), finding the next
+/// deadline only inspects a bitmap of occupied slots per level.
+/// Timer nodes are taken from a pool, so scheduling does not allocate once
+/// the pool has grown to the number of concurrently scheduled timers.
+class timer_wheel {
+public:
+  class timer_list;
+
+  /// @brief The clock used for all time points.
+  using clock_type = std::chrono::steady_clock;
+
+  /// @brief Time point type of the wheel.
+  using time_point = clock_type::time_point;
+
+  /// @brief Duration type of the wheel.
+  using duration = clock_type::duration;
+
+  /// @brief Number of bits of the tick represented by one level.
+  static constexpr std::size_t slot_bits = 8;
+
+  /// @brief Number of slots per level.
+  static constexpr std::size_t num_slots = std::size_t{1} << slot_bits;
+
+  /// @brief Number of levels of the wheel.
+  static constexpr std::size_t num_levels = 4;
+
+  /// @brief Number of timer nodes allocated at once when the pool is empty.
+  static constexpr std::size_t chunk_size = 256;
+
+  /// @brief Lifecycle state of a timer node.
+  enum class node_state : std::uint8_t {
+    scheduled, ///< Linked into a slot of the wheel
+    expiring,  ///< Collected by expire(), but not yet handed out
+    cancelled, ///< Cancelled while expiring, released by expire()
+  };
+
+  /// @brief A scheduled timer, linked into the list of its slot and into the
+  /// timer list of its owner.
+  struct node {
+    timeout_entry entry;                     ///< The scheduled timeout
+    node* prev{nullptr};                     ///< Previous node in the slot
+    node* next{nullptr};                     ///< Next node in the slot or pool
+    node* owner_prev{nullptr};               ///< Previous node of the owner
+    node* owner_next{nullptr};               ///< Next node of the owner
+    timer_list* owner{nullptr};              ///< Timer list of the owner
+    std::uint8_t level{0};                   ///< Level the node is linked into
+    std::uint8_t slot{0};                    ///< Slot the node is linked into
+    node_state state{node_state::scheduled}; ///< Lifecycle state
+  };
+
+  /// @brief Intrusive list of all timers scheduled by a single owner.
+  /// Allows cancelling and rescheduling timers by ID in O(k) of the timers of
+  /// the owner, and releasing them all when the owner goes away. Must not be
+  /// destroyed while it contains timers.
+  class timer_list {
+    friend class timer_wheel;
+
+  public:
+    /// @brief Returns whether the list contains no timers.
+    bool empty() const noexcept { return head_ == nullptr; }
+
+  private:
+    node* head_{nullptr}; ///< First timer of the owner
+  };
+
+  // -- constructors, destructors ----------------------------------------------
+
+  /// @brief Constructs an empty timer wheel.
+  /// @param resolution The duration of a single tick.
+  /// @param origin The time point of the first tick.
+  explicit timer_wheel(duration resolution = std::chrono::milliseconds{1},
+                       time_point origin = clock_type::now());
+
+  /// @brief Copy construction is deleted.
+  timer_wheel(const timer_wheel& other) = delete;
+
+  /// @brief Copy assignment is deleted.
+  timer_wheel& operator=(const timer_wheel& other) = delete;
+
+  // -- scheduling -------------------------------------------------------------
+
+  /// @brief Schedules a new timer.
+  /// Deadlines in the past are expired by the next call to expire().
+  /// @param entry The timeout to schedule.
+  /// @param owner The timer list of the owner to track the timer in, if any.
+  void insert(const timeout_entry& entry, timer_list* owner = nullptr);
+
+  /// @brief Cancels a timer of an owner.
+  /// @param owner The timer list of the owner.
+  /// @param id The ID of the timer to cancel.
+  /// @return True if the timer was found, false if it already expired.
+  bool cancel(timer_list& owner, timeout_entry::timeout_id id) noexcept;
+
+  /// @brief Moves a timer of an owner to a new deadline.
+  /// Cheaper than cancelling and scheduling a new timer, the node is reused.
+  /// @param owner The timer list of the owner.
+  /// @param id The ID of the timer to reschedule.
+  /// @param when The new deadline of the timer.
+  /// @return True if the timer was found, false if it already expired.
+  bool reschedule(timer_list& owner, timeout_entry::timeout_id id,
+                  time_point when) noexcept;
+
+  /// @brief Cancels all timers of an owner in O(k) of its timers.
+  /// @param owner The timer list of the owner.
+  /// @return The number of cancelled timers.
+  std::size_t cancel_all(timer_list& owner) noexcept;
+
+  /// @brief Removes all timers of an owner and returns them, e.g. to schedule
+  /// them on another wheel.
+  /// @param owner The timer list of the owner.
+  /// @return The removed timeouts.
+  std::vector<timeout_entry> take_all(timer_list& owner);
+
+  /// @brief Expires all timers with a deadline at or before `now`.
+  /// The callback is invoked in order of the deadlines, ties are broken by
+  /// the timeout ID. Timers scheduled from within the callback are not
+  /// expired before the next call.
+  /// @param now The current time of the event loop.
+  /// @param on_expire Callback invoked with every expired timeout.
+  /// @return The number of collected timers.
+  template <class OnExpire>
+  std::size_t expire(time_point now, OnExpire&& on_expire) {
+    collect_expired(now);
+    const auto num_expired = expired_.size();
+    for (std::size_t i = 0; i < num_expired; ++i) {
+      auto* n = expired_[i];
+      // Previous callbacks may have cancelled or rescheduled the timer
+      if (n->state == node_state::cancelled) {
+        release(n);
+        continue;
+      } else if (n->state == node_state::scheduled) {
+        continue;
+      }
+      const auto entry = n->entry;
+      unlink_owner(n);
+      release(n);
+      on_expire(entry);
+    }
+    expired_.clear();
+    return num_expired;
+  }
+
+  /// @brief Removes all scheduled timers.
+  void clear() noexcept;
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns the next deadline of the wheel.
+  /// Exact for timers within the range of the lowest level. Further timers
+  /// report the time they are cascaded, which is never after their deadline.
+  /// @return The next deadline, or nullopt if no timers are scheduled.
+  std::optional<time_point> next_expiry() const noexcept;
+
+  /// @brief Returns the number of scheduled timers.
+  std::size_t size() const noexcept { return size_; }
+
+  /// @brief Returns whether no timers are scheduled.
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// @brief Returns the duration of a single tick.
+  duration resolution() const noexcept { return resolution_; }
+
+private:
+  /// @brief A single level of the wheel.
+  struct level {
+    /// @brief Bitmap type with one bit per slot.
+    using bitmap = std::array<std::uint64_t, num_slots / 64>;
+
+    std::array<node*, num_slots> slots{}; ///< Heads of the slot lists
+    bitmap occupied{};                    ///< Non-empty slots
+  };
+
+  /// @brief Position and tick of the next slot to be processed.
+  struct expiration {
+    std::size_t level;  ///< Level of the slot
+    std::size_t slot;   ///< Index of the slot
+    std::uint64_t tick; ///< Tick at which the slot is processed
+  };
+
+  /// @brief Advances the wheel to `now` and collects expired timers.
+  void collect_expired(time_point now);
+
+  /// @brief Returns the next occupied slot of the wheel, if any.
+  std::optional<expiration> next_expiration() const noexcept;
+
+  /// @brief Converts a time point to its tick, rounding down.
+  std::uint64_t to_tick(time_point when) const noexcept;
+
+  /// @brief Links a node into the slot matching its deadline.
+  void link(node* n) noexcept;
+
+  /// @brief Unlinks a node from its slot.
+  void unlink(node* n) noexcept;
+
+  /// @brief Unlinks all nodes of a slot and returns the head of the list.
+  node* take(std::size_t lvl, std::size_t slot) noexcept;
+
+  /// @brief Removes a node from the timer list of its owner, if any.
+  static void unlink_owner(node* n) noexcept;
+
+  /// @brief Finds the timer with the given ID in the list of an owner.
+  static node* find(const timer_list& owner,
+                    timeout_entry::timeout_id id) noexcept;
+
+  /// @brief Cancels a timer, deferring its release while it is expiring.
+  void erase(node* n) noexcept;
+
+  /// @brief Takes a node from the pool, growing it if necessary.
+  node* acquire();
+
+  /// @brief Returns a node to the pool.
+  void release(node* n) noexcept;
+
+  duration resolution_;                    ///< Duration of a single tick
+  time_point origin_;                      ///< Time point of tick zero
+  std::uint64_t elapsed_{0};               ///< Tick the wheel advanced to
+  std::size_t size_{0};                    ///< Number of scheduled timers
+  std::array<level, num_levels> levels_{}; ///< The levels of the wheel
+
+  // node pool
+  std::vector<std::unique_ptr<node[]>> chunks_; ///< Allocated nodes
+  node* free_list_{nullptr};                    ///< Unused nodes
+
+  // scratch space reused by expire()
+  std::vector<node*> expired_; ///< Timers to be expired
+  std::vector<node*> pending_; ///< Timers to be linked after advancing
+};
+
+} // namespace net::detail
@@ -43,6 +43,20 @@ public:
                                      std::int64_t{10'000});
     max_cached_write_buffers_ = cfg.get_or("transport.max-cached-write-buffers",
                                            std::int64_t{10});
+    send_queue_capacity_ = cfg.get_or("transport.send-queue-capacity",
+                                      std::int64_t{256});
+    write_high_watermark_ = cfg.get_or("transport.write-high-watermark",
+                                       std::int64_t{65'536});
+    write_low_watermark_ = cfg.get_or("transport.write-low-watermark",
+                                      std::int64_t{16'384});
+    pause_reads_when_blocked_ = cfg.get_or("transport.pause-reads-when-blocked",
+                                           false);
+    if ((write_high_watermark_ != 0)
+        && (write_low_watermark_ >= write_high_watermark_)) {
+      return util::error{util::error_code::invalid_argument,
+                         "transport.write-low-watermark must be below "
+                         "transport.write-high-watermark"};
+    }
     return util::none;
   }
 
@@ -76,6 +90,13 @@ protected:
   size_t max_consecutive_writes_ = 20;
   size_t max_enqueued_bytes_ = 16384;
   size_t max_cached_write_buffers_ = 10;
+  size_t send_queue_capacity_ = 256;
+  /// Queued bytes at which writing counts as blocked, 0 disables watermarks
+  size_t write_high_watermark_ = 65'536;
+  /// Queued bytes at which writing is unblocked again
+  size_t write_low_watermark_ = 16'384;
+  /// Whether reading is paused while writing is blocked
+  bool pause_reads_when_blocked_ = false;
 
   std::deque<util::byte_buffer> buffer_cache_;
 };
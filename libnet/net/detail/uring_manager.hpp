@@ -16,6 +16,8 @@
 
 #  include "net/detail/manager_base.hpp"
 
+#  include <cstddef>
+#  include <cstdint>
 #  include <utility>
 
 struct iovec;
@@ -28,6 +30,8 @@ namespace net::detail {
 /// completion processing. Manages separate read and write buffers with
 /// configurable receive policies.
 class uring_manager : public manager_base {
+  friend class uring_multiplexer;
+
 public:
   /// @brief Constructs a uring manager for the given socket.
   /// @param handle The socket to manage.
@@ -55,6 +59,12 @@ public:
   /// @brief Move assignment.
   uring_manager& operator=(uring_manager&& other) noexcept = default;
 
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns whether operations address the socket via the fixed file
+  /// table of the multiplexer instead of its descriptor.
+  bool uses_fixed_file() const noexcept { return fixed_file_; }
+
   // -- Event handling ---------------------------------------------------------
 
   virtual manager_result enable(operation op) = 0;
@@ -68,6 +78,13 @@ public:
   virtual manager_result
   handle_completion(operation op, int res, std::uint64_t id)
     = 0;
+
+private:
+  /// Submissions in flight, which hold a single reference to the manager
+  std::size_t num_pending_submissions_{0};
+  /// Whether the socket is registered in the fixed file table, at the index of
+  /// its descriptor
+  bool fixed_file_{false};
 };
 
 /// @brief Shared pointer type for uring managers.
@@ -17,10 +17,18 @@
 #  include "net/detail/multiplexer_base.hpp"
 #  include "net/detail/uring_manager.hpp"
 
+#  include "net/operation.hpp"
+
+#  include "util/byte_span.hpp"
+#  include "util/slot_table.hpp"
+
 #  include <array>
+#  include <cstddef>
 #  include <cstdint>
 #  include <functional>
+#  include <optional>
 #  include <span>
+#  include <utility>
 #  include <vector>
 
 #  include <liburing.h>
@@ -31,10 +39,68 @@ namespace net::detail {
 /// Implements the multiplexer interface for Linux systems using io_uring
 /// for scalable I/O submission and completion handling. Only available when
 /// LIB_NET_URING is defined during compilation.
+/// Submissions are tracked in a slot table sized to the completion queue, and
+/// their user data and ID is the key of their slot. Managers are kept alive by
+/// a single reference while any of their submissions are in flight, so that
+/// submitting and completing operations allocates nothing. The slot of a
+/// multishot submission is freed with its final completion. Operations still
+/// in flight when a manager is removed are cancelled.
+/// With `multiplexer.provided-buffers` enabled, the multiplexer registers a
+/// ring of `multiplexer.provided-buffer-count` buffers of
+/// `multiplexer.provided-buffer-size` bytes each (256 and 4096 by default),
+/// which multishot receives of all managers share.
+/// With `multiplexer.fixed-files` set to a table size, the multiplexer
+/// registers a sparse fixed file table and every added socket whose descriptor
+/// fits into it at the index of the descriptor. Operations of these sockets
+/// are submitted with IOSQE_FIXED_FILE, sparing the kernel the lookup and
+/// reference counting of the file on every operation. The slot is freed once
+/// the manager is removed.
+/// With `multiplexer.fixed-buffers` enabled, the multiplexer registers
+/// `multiplexer.fixed-buffer-count` buffers of `multiplexer.fixed-buffer-size`
+/// bytes each (32 and 64 KiB by default) with the ring. Transports borrow
+/// them for single reads and writes, which the kernel then performs without
+/// pinning the pages of the buffer for every operation. The registered memory
+/// counts against RLIMIT_MEMLOCK.
 class uring_multiplexer : public multiplexer_base {
   /// @brief Maximum queue depth for pending operations.
   static constexpr std::size_t max_uring_depth = 32;
 
+  /// @brief User data of submissions whose completions are ignored.
+  static constexpr std::uint64_t internal_submission_id = 0;
+
+  /// @brief Buffer group ID of the provided buffer ring.
+  static constexpr std::uint16_t provided_buffer_group = 0;
+
+  /// @brief Default number of provided buffers.
+  static constexpr std::size_t default_num_provided_buffers = 256;
+
+  /// @brief Default size of the provided buffers.
+  static constexpr std::size_t default_provided_buffer_size = 4096;
+
+  /// @brief Maximum number of provided buffers supported by the kernel.
+  static constexpr std::size_t max_provided_buffers = 32768;
+
+  /// @brief Maximum size of the fixed file table.
+  static constexpr std::size_t max_fixed_files = 1 << 20;
+
+  /// @brief Default number of fixed buffers.
+  static constexpr std::size_t default_num_fixed_buffers = 32;
+
+  /// @brief Default size of the fixed buffers.
+  static constexpr std::size_t default_fixed_buffer_size = 64 * 1024;
+
+  /// @brief Maximum number of fixed buffers supported by the kernel.
+  static constexpr std::size_t max_fixed_buffers = 16384;
+
+  /// @brief Maximum size of a fixed buffer supported by the kernel.
+  static constexpr std::size_t max_fixed_buffer_size = 1 << 30;
+
+  /// @brief A submitted operation that has not completed yet.
+  struct submission {
+    uring_manager* mgr{nullptr};   ///< The submitting manager
+    operation op{operation::none}; ///< The submitted operation
+  };
+
 public:
   /// @brief Factory function type for creating io_uring-specific managers.
   using manager_factory
@@ -57,8 +123,12 @@ public:
 
   // -- IO Operation Submission ------------------------------------------------
 
-  io_uring_sqe* prepare_submission(uring_manager_ptr mgr, operation op,
-                                   bool multishot = false);
+  /// @brief Returns a submission queue entry for an operation of `mgr`,
+  /// tracking it until its final completion.
+  /// @return The entry to prepare and the ID of the submission, or nullptr if
+  /// the queue is full.
+  std::pair<io_uring_sqe*, std::uint64_t>
+  prepare_submission(uring_manager& mgr, operation op);
 
   std::pair<bool, uint64_t> submit_accept(uring_manager& mgr,
                                           bool multishot = false);
@@ -88,6 +158,79 @@ public:
   std::pair<bool, uint64_t> submit_sendmsg(uring_manager& mgr,
                                            msghdr& write_msghdr);
 
+  /// @brief Submits a read into a fixed buffer.
+  /// @param mgr The reading manager.
+  /// @param read_buffer The bytes to read into, within the fixed buffer.
+  /// @param index The index of the fixed buffer.
+  std::pair<bool, uint64_t> submit_read_fixed(uring_manager& mgr,
+                                              util::byte_span read_buffer,
+                                              std::uint16_t index);
+
+  /// @brief Submits a write from a fixed buffer.
+  /// @param mgr The writing manager.
+  /// @param write_buffer The bytes to write, within the fixed buffer.
+  /// @param index The index of the fixed buffer.
+  std::pair<bool, uint64_t>
+  submit_write_fixed(uring_manager& mgr, util::const_byte_span write_buffer,
+                     std::uint16_t index);
+
+  /// @brief Submits a multishot receive into the provided buffers. Every
+  /// completion carries the ID of the buffer holding the received bytes in
+  /// its flags, see completion_flags(), which must be returned via
+  /// return_provided_buffer() once the bytes have been consumed.
+  /// @param mgr The receiving manager.
+  std::pair<bool, uint64_t> submit_recv_multishot(uring_manager& mgr);
+
+  /// @brief Cancels a submission, which then completes with -ECANCELED.
+  /// @param id The ID of the submission.
+  /// @return true if the cancellation was submitted, false otherwise.
+  bool submit_cancel(std::uint64_t id);
+
+  // -- Provided buffers -------------------------------------------------------
+
+  /// @brief Returns whether a provided buffer ring has been registered.
+  bool uses_provided_buffers() const noexcept { return buf_ring_ != nullptr; }
+
+  /// @brief Returns the received bytes of a provided buffer.
+  /// @param bid The buffer ID of the completion.
+  /// @param size The number of received bytes.
+  util::byte_span provided_buffer(std::uint16_t bid, std::size_t size) noexcept;
+
+  /// @brief Hands a provided buffer back to the kernel.
+  /// @param bid The buffer ID of the completion.
+  void return_provided_buffer(std::uint16_t bid) noexcept;
+
+  /// @brief Returns the flags of the completion that is currently handled.
+  std::uint32_t completion_flags() const noexcept { return completion_flags_; }
+
+  // -- Fixed files ------------------------------------------------------------
+
+  /// @brief Returns whether a fixed file table has been registered.
+  bool uses_fixed_files() const noexcept { return num_fixed_files_ != 0; }
+
+  // -- Fixed buffers ----------------------------------------------------------
+
+  /// @brief Returns whether fixed buffers have been registered.
+  bool uses_fixed_buffers() const noexcept { return num_fixed_buffers_ != 0; }
+
+  /// @brief Borrows a fixed buffer, which must be returned via
+  /// release_fixed_buffer() once the operation using it has completed.
+  /// @return The index of the buffer, or nothing if all buffers are in use.
+  std::optional<std::uint16_t> acquire_fixed_buffer() noexcept;
+
+  /// @brief Returns the memory of a fixed buffer.
+  /// @param index The index of the buffer.
+  util::byte_span fixed_buffer(std::uint16_t index) noexcept;
+
+  /// @brief Returns a borrowed fixed buffer.
+  /// @param index The index of the buffer.
+  void release_fixed_buffer(std::uint16_t index) noexcept;
+
+  /// @brief Returns the number of fixed buffers that are not borrowed.
+  std::size_t num_free_fixed_buffers() const noexcept {
+    return free_fixed_buffers_.size();
+  }
+
   // -- Interface functions ----------------------------------------------------
 
   /// @brief Registers a socket manager for io_uring event monitoring.
@@ -96,6 +239,40 @@ public:
   void add(manager_base_ptr mgr, operation initial) override;
 
 private:
+  /// @brief Registers the provided buffer ring if configured.
+  /// @param cfg Configuration parameters for the multiplexer.
+  /// @return An error on failure, none on success.
+  util::error init_provided_buffers(const util::config& cfg);
+
+  /// @brief Registers the sparse fixed file table if configured.
+  /// @param cfg Configuration parameters for the multiplexer.
+  /// @return An error on failure, none on success.
+  util::error init_fixed_files(const util::config& cfg);
+
+  /// @brief Registers the socket of `mgr` in the fixed file table, if its
+  /// descriptor fits into the table.
+  void register_file(uring_manager& mgr);
+
+  /// @brief Frees the fixed file slot of `mgr`, whose further operations use
+  /// its descriptor again.
+  void unregister_file(uring_manager& mgr);
+
+  /// @brief Addresses the socket of `mgr` via its fixed file slot, if any.
+  /// Called once the entry has been prepared.
+  static void use_fixed_file(io_uring_sqe* sqe, const uring_manager& mgr);
+
+  /// @brief Registers the fixed buffers if configured.
+  /// @param cfg Configuration parameters for the multiplexer.
+  /// @return An error on failure, none on success.
+  util::error init_fixed_buffers(const util::config& cfg);
+
+  /// @brief Cancels the operations in flight of a manager that is removed.
+  void cancel_submissions(uring_manager& mgr);
+
+  /// @brief Removes a manager from the registry by socket handle.
+  /// @param handle The socket to remove.
+  void del(net::socket handle) override;
+
   /// @brief Removes a manager from the registry using an iterator.
   /// @param it Iterator to the manager.
   /// @return Iterator to the element following the erased element.
@@ -121,12 +298,34 @@ public:
 
 private:
   /// @brief Dispatches all completion queue entries to their handlers.
-  void handle_events();
+  /// @return The number of processed completion queue entries.
+  std::size_t handle_events();
+
+  /// @brief Drops the reference of a completed submission to `mgr`.
+  static void release_submission(uring_manager& mgr);
 
   // Multiplexing variables
   struct io_uring uring_ {}; ///< The io_uring instance
 
-  std::uint64_t current_submission_id_{0};
+  /// Submissions in flight, sized to the completion queue
+  util::slot_table<submission> submissions_{2 * max_uring_depth};
+  /// Flags of the completion that is currently handled
+  std::uint32_t completion_flags_{0};
+
+  // Provided buffers
+  io_uring_buf_ring* buf_ring_{nullptr};    ///< Registered buffer ring
+  std::vector<std::byte> provided_buffers_; ///< Memory of the buffers
+  unsigned num_provided_buffers_{0};        ///< Number of buffers
+  std::size_t provided_buffer_size_{0};     ///< Size of every buffer
+
+  /// Size of the fixed file table, 0 if none is registered
+  unsigned num_fixed_files_{0};
+
+  // Fixed buffers
+  std::vector<std::byte> fixed_buffers_;          ///< Memory of the buffers
+  std::vector<std::uint16_t> free_fixed_buffers_; ///< Buffers not borrowed
+  unsigned num_fixed_buffers_{0};                 ///< Number of buffers
+  std::size_t fixed_buffer_size_{0};              ///< Size of every buffer
 };
 
 /// @brief Shared pointer type for uring multiplexers.
@@ -25,6 +25,9 @@ namespace net {
 
 // -- classes ------------------------------------------------------------------
 
+/// @brief Forward declaration of the connection handle of coroutines.
+class connection;
+
 /// @brief Forward declaration of URI parser class.
 class uri;
 
@@ -36,6 +39,9 @@ struct application;
 /// @brief Forward declaration of datagram socket class.
 struct datagram_socket;
 
+/// @brief Forward declaration of event notification socket class.
+struct event_socket;
+
 /// @brief Forward declaration of protocol layer interface.
 struct layer;
 
@@ -79,11 +85,19 @@ using acceptor_pair = std::pair<tcp_accept_socket, std::uint16_t>;
 /// @brief Pair type for two datagram sockets (e.g., bidirectional pipe).
 using datagram_socket_pair = std::pair<datagram_socket, datagram_socket>;
 
+/// @brief Pair type for the read and write end of an event socket.
+using event_socket_pair = std::pair<event_socket, event_socket>;
+
 /// @brief Pair type for two IPC pipe sockets.
 using pipe_socket_pair = std::pair<pipe_socket, pipe_socket>;
 
 // -- template types ----------------------------------------------------------
 
+/// @brief Forward declaration of thread-safe connection send handle.
+/// @tparam Message The type of messages accepted by the connection.
+template <class Message>
+class send_handle;
+
 /// @brief Forward declaration of RAII socket guard template.
 /// @tparam Socket A type derived from socket.
 template <meta::derived_from<socket> Socket>
@@ -103,6 +117,9 @@ class manager_base;
 /// @brief Forward declaration of event multiplexer base class.
 class multiplexer_base;
 
+/// @brief Forward declaration of the pool of released managers.
+class manager_pool;
+
 /// @brief Forward declaration of pollset updater template.
 /// @tparam Base The base manager type.
 template <class Base>
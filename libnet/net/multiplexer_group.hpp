@@ -0,0 +1,342 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      multiplexer_group.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/fwd.hpp"
+#include "util/fwd.hpp"
+
+#include "net/multiplexer.hpp"
+#include "net/placement_policy.hpp"
+
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+#include "util/logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace net {
+
+/// @brief Runs several multiplexers, each on its own thread.
+/// The number of worker multiplexers is read from the config key
+/// `multiplexer.num-threads` and defaults to the hardware concurrency. How
+/// connections are distributed is selected by `multiplexer.placement`:
+/// - "reuse-port" (default): every worker owns a listening socket bound with
+///   SO_REUSEPORT to the same endpoint, letting the kernel spread incoming
+///   connections across all event loops.
+/// - "round-robin", "least-connections", "least-lag": an additional acceptor
+///   multiplexer accepts all connections on its own thread and hands them to
+///   a worker chosen by the respective policy.
+///
+/// With `multiplexer.cpu-affinity` or `multiplexer.numa-node` set, every
+/// worker is pinned to a single CPU of the configured set, assigned in
+/// order. A dedicated acceptor may run on all CPUs of the set.
+///
+/// Connections can be migrated between the workers to even out their load,
+/// see rebalance(). With `multiplexer.rebalance-interval-ms` set, the group
+/// rebalances periodically on a thread of its own.
+/// @tparam Multiplexer The multiplexer implementation to run.
+template <class Multiplexer = multiplexer>
+class multiplexer_group {
+public:
+  /// @brief The type of the contained multiplexers.
+  using multiplexer_type = Multiplexer;
+
+  /// @brief Shared pointer type for the contained multiplexers.
+  using multiplexer_ptr = std::shared_ptr<multiplexer_type>;
+
+  /// @brief Factory function type for creating managers.
+  using manager_factory = typename multiplexer_type::manager_factory;
+
+  // -- constructors, destructors ----------------------------------------------
+
+  /// @brief Default constructs an empty group.
+  multiplexer_group() = default;
+
+  /// @brief Destructs the group, shutting down and joining all multiplexers.
+  ~multiplexer_group() {
+    shutdown();
+    join();
+  }
+
+  /// @brief Copy construction is deleted.
+  /// The multiplexers refer to the config stored in the group.
+  multiplexer_group(const multiplexer_group& other) = delete;
+
+  /// @brief Move construction is deleted.
+  multiplexer_group(multiplexer_group&& other) noexcept = delete;
+
+  /// @brief Copy assignment is deleted.
+  multiplexer_group& operator=(const multiplexer_group& other) = delete;
+
+  /// @brief Move assignment is deleted.
+  multiplexer_group& operator=(multiplexer_group&& other) noexcept = delete;
+
+  /// @brief Initializes all multiplexers of the group.
+  /// With SO_REUSEPORT placement the first multiplexer binds the configured
+  /// port, all following multiplexers share the port that was actually bound
+  /// by the first one.
+  /// @param factory Factory function for creating managers for accepted
+  /// connections. Shared by all multiplexers.
+  /// @param cfg Configuration parameters.
+  /// @return Error on failure, none on success.
+  util::error init(manager_factory factory, const util::config& cfg) {
+    LOG_TRACE();
+    if (!workers_.empty()) {
+      return util::error{util::error_code::runtime_error,
+                         "multiplexer_group was already initialized"};
+    }
+    auto policy_res = parse_placement_policy(
+      cfg.get_or("multiplexer.placement", std::string{"reuse-port"}));
+    if (auto err = util::get_error(policy_res)) {
+      return *err;
+    }
+    policy_ = std::get<placement_policy>(policy_res);
+    const std::int64_t default_num_threads
+      = std::max(1u, std::thread::hardware_concurrency());
+    const auto num_threads = cfg.get_or("multiplexer.num-threads",
+                                        default_num_threads);
+    if (num_threads <= 0) {
+      return util::error{util::error_code::invalid_argument,
+                         "multiplexer.num-threads must be positive"};
+    }
+    rebalance_threshold_ = cfg.get_or<std::int64_t>(
+      "multiplexer.rebalance-threshold", default_rebalance_threshold);
+    const auto interval_ms = cfg.get_or<std::int64_t>(
+      "multiplexer.rebalance-interval-ms", 0);
+    if ((rebalance_threshold_ < 0) || (interval_ms < 0)) {
+      return util::error{util::error_code::invalid_argument,
+                         "multiplexer.rebalance-* must not be negative"};
+    }
+    rebalance_interval_ = std::chrono::milliseconds{interval_ms};
+    LOG_DEBUG("initializing multiplexer_group with ", NET_ARG(num_threads),
+              ", ", NET_ARG2("policy", to_string(policy_)));
+    cfg_ = cfg;
+    if (policy_ == placement_policy::reuse_port) {
+      cfg_.set_config_entry("multiplexer.reuse-port", true);
+    } else {
+      // Workers only receive connections from the acceptor
+      acceptor_cfg_ = cfg;
+      cfg_.set_config_entry("multiplexer.listen", false);
+      cfg_.set_config_entry("multiplexer.track-loop-lag",
+                            policy_ == placement_policy::least_lag);
+    }
+    workers_.reserve(static_cast<std::size_t>(num_threads));
+    for (std::int64_t i = 0; i < num_threads; ++i) {
+      auto mpx = std::make_shared<multiplexer_type>();
+      if (auto err = mpx->init(factory, cfg_)) {
+        workers_.clear();
+        return err;
+      }
+      if (const auto& cpus = mpx->cpu_affinity(); !cpus.empty()) {
+        mpx->set_cpu_affinity({cpus[static_cast<std::size_t>(i)
+                                    % cpus.size()]});
+      }
+      if (workers_.empty() && (policy_ == placement_policy::reuse_port)) {
+        // All following multiplexers have to bind the same port
+        cfg_.set_config_entry("multiplexer.port",
+                              static_cast<std::int64_t>(mpx->port()));
+      }
+      workers_.emplace_back(std::move(mpx));
+    }
+    if (policy_ != placement_policy::reuse_port) {
+      acceptor_ = std::make_shared<multiplexer_type>();
+      auto place = [this, factory = std::move(factory)](
+                     net::socket handle, auto*) {
+        return factory(handle, std::addressof(select_worker()));
+      };
+      if (auto err = acceptor_->init(std::move(place), acceptor_cfg_)) {
+        acceptor_.reset();
+        workers_.clear();
+        return err;
+      }
+    }
+    return util::none;
+  }
+
+  // -- Thread functions -------------------------------------------------------
+
+  /// @brief Starts the event loops of all multiplexers.
+  void start() {
+    LOG_TRACE();
+    for (auto& mpx : workers_) {
+      mpx->start();
+    }
+    if (acceptor_) {
+      acceptor_->start();
+    }
+    if (rebalance_interval_.count() > 0) {
+      rebalancer_ = std::jthread{[this](std::stop_token stop) {
+        std::mutex mtx;
+        std::condition_variable_any cv;
+        std::unique_lock lock{mtx};
+        // Returns the result of the predicate once stop is requested
+        while (!cv.wait_for(lock, stop, rebalance_interval_,
+                            [&stop] { return stop.stop_requested(); })) {
+          rebalance();
+        }
+      }};
+    }
+  }
+
+  /// @brief Initiates the shutdown of all multiplexers.
+  /// A dedicated acceptor is shut down and joined before the workers. Must not
+  /// be called from a multiplexer thread of this group. Subsequent calls have
+  /// no effect.
+  void shutdown() {
+    LOG_TRACE();
+    if (std::exchange(shutting_down_, true)) {
+      return;
+    }
+    // Migrations must not target workers that are already shut down
+    if (rebalancer_.joinable()) {
+      rebalancer_.request_stop();
+      rebalancer_.join();
+    }
+    // Stop accepting first, so no connections are handed to stopped workers
+    if (acceptor_ && acceptor_->is_running()) {
+      acceptor_->shutdown();
+      acceptor_->join();
+    }
+    for (auto& mpx : workers_) {
+      if (mpx->is_running()) {
+        mpx->shutdown();
+      }
+    }
+  }
+
+  /// @brief Blocks until all multiplexer threads have completed.
+  void join() {
+    LOG_TRACE();
+    if (acceptor_) {
+      acceptor_->join();
+    }
+    for (auto& mpx : workers_) {
+      mpx->join();
+    }
+  }
+
+  // -- members ----------------------------------------------------------------
+
+  /// @brief Returns the number of active socket managers of all multiplexers.
+  /// @return The aggregated count of managed sockets.
+  std::size_t num_socket_managers() const noexcept {
+    std::size_t num = acceptor_ ? acceptor_->num_socket_managers() : 0;
+    for (const auto& mpx : workers_) {
+      num += mpx->num_socket_managers();
+    }
+    return num;
+  }
+
+  /// @brief Returns the port on which the group accepts connections.
+  /// @return The listening port number, or 0 if not initialized.
+  std::uint16_t port() const noexcept {
+    if (acceptor_) {
+      return acceptor_->port();
+    }
+    return workers_.empty() ? 0 : workers_.front()->port();
+  }
+
+  /// @brief Returns the number of worker multiplexers in this group.
+  std::size_t size() const noexcept { return workers_.size(); }
+
+  /// @brief Returns the worker multiplexer at the given index.
+  /// @param index The index of the multiplexer.
+  /// @return Reference to the multiplexer.
+  multiplexer_type& at(std::size_t index) { return *workers_.at(index); }
+
+  /// @brief Returns the dedicated acceptor multiplexer.
+  /// @return Pointer to the acceptor, or nullptr with SO_REUSEPORT placement.
+  multiplexer_type* acceptor() noexcept { return acceptor_.get(); }
+
+  /// @brief Moves connections from the most to the least loaded worker.
+  /// The load of a worker is its number of managers, including those that
+  /// are being handed to it. If the loads differ by more than
+  /// `multiplexer.rebalance-threshold`, half of the difference is migrated.
+  /// With `multiplexer.profile-handlers` enabled, the connections spending
+  /// the most time in their handlers are moved first. Safe to call from any
+  /// thread, the migrations are performed asynchronously.
+  /// @return The number of connections requested to migrate.
+  std::size_t rebalance() {
+    if (workers_.size() < 2) {
+      return 0;
+    }
+    const auto [least, most] = std::minmax_element(
+      workers_.begin(), workers_.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs->load() < rhs->load();
+      });
+    const auto diff = (*most)->load() - (*least)->load();
+    if (diff <= static_cast<std::size_t>(rebalance_threshold_)) {
+      return 0;
+    }
+    const auto num = diff / 2;
+    LOG_DEBUG("rebalancing ", NET_ARG(num), " connections");
+    return (*most)->migrate_managers(**least, num) ? num : 0;
+  }
+
+  /// @brief Returns the policy used for distributing connections.
+  placement_policy policy() const noexcept { return policy_; }
+
+  /// @brief Returns the config the workers were initialized with.
+  const util::config& cfg() const noexcept { return cfg_; }
+
+private:
+  /// @brief Selects the worker for the next accepted connection.
+  /// Only called from the thread of the acceptor multiplexer.
+  /// @return Reference to the chosen worker.
+  multiplexer_type& select_worker() noexcept {
+    switch (policy_) {
+      case placement_policy::least_connections:
+        return **std::min_element(workers_.begin(), workers_.end(),
+                                  [](const auto& lhs, const auto& rhs) {
+                                    return lhs->load() < rhs->load();
+                                  });
+      case placement_policy::least_lag:
+        // Ties are common while idle, break them by the number of managers
+        return **std::min_element(workers_.begin(), workers_.end(),
+                                  [](const auto& lhs, const auto& rhs) {
+                                    return std::pair{lhs->loop_lag(),
+                                                     lhs->load()}
+                                           < std::pair{rhs->loop_lag(),
+                                                       rhs->load()};
+                                  });
+      case placement_policy::round_robin:
+      default:
+        return *workers_[next_worker_++ % workers_.size()];
+    }
+  }
+
+  /// @brief Default difference in load tolerated by rebalance().
+  static constexpr std::int64_t default_rebalance_threshold = 2;
+
+  util::config cfg_;                     ///< Config shared by all workers
+  util::config acceptor_cfg_;            ///< Config of the acceptor
+  placement_policy policy_{};            ///< Connection placement policy
+  std::vector<multiplexer_ptr> workers_; ///< The workers of this group
+  multiplexer_ptr acceptor_;             ///< Dedicated acceptor, if any
+  std::size_t next_worker_{0};           ///< Next worker for round-robin
+  bool shutting_down_{false};            ///< Whether shutdown was requested
+
+  // rebalancing
+  std::int64_t rebalance_threshold_{default_rebalance_threshold}; ///< Slack
+  std::chrono::milliseconds rebalance_interval_{0}; ///< 0 disables the thread
+  std::jthread rebalancer_; ///< Rebalances periodically, if enabled
+};
+
+} // namespace net
@@ -0,0 +1,50 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      placement_policy.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "util/fwd.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace net {
+
+/// @brief Strategies for distributing connections across the multiplexers of
+/// a multiplexer_group.
+enum class placement_policy : std::uint8_t {
+  /// Every multiplexer listens on its own SO_REUSEPORT socket and the kernel
+  /// distributes the connections by hashing.
+  reuse_port,
+  /// A dedicated acceptor hands connections to the workers in turn.
+  round_robin,
+  /// A dedicated acceptor hands connections to the worker with the fewest
+  /// active managers.
+  least_connections,
+  /// A dedicated acceptor hands connections to the worker with the lowest
+  /// recent event-loop lag.
+  least_lag,
+};
+
+/// @brief Parses a placement policy from its config representation, i.e.
+/// "reuse-port", "round-robin", "least-connections", or "least-lag".
+/// @param str The string to parse.
+/// @return The parsed policy or an error if the string is unknown.
+util::error_or<placement_policy> parse_placement_policy(std::string_view str);
+
+/// @brief Returns the config representation of a placement policy.
+/// @relates placement_policy
+std::string to_string(placement_policy policy);
+
+/// @brief Outputs the config representation of a placement policy.
+/// @relates placement_policy
+std::ostream& operator<<(std::ostream& os, placement_policy policy);
+
+} // namespace net
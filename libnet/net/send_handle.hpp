@@ -0,0 +1,66 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      send_handle.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/fwd.hpp"
+
+#include "net/detail/send_channel.hpp"
+
+#include "net/socket/socket.hpp"
+
+#include <utility>
+
+namespace net {
+
+/// @brief Thread-safe handle for sending messages over a connection.
+/// Obtained from a transport on the multiplexer thread and freely copyable
+/// to other threads afterwards. The handle only refers to the connection
+/// weakly: once the transport is destroyed, sending fails.
+/// @tparam Message The type of messages accepted by the transport.
+template <class Message>
+class send_handle {
+public:
+  /// @brief Default constructs an invalid handle.
+  send_handle() = default;
+
+  /// @brief Constructs a handle for the given channel.
+  /// @param channel The send channel of the transport.
+  explicit send_handle(detail::send_channel_ptr<Message> channel) noexcept
+    : channel_{std::move(channel)} {
+    // nop
+  }
+
+  /// @brief Hands a message over to the connection. Safe to call from any
+  /// thread. Messages of a single thread are sent in order.
+  /// @param msg The message to send, left untouched if the queue of the
+  /// connection is full or the connection is gone.
+  /// @return false if the message was not accepted or may not be delivered
+  /// because the multiplexer is shut down or busy, true otherwise.
+  bool send(Message&& msg) const {
+    return channel_ && channel_->push(std::move(msg));
+  }
+
+  /// @brief Returns whether the connection is gone.
+  bool expired() const noexcept { return !channel_ || channel_->closed(); }
+
+  /// @brief Returns the socket identifying the connection.
+  socket id() const noexcept {
+    return channel_ ? channel_->handle() : invalid_socket;
+  }
+
+  /// @brief Returns whether the handle refers to a connection.
+  explicit operator bool() const noexcept {
+    return static_cast<bool>(channel_);
+  }
+
+private:
+  detail::send_channel_ptr<Message> channel_; ///< Shared with the transport
+};
+
+} // namespace net
@@ -0,0 +1,43 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      event_socket.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/fwd.hpp"
+#include "util/fwd.hpp"
+
+#include "net/socket/socket.hpp"
+
+namespace net {
+
+/// @brief Notification endpoint for waking up an event loop from other
+/// threads. Backed by an eventfd on Linux and by a pipe on other systems.
+struct event_socket : socket {
+  using super = socket;
+
+  using super::super;
+};
+
+/// @brief Creates a pair of connected event sockets.
+/// The first socket is for waiting on notifications, the second for sending
+/// them. Both are nonblocking and have to be closed individually.
+/// @return Either an event_socket_pair or an error.
+[[nodiscard]] util::error_or<event_socket_pair> make_event_socket();
+
+/// @brief Makes the read end of the pair readable.
+/// @param x The write end of an event socket pair.
+/// @return true on success, false otherwise.
+bool notify(event_socket x);
+
+/// @brief Consumes all pending notifications from the read end of the pair.
+/// @param x The read end of an event socket pair.
+/// @return true on success, false if reading failed with a non-temporary
+/// error.
+bool drain(event_socket x);
+
+} // namespace net
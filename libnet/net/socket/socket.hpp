@@ -113,6 +113,11 @@ bool nonblocking(socket x, bool new_value);
 /// @return The port number if the socket is bound, or an error if not.
 util::error_or<uint16_t> port_of(socket x);
 
+/// @brief Returns the endpoint of the peer connected to the specified socket.
+/// @param x The socket to query.
+/// @return The remote endpoint, or an error if the socket is not connected.
+util::error_or<ip::v4_endpoint> peer_of(socket x);
+
 /// @brief Enables or disables the SO_REUSEADDR option on a socket.
 /// Allows reusing a port that is in TIME_WAIT state.
 /// @param x The socket to modify.
@@ -120,4 +125,12 @@ util::error_or<uint16_t> port_of(socket x);
 /// @return true if the operation succeeded, false otherwise.
 bool reuseaddr(socket x, bool new_value);
 
+/// @brief Enables or disables the SO_REUSEPORT option on a socket.
+/// Allows multiple sockets to bind the same address and port. Incoming
+/// connections are then distributed across all listening sockets by the kernel.
+/// @param x The socket to modify.
+/// @param new_value true to enable SO_REUSEPORT, false to disable.
+/// @return true if the operation succeeded, false otherwise.
+bool reuseport(socket x, bool new_value);
+
 } // namespace net
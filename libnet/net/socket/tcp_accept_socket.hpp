@@ -13,6 +13,7 @@
 
 #include "net/socket/socket.hpp"
 
+#include <chrono>
 #include <cstdint>
 
 namespace net {
@@ -43,12 +44,30 @@ util::error listen(tcp_accept_socket sock, int conn_backlog);
 /// @return A new tcp_stream_socket representing the accepted client connection.
 tcp_stream_socket accept(tcp_accept_socket sock);
 
+/// @brief Accepts an incoming TCP connection as a nonblocking socket.
+/// On Linux, the flags are set by accept4 directly instead of separate fcntl
+/// calls. The returned socket is closed on exec.
+/// @param sock The listening TCP accept socket.
+/// @return The accepted socket, or invalid_socket if none was pending.
+tcp_stream_socket accept_nonblocking(tcp_accept_socket sock);
+
+/// @brief Delays reporting connections until their first data arrived.
+/// Connections without data are reported once the timeout expired. Only
+/// supported on Linux (TCP_DEFER_ACCEPT).
+/// @param sock The listening TCP accept socket.
+/// @param timeout The time to wait for data, zero disables deferring.
+/// @return true on success, false otherwise.
+bool defer_accept(tcp_accept_socket sock, std::chrono::seconds timeout);
+
 /// @brief Creates and listens on a TCP socket bound to the specified endpoint.
 /// The socket is automatically set to listen mode with the specified backlog.
 /// @param ep The IPv4 endpoint (address and port) to bind and listen on.
 /// @param conn_backlog The maximum number of pending connections (default: 10).
+/// @param reuse_port Enables SO_REUSEPORT before binding, allowing multiple
+/// sockets to listen on the same endpoint (default: false).
 /// @return Either an acceptor_pair (socket and bound port) or an error.
 util::error_or<acceptor_pair>
-make_tcp_accept_socket(const ip::v4_endpoint& ep, const int conn_backlog = 10);
+make_tcp_accept_socket(const ip::v4_endpoint& ep, const int conn_backlog = 10,
+                       const bool reuse_port = false);
 
 } // namespace net
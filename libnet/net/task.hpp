@@ -0,0 +1,215 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      task.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "net/detail/frame_allocator.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace net {
+
+template <class T = void>
+class task;
+
+namespace detail {
+
+/// @brief State shared by the promises of all task types.
+class task_promise_base {
+public:
+  /// Tasks are lazy and only start running once awaited.
+  std::suspend_always initial_suspend() const noexcept { return {}; }
+
+  /// Resumes the awaiting coroutine, if any, once the task completed.
+  struct final_awaiter {
+    bool await_ready() const noexcept { return false; }
+
+    template <class Promise>
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<Promise> hdl) noexcept {
+      if (auto continuation = hdl.promise().continuation_) {
+        return continuation;
+      }
+      return std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {
+      // nop
+    }
+  };
+
+  final_awaiter final_suspend() const noexcept { return {}; }
+
+  void unhandled_exception() noexcept {
+    exception_ = std::current_exception();
+  }
+
+  void set_continuation(std::coroutine_handle<> continuation) noexcept {
+    continuation_ = continuation;
+  }
+
+  std::exception_ptr exception() const noexcept { return exception_; }
+
+  void rethrow_if_exception() const {
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+  // -- frame allocation -------------------------------------------------------
+
+  static void* operator new(std::size_t size) {
+    return frame_allocator::local().allocate(size);
+  }
+
+  static void operator delete(void* ptr, std::size_t size) noexcept {
+    frame_allocator::local().deallocate(ptr, size);
+  }
+
+private:
+  std::coroutine_handle<> continuation_;
+  std::exception_ptr exception_;
+};
+
+template <class T>
+class task_promise : public task_promise_base {
+public:
+  task<T> get_return_object() noexcept;
+
+  template <class U>
+  void return_value(U&& value) {
+    value_.emplace(std::forward<U>(value));
+  }
+
+  T result() {
+    rethrow_if_exception();
+    return std::move(*value_);
+  }
+
+private:
+  std::optional<T> value_;
+};
+
+template <>
+class task_promise<void> : public task_promise_base {
+public:
+  task<void> get_return_object() noexcept;
+
+  void return_void() const noexcept {
+    // nop
+  }
+
+  void result() const { rethrow_if_exception(); }
+};
+
+} // namespace detail
+
+/// @brief Lazily started coroutine that produces a value of type T.
+/// Awaiting a task starts it and resumes the awaiting coroutine once it
+/// returned, via symmetric transfer and thus without growing the stack.
+/// Frames are allocated from the frame allocator of the calling thread.
+/// Exceptions thrown by the task are rethrown when awaiting it.
+/// @tparam T The type of the produced value.
+template <class T>
+class [[nodiscard]] task {
+public:
+  using promise_type = detail::task_promise<T>;
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  task() noexcept = default;
+
+  explicit task(handle_type hdl) noexcept : hdl_{hdl} {
+    // nop
+  }
+
+  task(task&& other) noexcept : hdl_{std::exchange(other.hdl_, nullptr)} {
+    // nop
+  }
+
+  task& operator=(task&& other) noexcept {
+    if (this != &other) {
+      destroy();
+      hdl_ = std::exchange(other.hdl_, nullptr);
+    }
+    return *this;
+  }
+
+  task(const task&) = delete;
+  task& operator=(const task&) = delete;
+
+  ~task() { destroy(); }
+
+  // -- awaiting ---------------------------------------------------------------
+
+  struct awaiter {
+    handle_type hdl;
+
+    bool await_ready() const noexcept { return !hdl || hdl.done(); }
+
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<> continuation) noexcept {
+      hdl.promise().set_continuation(continuation);
+      return hdl;
+    }
+
+    T await_resume() { return hdl.promise().result(); }
+  };
+
+  awaiter operator co_await() && noexcept { return awaiter{hdl_}; }
+
+  // -- top-level tasks --------------------------------------------------------
+
+  /// @brief Runs a task that is not awaited by another coroutine until its
+  /// first suspension.
+  void start() {
+    if (hdl_ && !hdl_.done()) {
+      hdl_.resume();
+    }
+  }
+
+  /// @brief Returns whether the task holds a coroutine.
+  bool valid() const noexcept { return static_cast<bool>(hdl_); }
+
+  /// @brief Returns whether the task ran to completion.
+  bool done() const noexcept { return hdl_ && hdl_.done(); }
+
+  /// @brief Returns the exception the task exited with, if any.
+  std::exception_ptr exception() const noexcept {
+    return hdl_ ? hdl_.promise().exception() : nullptr;
+  }
+
+private:
+  void destroy() noexcept {
+    if (hdl_) {
+      hdl_.destroy();
+      hdl_ = nullptr;
+    }
+  }
+
+  handle_type hdl_;
+};
+
+namespace detail {
+
+template <class T>
+task<T> task_promise<T>::get_return_object() noexcept {
+  return task<T>{std::coroutine_handle<task_promise<T>>::from_promise(*this)};
+}
+
+inline task<void> task_promise<void>::get_return_object() noexcept {
+  return task<void>{
+    std::coroutine_handle<task_promise<void>>::from_promise(*this)};
+}
+
+} // namespace detail
+
+} // namespace net
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "net/fwd.hpp"
+
 #include "net/socket/socket_id.hpp"
 
 #include <chrono>
@@ -22,13 +24,17 @@ struct timeout_entry {
   /// @brief Type alias for timeout identifiers.
   using timeout_id = uint64_t;
 
+  /// @brief Default constructs an invalid timeout entry.
+  timeout_entry() = default;
+
   /// @brief Constructs a timeout entry.
   /// @param handle The socket associated with this timeout.
   /// @param when The time point when the timeout expires.
   /// @param id The unique identifier for this timeout.
+  /// @param mgr The manager to trigger when the timeout expires.
   timeout_entry(socket_id handle, std::chrono::steady_clock::time_point when,
-                timeout_id id)
-    : handle_{handle}, when_{when}, id_{id} {
+                timeout_id id, detail::manager_base* mgr = nullptr)
+    : handle_{handle}, when_{when}, id_{id}, mgr_{mgr} {
     // nop
   }
 
@@ -46,11 +52,23 @@ struct timeout_entry {
   /// @return The unique ID for this timeout.
   timeout_id id() const noexcept { return id_; }
 
+  /// @brief Returns the manager to trigger when this timeout expires.
+  /// @return Pointer to the manager, or nullptr if not set.
+  detail::manager_base* manager() const noexcept { return mgr_; }
+
   /// @brief Checks if this timeout has expired.
   /// Compares the expiration time against the current system time.
   /// @return True if the current time is past the expiration time.
   bool has_expired() const noexcept {
-    return when_ <= std::chrono::steady_clock::now();
+    return has_expired(std::chrono::steady_clock::now());
+  }
+
+  /// @brief Checks if this timeout has expired at the given time.
+  /// Allows checking many timeouts against a single clock reading.
+  /// @param now The time to compare the expiration time against.
+  /// @return True if `now` is past the expiration time.
+  bool has_expired(std::chrono::steady_clock::time_point now) const noexcept {
+    return when_ <= now;
   }
 
   // -- Comparison operations --------------------------------------------------
@@ -77,10 +95,10 @@ struct timeout_entry {
 private:
   // -- members ----------------------------------------------------------------
 
-  socket_id handle_; ///< The socket handle for this timeout.
-  // TODO: Add a pointer to the manager that should be triggered
-  std::chrono::steady_clock::time_point when_; ///< The expiration time point.
-  timeout_id id_; ///< The unique timeout identifier.
+  socket_id handle_{invalid_socket_id}; ///< The socket handle of the timeout.
+  std::chrono::steady_clock::time_point when_{}; ///< The expiration time point.
+  timeout_id id_{0}; ///< The unique timeout identifier.
+  detail::manager_base* mgr_{nullptr}; ///< The manager to trigger.
 };
 
 } // namespace net
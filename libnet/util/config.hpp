@@ -71,6 +71,15 @@ public:
     config_values_.emplace(std::move(key), std::move(entry));
   }
 
+  /// @brief Sets a single configuration entry, overwriting any existing value.
+  /// @tparam Entry The value type (must be bool, int64_t, double, or string).
+  /// @param key The configuration key.
+  /// @param entry The configuration value.
+  template <meta::one_of<bool, std::int64_t, double, std::string> Entry>
+  void set_config_entry(key_type key, Entry entry) {
+    config_values_.insert_or_assign(std::move(key), std::move(entry));
+  }
+
   /// @brief Checks if the configuration contains a specific typed entry.
   /// @tparam T The expected value type.
   /// @param key The configuration key.
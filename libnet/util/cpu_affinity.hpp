@@ -0,0 +1,51 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      cpu_affinity.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace util {
+
+/// @brief Sorted list of CPU indices without duplicates.
+using cpu_list = std::vector<std::size_t>;
+
+/// @brief Parses a list of CPUs in the format used by taskset and sysfs.
+/// Ranges and single CPUs are separated by commas, e.g. "0-3,8,10-11".
+/// @param str The list to parse.
+/// @return The parsed CPUs on success, an error otherwise.
+error_or<cpu_list> parse_cpu_list(std::string_view str);
+
+/// @brief Returns the CPUs the calling thread is allowed to run on.
+/// @return The allowed CPUs, empty if they cannot be determined.
+cpu_list allowed_cpus();
+
+/// @brief Returns the CPUs that belong to a NUMA node.
+/// @param node The index of the node.
+/// @return The CPUs of the node on success, an error if the node does not
+/// exist or NUMA information is not available on this platform.
+error_or<cpu_list> numa_node_cpus(std::size_t node);
+
+/// @brief Restricts the calling thread to the given CPUs.
+/// @param cpus The CPUs to run on, must not be empty.
+/// @return Error on failure, none on success.
+error pin_current_thread(const cpu_list& cpus);
+
+/// @brief Makes memory allocated by the calling thread prefer a NUMA node.
+/// Pages are placed on the node when they are first touched, falling back to
+/// other nodes once it runs out of memory.
+/// @param node The index of the node.
+/// @return Error on failure, none on success.
+error prefer_numa_node(std::size_t node);
+
+} // namespace util
@@ -0,0 +1,63 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      cycle_clock.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#endif
+
+namespace util {
+
+/// @brief Cheap timestamps for measuring short intervals.
+/// Reads the time stamp counter on x86 and the virtual counter on AArch64,
+/// which is considerably cheaper than querying the steady clock. Ticks are
+/// converted to durations using a rate calibrated once against the steady
+/// clock. Other architectures fall back to the steady clock.
+class cycle_clock {
+public:
+  /// @brief Returns the current value of the counter.
+  static std::uint64_t now() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    std::uint64_t value;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count());
+#endif
+  }
+
+  /// @brief Returns the number of ticks per nanosecond.
+  /// The first call calibrates the counter, which takes a few milliseconds.
+  static double ticks_per_ns() noexcept;
+
+  /// @brief Converts a number of ticks to a duration.
+  static std::chrono::nanoseconds to_duration(std::uint64_t ticks) noexcept {
+    return std::chrono::nanoseconds{
+      static_cast<std::int64_t>(static_cast<double>(ticks) / ticks_per_ns())};
+  }
+
+  /// @brief Converts a duration to a number of ticks.
+  static std::uint64_t to_ticks(std::chrono::nanoseconds duration) noexcept {
+    if (duration.count() <= 0) {
+      return 0;
+    }
+    return static_cast<std::uint64_t>(static_cast<double>(duration.count())
+                                      * ticks_per_ns());
+  }
+};
+
+} // namespace util
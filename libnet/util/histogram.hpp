@@ -0,0 +1,117 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      histogram.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace util {
+
+/// @brief Adds to a counter that is only written by a single thread. Cheaper
+/// than fetch_add, since no read-modify-write operation is needed. Readers on
+/// other threads see either the old or the new value.
+inline void increment(std::atomic<std::uint64_t>& counter,
+                      std::uint64_t value) noexcept {
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
+/// @brief Lock-free histogram with logarithmic buckets.
+/// Bucket `i` counts the values with a bit width of `i`, i.e. bucket 0 holds
+/// zero and bucket `i > 0` holds the values in [2^(i-1), 2^i). Recording is
+/// restricted to a single thread and does not use read-modify-write
+/// operations, while snapshots may be taken from any thread.
+class histogram {
+public:
+  /// @brief Number of buckets, one per possible bit width.
+  static constexpr std::size_t num_buckets = 65;
+
+  /// @brief A copy of the histogram at some point in time.
+  /// Taken field by field, so the fields may be off by the values recorded
+  /// while taking the snapshot.
+  struct snapshot {
+    std::array<std::uint64_t, num_buckets> buckets{}; ///< Values per bucket
+    std::uint64_t count{0};                           ///< Number of values
+    std::uint64_t sum{0};                             ///< Sum of all values
+    std::uint64_t max{0};                             ///< Largest value
+
+    /// @brief Returns the average of all recorded values.
+    double mean() const noexcept {
+      return (count == 0) ? 0.0
+                          : static_cast<double>(sum)
+                              / static_cast<double>(count);
+    }
+
+    /// @brief Returns an upper bound for the given quantile.
+    /// @param q The quantile in [0, 1].
+    /// @return The upper limit of the bucket containing the quantile.
+    std::uint64_t percentile(double q) const noexcept {
+      const auto rank = static_cast<std::uint64_t>(
+        std::clamp(q, 0.0, 1.0) * static_cast<double>(count));
+      std::uint64_t seen = 0;
+      for (std::size_t i = 0; i < num_buckets; ++i) {
+        seen += buckets[i];
+        if ((seen > rank) || (seen == count)) {
+          return std::min(upper_limit(i), max);
+        }
+      }
+      return max;
+    }
+  };
+
+  // -- recording --------------------------------------------------------------
+
+  /// @brief Returns the bucket a value is counted in.
+  static constexpr std::size_t bucket_for(std::uint64_t value) noexcept {
+    return static_cast<std::size_t>(std::bit_width(value));
+  }
+
+  /// @brief Returns the largest value counted in a bucket.
+  static constexpr std::uint64_t upper_limit(std::size_t bucket) noexcept {
+    return (bucket >= 64) ? std::numeric_limits<std::uint64_t>::max()
+                          : ((std::uint64_t{1} << bucket) - 1);
+  }
+
+  /// @brief Records a value. Must only be called by a single thread.
+  void record(std::uint64_t value) noexcept {
+    increment(buckets_[bucket_for(value)], 1);
+    increment(count_, 1);
+    increment(sum_, value);
+    if (value > max_.load(std::memory_order_relaxed)) {
+      max_.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns a snapshot of the histogram. Safe to call from any thread.
+  snapshot read() const noexcept {
+    snapshot result;
+    for (std::size_t i = 0; i < num_buckets; ++i) {
+      result.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    result.count = count_.load(std::memory_order_relaxed);
+    result.sum = sum_.load(std::memory_order_relaxed);
+    result.max = max_.load(std::memory_order_relaxed);
+    return result;
+  }
+
+private:
+  std::array<std::atomic<std::uint64_t>, num_buckets> buckets_{}; ///< Counts
+  std::atomic<std::uint64_t> count_{0}; ///< Number of values
+  std::atomic<std::uint64_t> sum_{0};   ///< Sum of all values
+  std::atomic<std::uint64_t> max_{0};   ///< Largest value
+};
+
+} // namespace util
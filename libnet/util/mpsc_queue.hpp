@@ -0,0 +1,149 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      mpsc_queue.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace util {
+
+/// @brief Bounded lock-free queue for multiple producers and a single
+/// consumer.
+/// Based on the bounded queue by Dmitry Vyukov: every cell carries a
+/// sequence number that tells producers whether the cell is free and the
+/// consumer whether it has been published. Producers only contend on a
+/// single compare-and-swap of the enqueue position, the consumer does not
+/// use any read-modify-write operations at all.
+/// @tparam T The element type, must be nothrow move constructible.
+template <class T>
+class mpsc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "mpsc_queue requires nothrow move constructible elements");
+
+  /// @brief Size of a cache line, used to keep the positions apart.
+  static constexpr std::size_t cache_line_size = 64;
+
+  /// @brief A single cell of the ring buffer.
+  struct cell {
+    std::atomic<std::size_t> sequence;       ///< Publication state
+    alignas(T) std::byte storage[sizeof(T)]; ///< Storage of the element
+
+    /// @brief Returns the element constructed in the storage.
+    T* value() noexcept {
+      return std::launder(reinterpret_cast<T*>(storage));
+    }
+  };
+
+public:
+  // -- constructors, destructors ----------------------------------------------
+
+  /// @brief Constructs an empty queue.
+  /// @param capacity The maximum number of elements, rounded up to the next
+  /// power of two.
+  explicit mpsc_queue(std::size_t capacity)
+    : capacity_{std::bit_ceil(std::max(capacity, std::size_t{2}))},
+      cells_{std::make_unique<cell[]>(capacity_)} {
+    for (std::size_t i = 0; i < capacity_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /// @brief Destroys all elements remaining in the queue.
+  ~mpsc_queue() {
+    for (;;) {
+      auto& c = cells_[dequeue_pos_ & (capacity_ - 1)];
+      if (c.sequence.load(std::memory_order_acquire) != (dequeue_pos_ + 1)) {
+        break;
+      }
+      c.value()->~T();
+      ++dequeue_pos_;
+    }
+  }
+
+  /// @brief Copy construction is deleted.
+  mpsc_queue(const mpsc_queue& other) = delete;
+
+  /// @brief Copy assignment is deleted.
+  mpsc_queue& operator=(const mpsc_queue& other) = delete;
+
+  // -- queue operations -------------------------------------------------------
+
+  /// @brief Appends an element to the queue. Safe to call from any thread.
+  /// @param value The element to append, only moved from on success.
+  /// @return false if the queue is full, true otherwise.
+  bool try_push(T&& value) noexcept {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    cell* c = nullptr;
+    for (;;) {
+      c = &cells_[pos & (capacity_ - 1)];
+      const auto seq = c->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq)
+                        - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        // The cell is free, try to claim it
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // The consumer has not yet released the cell of the previous lap
+        return false;
+      } else {
+        // Another producer claimed the cell
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    new (c->storage) T(std::move(value));
+    c->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// @brief Removes the first element from the queue. Must only be called by
+  /// the consumer.
+  /// Elements whose producer has claimed but not yet published their cell are
+  /// not visible, even if elements behind them have been published already.
+  /// @param value Assigned the removed element on success.
+  /// @return false if the queue is empty, true otherwise.
+  bool try_pop(T& value) noexcept {
+    auto& c = cells_[dequeue_pos_ & (capacity_ - 1)];
+    const auto seq = c.sequence.load(std::memory_order_acquire);
+    if (seq != (dequeue_pos_ + 1)) {
+      return false;
+    }
+    value = std::move(*c.value());
+    c.value()->~T();
+    c.sequence.store(dequeue_pos_ + capacity_, std::memory_order_release);
+    ++dequeue_pos_;
+    return true;
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns the maximum number of elements in the queue.
+  std::size_t capacity() const noexcept { return capacity_; }
+
+private:
+  const std::size_t capacity_;    ///< Number of cells, a power of two
+  std::unique_ptr<cell[]> cells_; ///< The ring buffer
+
+  // Both positions are kept on separate cache lines to avoid false sharing
+  /// Next position claimed by a producer
+  alignas(cache_line_size) std::atomic<std::size_t> enqueue_pos_{0};
+  /// Next position read by the consumer
+  alignas(cache_line_size) std::size_t dequeue_pos_{0};
+};
+
+} // namespace util
@@ -40,12 +40,12 @@ struct ref_counted {
   /// Call this when acquiring a reference to the object.
   void ref() noexcept { ref_count_.fetch_add(1, std::memory_order_relaxed); }
 
-  /// @brief Decrements the reference count and potentially deletes the object.
-  /// When the reference count drops to zero, the object is deleted via
-  /// its virtual destructor.
+  /// @brief Decrements the reference count and potentially disposes of the
+  /// object. When the reference count drops to zero, the object is released
+  /// via dispose().
   void deref() {
     if (ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-      delete this;
+      dispose();
     }
   }
 
@@ -53,6 +53,11 @@ struct ref_counted {
   /// @return The number of active references to this object.
   std::size_t ref_count() const noexcept { return ref_count_.load(); }
 
+protected:
+  /// @brief Releases the object once its last reference is gone. Deletes the
+  /// object by default, derived classes may recycle it instead.
+  virtual void dispose() noexcept { delete this; }
+
 private:
   /// @brief The atomic reference counter, initially 1.
   std::atomic_size_t ref_count_{1};
@@ -0,0 +1,130 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      slot_table.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace util {
+
+/// @brief Table of values addressed by 64-bit keys, e.g. the user data of
+/// io_uring submissions.
+/// A key combines the index of a slot with the generation of that slot, which
+/// is incremented whenever the slot is freed, so that stale keys are detected
+/// instead of addressing values inserted later. Freed slots are reused, so
+/// inserting and erasing allocate nothing once the table has grown to the
+/// number of values held at once.
+/// @tparam T The value type.
+template <class T>
+class slot_table {
+  /// @brief Marks the end of the free list.
+  static constexpr std::uint32_t no_slot
+    = std::numeric_limits<std::uint32_t>::max();
+
+  /// @brief A single slot of the table.
+  struct slot {
+    T value{};                        ///< The stored value
+    std::uint32_t generation{1};      ///< Incremented on every erase
+    std::uint32_t next_free{no_slot}; ///< Next free slot if unused
+    bool used{false};                 ///< Whether the slot holds a value
+  };
+
+public:
+  /// @brief Constructs an empty table.
+  /// @param capacity The number of preallocated slots.
+  explicit slot_table(std::size_t capacity) { grow(capacity); }
+
+  /// @brief Stores `value` in a free slot, adding a slot if none is free.
+  /// @return The key of the value.
+  std::uint64_t insert(T value) {
+    if (free_ == no_slot) {
+      grow(std::max(slots_.size(), std::size_t{1}));
+    }
+    const auto index = free_;
+    auto& s = slots_[index];
+    free_ = s.next_free;
+    s.value = std::move(value);
+    s.used = true;
+    ++size_;
+    return (static_cast<std::uint64_t>(s.generation) << 32) | index;
+  }
+
+  /// @brief Returns the value stored under `key`.
+  /// @return A pointer to the value, or nullptr if the key is stale.
+  T* find(std::uint64_t key) noexcept {
+    const auto index = static_cast<std::uint32_t>(key);
+    if (index >= slots_.size()) {
+      return nullptr;
+    }
+    auto& s = slots_[index];
+    if (!s.used || (s.generation != static_cast<std::uint32_t>(key >> 32))) {
+      return nullptr;
+    }
+    return &s.value;
+  }
+
+  /// @brief Frees the slot of `key`, invalidating the key.
+  /// @return true if the key was valid, false otherwise.
+  bool erase(std::uint64_t key) noexcept {
+    if (find(key) == nullptr) {
+      return false;
+    }
+    const auto index = static_cast<std::uint32_t>(key);
+    auto& s = slots_[index];
+    s.value = T{};
+    s.used = false;
+    // Generation 0 is skipped, so that no key is 0
+    if (++s.generation == 0) {
+      s.generation = 1;
+    }
+    s.next_free = free_;
+    free_ = index;
+    --size_;
+    return true;
+  }
+
+  /// @brief Invokes `f` on all stored values.
+  template <class F>
+  void for_each(F f) {
+    for (auto& s : slots_) {
+      if (s.used) {
+        f(s.value);
+      }
+    }
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// @brief Returns the number of stored values.
+  std::size_t size() const noexcept { return size_; }
+
+  /// @brief Returns the number of slots.
+  std::size_t capacity() const noexcept { return slots_.size(); }
+
+private:
+  /// @brief Appends `n` free slots.
+  void grow(std::size_t n) {
+    const auto first = static_cast<std::uint32_t>(slots_.size());
+    slots_.resize(slots_.size() + n);
+    for (auto i = static_cast<std::uint32_t>(slots_.size()); i > first; --i) {
+      slots_[i - 1].next_free = free_;
+      free_ = i - 1;
+    }
+  }
+
+  std::vector<slot> slots_;     ///< All slots
+  std::uint32_t free_{no_slot}; ///< Head of the free list
+  std::size_t size_{0};         ///< Number of used slots
+};
+
+} // namespace util
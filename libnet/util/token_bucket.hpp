@@ -0,0 +1,72 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      token_bucket.hpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+namespace util {
+
+/// @brief Rate limiter that refills tokens at a constant rate.
+/// Every admitted event takes one token. Up to `burst` events may be admitted
+/// at once, after which events are admitted at `rate` per second.
+class token_bucket {
+public:
+  using clock_type = std::chrono::steady_clock;
+
+  /// @brief Constructs a full bucket.
+  /// @param rate The number of tokens added per second.
+  /// @param burst The maximum number of tokens held by the bucket.
+  /// @param now The current time.
+  constexpr token_bucket(double rate, double burst,
+                         clock_type::time_point now) noexcept
+    : rate_{rate}, burst_{burst}, tokens_{burst}, last_refill_{now} {
+    // nop
+  }
+
+  /// @brief Takes a token if one is available.
+  /// @param now The current time.
+  /// @return true if the event is admitted, false otherwise.
+  bool try_acquire(clock_type::time_point now) noexcept {
+    refill(now);
+    if (tokens_ < 1) {
+      return false;
+    }
+    tokens_ -= 1;
+    return true;
+  }
+
+  /// @brief Returns whether the bucket has refilled completely, i.e. whether
+  /// it is indistinguishable from a new one.
+  /// @param now The current time.
+  bool full(clock_type::time_point now) const noexcept {
+    return available(now) >= burst_;
+  }
+
+private:
+  double available(clock_type::time_point now) const noexcept {
+    if (now <= last_refill_) {
+      return tokens_;
+    }
+    const std::chrono::duration<double> elapsed = now - last_refill_;
+    return std::min(burst_, tokens_ + (elapsed.count() * rate_));
+  }
+
+  void refill(clock_type::time_point now) noexcept {
+    tokens_ = available(now);
+    last_refill_ = std::max(last_refill_, now);
+  }
+
+  double rate_;                        ///< Tokens added per second
+  double burst_;                       ///< Capacity of the bucket
+  double tokens_;                      ///< Currently available tokens
+  clock_type::time_point last_refill_; ///< Time of the last refill
+};
+
+} // namespace util
@@ -0,0 +1,189 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      accept_benchmark.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/byte_array.hpp"
+#include "util/byte_span.hpp"
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+#include "util/intrusive_ptr.hpp"
+
+#include "net/ip/v4_address.hpp"
+#include "net/ip/v4_endpoint.hpp"
+
+#include "net/multiplexer.hpp"
+
+#include "net/socket/stream_socket.hpp"
+#include "net/socket/tcp_stream_socket.hpp"
+
+#include "net/manager_result.hpp"
+#include "net/receive_policy.hpp"
+
+#include "net/detail/event_handler.hpp"
+#include "net/detail/stream_transport.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures the rate at which a multiplexer accepts connections while several
+// clients connect, send a byte and disconnect as fast as possible. Connections
+// are handled by a plain event handler, or by stream transports that are
+// either allocated for every connection or reused from the manager pool.
+// Usage: accept_benchmark [num_connections] [num_clients]
+
+namespace {
+
+/// Reads until the client disconnects.
+struct closing_manager : public net::detail::event_handler {
+  closing_manager(net::socket handle, net::detail::multiplexer_base* mpx)
+    : net::detail::event_handler(handle, mpx) {
+    // nop
+  }
+
+  net::manager_result handle_read_event() override {
+    util::byte_array<16> buf;
+    const auto res = net::read(handle<net::stream_socket>(), buf);
+    if (res > 0) {
+      return net::manager_result::ok;
+    } else if ((res < 0) && net::last_socket_error_is_temporary()) {
+      return net::manager_result::temporary_error;
+    }
+    return net::manager_result::done;
+  }
+
+  net::manager_result handle_write_event() override {
+    return net::manager_result::done;
+  }
+};
+
+/// Reads until the client disconnects, as the next layer of a transport.
+struct closing_layer {
+  util::error init(auto& parent, const util::config&) {
+    parent.configure_next_read(net::receive_policy::up_to(1024));
+    return util::none;
+  }
+
+  net::manager_result produce(auto&) { return net::manager_result::ok; }
+
+  bool has_more_data() const noexcept { return false; }
+
+  net::manager_result consume(auto&, util::const_byte_span) {
+    return net::manager_result::ok;
+  }
+
+  net::manager_result handle_timeout(auto&, std::uint64_t) {
+    return net::manager_result::ok;
+  }
+};
+
+using closing_transport = net::detail::event_stream_transport<closing_layer>;
+
+/// Runs the connect storm against a multiplexer using `cfg`, handling the
+/// connections with managers of type `Manager`.
+template <class Manager>
+bool run(const std::string& name, const util::config& cfg,
+         std::size_t num_connections, std::size_t num_clients) {
+  std::atomic<std::size_t> num_accepted{0};
+  auto factory = [&num_accepted](net::socket handle,
+                                 net::detail::multiplexer_base* mpx) {
+    num_accepted.fetch_add(1, std::memory_order_relaxed);
+    return mpx->make_manager<Manager>(
+      net::socket_cast<net::stream_socket>(handle));
+  };
+  auto res = net::make_multiplexer(factory, cfg);
+  if (auto err = util::get_error(res)) {
+    std::cerr << name << ": " << to_string(*err) << '\n';
+    return false;
+  }
+  auto mpx = std::get<net::multiplexer_ptr>(res);
+  mpx->start();
+  const net::ip::v4_endpoint ep{net::ip::v4_address::localhost, mpx->port()};
+  std::atomic<bool> success{true};
+  const auto begin = std::chrono::steady_clock::now();
+  std::vector<std::thread> clients;
+  for (std::size_t i = 0; i < num_clients; ++i) {
+    clients.emplace_back([&, share = num_connections / num_clients] {
+      const util::byte_array<1> byte{};
+      for (std::size_t j = 0; success && (j < share); ++j) {
+        auto sock_res = net::make_connected_tcp_stream_socket(ep);
+        if (util::get_error(sock_res)) {
+          success = false;
+          return;
+        }
+        const auto sock = std::get<net::tcp_stream_socket>(sock_res);
+        net::write(sock, byte);
+        net::close(sock);
+      }
+    });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+  const auto expected = (num_connections / num_clients) * num_clients;
+  while (success && (num_accepted.load() < expected)) {
+    std::this_thread::yield();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - begin;
+  mpx->shutdown();
+  mpx->join();
+  if (!success) {
+    std::cerr << name << ": connecting failed\n";
+    return false;
+  }
+  const auto secs = std::chrono::duration<double>(elapsed).count();
+  std::cout << std::left << std::setw(24) << name << std::right << std::fixed
+            << std::setprecision(0) << std::setw(14)
+            << static_cast<double>(expected) / secs << '\n';
+  return true;
+}
+
+} // namespace
+
+int main(int argc, const char** argv) {
+  const std::size_t num_connections = (argc > 1) ? std::stoul(argv[1])
+                                                 : 10'000;
+  const std::size_t num_clients = (argc > 2) ? std::stoul(argv[2]) : 4;
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.backlog", std::int64_t{1024});
+  std::cout << "accepting " << num_connections << " connections from "
+            << num_clients << " clients\n"
+            << std::left << std::setw(24) << "config" << std::right
+            << std::setw(14) << "conns/s" << '\n';
+  bool success = true;
+  for (const std::int64_t batch_size : {1, 16, 64}) {
+    util::config batch_cfg = cfg;
+    batch_cfg.add_config_entry("multiplexer.accept-batch-size", batch_size);
+    success = success
+              && run<closing_manager>("batch " + std::to_string(batch_size),
+                                      batch_cfg, num_connections,
+                                      num_clients);
+  }
+  util::config defer_cfg = cfg;
+  defer_cfg.add_config_entry("multiplexer.accept-batch-size", std::int64_t{16});
+  defer_cfg.add_config_entry("multiplexer.defer-accept-s", std::int64_t{1});
+  success = success
+            && run<closing_manager>("batch 16, deferred", defer_cfg,
+                                    num_connections, num_clients);
+  util::config unpooled_cfg = cfg;
+  unpooled_cfg.add_config_entry("multiplexer.max-pooled-managers",
+                                std::int64_t{0});
+  success = success
+            && run<closing_transport>("transport, unpooled", unpooled_cfg,
+                                      num_connections, num_clients);
+  success = success
+            && run<closing_transport>("transport, pooled", cfg,
+                                      num_connections, num_clients);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
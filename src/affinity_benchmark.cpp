@@ -0,0 +1,209 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      affinity_benchmark.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/byte_array.hpp"
+#include "util/config.hpp"
+#include "util/cpu_affinity.hpp"
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+#include "util/intrusive_ptr.hpp"
+
+#include "net/multiplexer.hpp"
+
+#include "net/socket/stream_socket.hpp"
+
+#include "net/manager_result.hpp"
+
+#include "net/detail/event_handler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures the round-trip latency of a small message echoed by a multiplexer
+// thread, once with threads left to the scheduler and once pinned to distinct
+// CPUs. Usage: affinity_benchmark [num_round_trips] [numa_node]
+
+namespace {
+
+constexpr std::size_t message_size = 64;
+constexpr std::size_t num_warmup_round_trips = 1000;
+
+struct echo_manager : public net::detail::event_handler {
+  echo_manager(net::socket handle, net::detail::multiplexer_base* mpx)
+    : net::detail::event_handler(handle, mpx) {
+    // nop
+  }
+
+  net::manager_result handle_read_event() override {
+    const auto num_bytes = net::read(handle<net::stream_socket>(), buf_);
+    if (num_bytes <= 0) {
+      return net::manager_result::error;
+    }
+    const auto written = net::write(handle<net::stream_socket>(),
+                                    {buf_.data(),
+                                     static_cast<std::size_t>(num_bytes)});
+    return (written == num_bytes) ? net::manager_result::ok
+                                  : net::manager_result::error;
+  }
+
+  net::manager_result handle_write_event() override {
+    return net::manager_result::done;
+  }
+
+private:
+  util::byte_array<message_size> buf_;
+};
+
+bool round_trip(net::stream_socket client,
+                util::byte_array<message_size>& buf) {
+  if (net::write(client, buf) != static_cast<std::ptrdiff_t>(buf.size())) {
+    return false;
+  }
+  std::size_t received = 0;
+  while (received < buf.size()) {
+    const auto res = net::read(client, {buf.data() + received,
+                                        buf.size() - received});
+    if (res <= 0) {
+      return false;
+    }
+    received += static_cast<std::size_t>(res);
+  }
+  return true;
+}
+
+void print(const std::string& name, std::vector<std::int64_t> samples) {
+  std::sort(samples.begin(), samples.end());
+  const auto n = static_cast<double>(samples.size());
+  const auto mean = std::accumulate(samples.begin(), samples.end(), 0.0) / n;
+  const auto sq_sum = std::accumulate(samples.begin(), samples.end(), 0.0,
+                                      [mean](double acc, std::int64_t x) {
+                                        const auto d = static_cast<double>(x)
+                                                       - mean;
+                                        return acc + (d * d);
+                                      });
+  auto percentile = [&](double p) {
+    return samples[static_cast<std::size_t>(p * (n - 1))];
+  };
+  std::cout << std::left << std::setw(16) << name << std::right << std::fixed
+            << std::setprecision(0) << std::setw(10) << mean << std::setw(10)
+            << std::sqrt(sq_sum / n) << std::setw(10) << percentile(0.5)
+            << std::setw(10) << percentile(0.99) << std::setw(10)
+            << percentile(0.999) << std::setw(10) << samples.back() << '\n';
+}
+
+/// Runs the benchmark with the given multiplexer config, pinning the client
+/// thread to `client_cpu` if set.
+bool run(const std::string& name, const util::config& cfg,
+         std::optional<std::size_t> client_cpu, std::size_t num_round_trips) {
+  auto res = net::make_multiplexer(net::multiplexer::manager_factory{}, cfg);
+  if (auto err = util::get_error(res)) {
+    std::cerr << name << ": " << to_string(*err) << '\n';
+    return false;
+  }
+  auto mpx = std::get<net::multiplexer_ptr>(res);
+  auto sockets_res = net::make_stream_socket_pair();
+  if (auto err = util::get_error(sockets_res)) {
+    std::cerr << name << ": " << to_string(*err) << '\n';
+    return false;
+  }
+  auto [server, client] = std::get<net::stream_socket_pair>(sockets_res);
+  mpx->add(util::make_intrusive<echo_manager>(server, mpx.get()),
+           net::operation::read);
+  mpx->start();
+  std::vector<std::int64_t> samples;
+  samples.reserve(num_round_trips);
+  bool success = true;
+  std::thread{[&] {
+    if (client_cpu) {
+      if (auto err = util::pin_current_thread({*client_cpu})) {
+        std::cerr << name << ": " << to_string(err) << '\n';
+        success = false;
+        return;
+      }
+    }
+    util::byte_array<message_size> buf{};
+    for (std::size_t i = 0; success && (i < num_warmup_round_trips); ++i) {
+      success = round_trip(client, buf);
+    }
+    for (std::size_t i = 0; success && (i < num_round_trips); ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      success = round_trip(client, buf);
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+      samples.emplace_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+          .count());
+    }
+  }}.join();
+  net::close(client);
+  mpx->shutdown();
+  mpx->join();
+  if (!success || samples.empty()) {
+    std::cerr << name << ": round trip failed\n";
+    return false;
+  }
+  print(name, std::move(samples));
+  return true;
+}
+
+} // namespace
+
+int main(int argc, const char** argv) {
+  const std::size_t num_round_trips = (argc > 1) ? std::stoul(argv[1])
+                                                 : 100'000;
+  const auto allowed = util::allowed_cpus();
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.listen", false);
+  std::cout << "round trip latency in ns over " << num_round_trips
+            << " messages of " << message_size << " bytes\n"
+            << std::left << std::setw(16) << "config" << std::right
+            << std::setw(10) << "mean" << std::setw(10) << "stddev"
+            << std::setw(10) << "p50" << std::setw(10) << "p99"
+            << std::setw(10) << "p99.9" << std::setw(10) << "max" << '\n';
+  if (!run("unpinned", cfg, std::nullopt, num_round_trips)) {
+    return EXIT_FAILURE;
+  }
+  if (allowed.size() < 2) {
+    std::cout << "pinning requires at least two usable CPUs\n";
+    return EXIT_SUCCESS;
+  }
+  // Neighbouring CPUs usually share a cache and a node
+  util::config pinned_cfg = cfg;
+  pinned_cfg.add_config_entry("multiplexer.cpu-affinity",
+                              std::to_string(allowed[0]));
+  if (!run("pinned", pinned_cfg, allowed[1], num_round_trips)) {
+    return EXIT_FAILURE;
+  }
+  if (argc > 2) {
+    const auto node = std::stoll(argv[2]);
+    auto node_res = util::numa_node_cpus(static_cast<std::size_t>(node));
+    if (auto err = util::get_error(node_res)) {
+      std::cerr << to_string(*err) << '\n';
+      return EXIT_FAILURE;
+    }
+    const auto& node_cpus = std::get<util::cpu_list>(node_res);
+    util::config numa_cfg = cfg;
+    numa_cfg.add_config_entry("multiplexer.numa-node", std::int64_t{node});
+    numa_cfg.add_config_entry("multiplexer.cpu-affinity",
+                              std::to_string(node_cpus.front()));
+    const auto client_cpu = node_cpus[std::min<std::size_t>(
+      1, node_cpus.size() - 1)];
+    if (!run("pinned+numa", numa_cfg, client_cpu, num_round_trips)) {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
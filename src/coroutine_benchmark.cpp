@@ -0,0 +1,260 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      coroutine_benchmark.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/byte_buffer.hpp"
+#include "util/byte_span.hpp"
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+#include "util/intrusive_ptr.hpp"
+
+#include "net/connection.hpp"
+#include "net/coroutine_layer.hpp"
+#include "net/multiplexer.hpp"
+#include "net/receive_policy.hpp"
+#include "net/task.hpp"
+
+#include "net/socket/stream_socket.hpp"
+
+#include "net/manager_result.hpp"
+
+#include "net/detail/stream_transport.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Compares protocols written as coroutines with hand-written state machines.
+// The echo workload sends fixed-size messages that are echoed back, the
+// request/response workload sends length-prefixed requests that are answered
+// with a larger response. Usage: coroutine_benchmark [num_round_trips]
+
+namespace {
+
+constexpr std::size_t message_size = 64;
+constexpr std::size_t header_size = sizeof(std::uint32_t);
+constexpr std::size_t request_size = 32;
+constexpr std::size_t response_size = 512;
+constexpr std::size_t num_warmup_round_trips = 1000;
+
+std::uint32_t read_header(util::const_byte_span bytes) {
+  std::uint32_t size = 0;
+  std::memcpy(&size, bytes.data(), header_size);
+  return size;
+}
+
+util::byte_buffer make_message(std::size_t size) {
+  util::byte_buffer buf(header_size + size, std::byte{0x2A});
+  const auto payload_size = static_cast<std::uint32_t>(size);
+  std::memcpy(buf.data(), &payload_size, header_size);
+  return buf;
+}
+
+const util::byte_buffer response = make_message(response_size);
+
+// -- state machines -----------------------------------------------------------
+
+struct echo_state_machine {
+  util::error init(auto& parent, const util::config&) {
+    parent.configure_next_read(net::receive_policy::exactly(message_size));
+    return util::none;
+  }
+
+  bool has_more_data() const noexcept { return false; }
+
+  net::manager_result produce(auto&) { return net::manager_result::ok; }
+
+  net::manager_result consume(auto& parent, util::const_byte_span bytes) {
+    parent.enqueue(bytes);
+    return net::manager_result::ok;
+  }
+
+  net::manager_result handle_timeout(auto&, uint64_t) {
+    return net::manager_result::ok;
+  }
+};
+
+struct request_response_state_machine {
+  util::error init(auto& parent, const util::config&) {
+    parent.configure_next_read(net::receive_policy::exactly(header_size));
+    return util::none;
+  }
+
+  bool has_more_data() const noexcept { return false; }
+
+  net::manager_result produce(auto&) { return net::manager_result::ok; }
+
+  net::manager_result consume(auto& parent, util::const_byte_span bytes) {
+    if (reading_header_) {
+      parent.configure_next_read(
+        net::receive_policy::exactly(read_header(bytes)));
+    } else {
+      parent.enqueue(response);
+      parent.configure_next_read(net::receive_policy::exactly(header_size));
+    }
+    reading_header_ = !reading_header_;
+    return net::manager_result::ok;
+  }
+
+  net::manager_result handle_timeout(auto&, uint64_t) {
+    return net::manager_result::ok;
+  }
+
+private:
+  bool reading_header_{true};
+};
+
+// -- coroutines ---------------------------------------------------------------
+
+net::task<> echo_coroutine(net::connection& conn) {
+  for (;;) {
+    const auto bytes = co_await conn.read(
+      net::receive_policy::exactly(message_size));
+    co_await conn.write(bytes);
+  }
+}
+
+net::task<std::uint32_t> read_request(net::connection& conn) {
+  const auto header = co_await conn.read(
+    net::receive_policy::exactly(header_size));
+  const auto size = read_header(header);
+  co_await conn.read(net::receive_policy::exactly(size));
+  co_return size;
+}
+
+net::task<> request_response_coroutine(net::connection& conn) {
+  for (;;) {
+    co_await read_request(conn);
+    co_await conn.write(response);
+  }
+}
+
+using coroutine = net::coroutine_layer<net::task<> (*)(net::connection&)>;
+
+// -- benchmark ----------------------------------------------------------------
+
+bool read_all(net::stream_socket client, util::byte_buffer& buf) {
+  std::size_t received = 0;
+  while (received < buf.size()) {
+    const auto res = net::read(client, {buf.data() + received,
+                                        buf.size() - received});
+    if (res <= 0) {
+      return false;
+    }
+    received += static_cast<std::size_t>(res);
+  }
+  return true;
+}
+
+void print(const std::string& name, std::vector<std::int64_t> samples,
+           std::chrono::nanoseconds total) {
+  std::sort(samples.begin(), samples.end());
+  const auto n = static_cast<double>(samples.size());
+  const auto mean = std::accumulate(samples.begin(), samples.end(), 0.0) / n;
+  const auto rate = n / std::chrono::duration<double>(total).count();
+  auto percentile = [&](double p) {
+    return samples[static_cast<std::size_t>(p * (n - 1))];
+  };
+  std::cout << std::left << std::setw(28) << name << std::right << std::fixed
+            << std::setprecision(0) << std::setw(12) << rate << std::setw(10)
+            << mean << std::setw(10) << percentile(0.5) << std::setw(10)
+            << percentile(0.99) << '\n';
+}
+
+/// Runs round trips against a server running `Manager`, constructed from the
+/// server socket, the multiplexer and `xs`.
+template <class Manager, class... Ts>
+bool run(const std::string& name, const util::config& cfg,
+         const util::byte_buffer& request, std::size_t reply_size,
+         std::size_t num_round_trips, Ts&&... xs) {
+  auto res = net::make_multiplexer(net::multiplexer::manager_factory{}, cfg);
+  if (auto err = util::get_error(res)) {
+    std::cerr << name << ": " << to_string(*err) << '\n';
+    return false;
+  }
+  auto mpx = std::get<net::multiplexer_ptr>(res);
+  auto sockets_res = net::make_stream_socket_pair();
+  if (auto err = util::get_error(sockets_res)) {
+    std::cerr << name << ": " << to_string(*err) << '\n';
+    return false;
+  }
+  auto [server, client] = std::get<net::stream_socket_pair>(sockets_res);
+  mpx->add(util::make_intrusive<Manager>(server, mpx.get(),
+                                         std::forward<Ts>(xs)...),
+           net::operation::read);
+  mpx->start();
+  std::vector<std::int64_t> samples;
+  samples.reserve(num_round_trips);
+  util::byte_buffer reply(reply_size);
+  auto round_trip = [&] {
+    return (net::write(client, request)
+            == static_cast<std::ptrdiff_t>(request.size()))
+           && read_all(client, reply);
+  };
+  bool success = true;
+  for (std::size_t i = 0; success && (i < num_warmup_round_trips); ++i) {
+    success = round_trip();
+  }
+  const auto begin = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; success && (i < num_round_trips); ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    success = round_trip();
+    samples.emplace_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count());
+  }
+  const auto total = std::chrono::steady_clock::now() - begin;
+  net::close(client);
+  mpx->shutdown();
+  mpx->join();
+  if (!success || samples.empty()) {
+    std::cerr << name << ": round trip failed\n";
+    return false;
+  }
+  print(name, std::move(samples), total);
+  return true;
+}
+
+} // namespace
+
+int main(int argc, const char** argv) {
+  using net::detail::event_stream_transport;
+  const std::size_t num_round_trips = (argc > 1) ? std::stoul(argv[1])
+                                                 : 100'000;
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.listen", false);
+  const util::byte_buffer echo_request(message_size, std::byte{0x2A});
+  const auto request = make_message(request_size);
+  std::cout << "round trips over " << num_round_trips << " messages\n"
+            << std::left << std::setw(28) << "workload" << std::right
+            << std::setw(12) << "per second" << std::setw(10) << "mean ns"
+            << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns" << '\n';
+  const bool success
+    = run<event_stream_transport<echo_state_machine>>(
+        "echo/state machine", cfg, echo_request, message_size,
+        num_round_trips)
+      && run<event_stream_transport<coroutine>>("echo/coroutine", cfg,
+                                                echo_request, message_size,
+                                                num_round_trips,
+                                                &echo_coroutine)
+      && run<event_stream_transport<request_response_state_machine>>(
+        "request/state machine", cfg, request, response.size(),
+        num_round_trips)
+      && run<event_stream_transport<coroutine>>(
+        "request/coroutine", cfg, request, response.size(), num_round_trips,
+        &request_response_coroutine);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,186 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      dispatch_benchmark.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/byte_array.hpp"
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+#include "util/intrusive_ptr.hpp"
+
+#include "net/multiplexer.hpp"
+
+#include "net/socket/socket.hpp"
+#include "net/socket/stream_socket.hpp"
+
+#include "net/manager_result.hpp"
+#include "net/operation.hpp"
+
+#include "net/detail/event_handler.hpp"
+
+#include <sys/resource.h>
+#include <sys/socket.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures the cost of dispatching epoll events to their managers depending
+// on the number of registered sockets. Besides a fixed set of active socket
+// pairs that receive a byte every round, the multiplexer holds idle sockets
+// that never become readable, so only the size of the manager table grows.
+// Sizes exceeding RLIMIT_NOFILE are skipped.
+// Usage: dispatch_benchmark [num_rounds] [num_active]
+
+namespace {
+
+constexpr std::size_t num_reserved_fds = 64;
+
+/// Reads the byte of the current round.
+struct counting_manager : public net::detail::event_handler {
+  counting_manager(net::socket handle, net::detail::multiplexer_base* mpx,
+                   std::size_t& num_events)
+    : net::detail::event_handler(handle, mpx), num_events_{num_events} {
+    // nop
+  }
+
+  net::manager_result handle_read_event() override {
+    util::byte_array<1> buf;
+    if (net::read(handle<net::stream_socket>(), buf) != 1) {
+      return net::manager_result::error;
+    }
+    ++num_events_;
+    return net::manager_result::ok;
+  }
+
+  net::manager_result handle_write_event() override {
+    return net::manager_result::done;
+  }
+
+private:
+  std::size_t& num_events_;
+};
+
+/// Holds a socket that never becomes readable.
+struct idle_manager : public net::detail::event_handler {
+  using net::detail::event_handler::event_handler;
+
+  net::manager_result handle_read_event() override {
+    return net::manager_result::error;
+  }
+
+  net::manager_result handle_write_event() override {
+    return net::manager_result::done;
+  }
+};
+
+/// Raises the soft limit of open files to the hard limit.
+/// @return The number of files that may be opened.
+std::size_t raise_file_limit() {
+  rlimit lim{};
+  if (getrlimit(RLIMIT_NOFILE, &lim) != 0) {
+    return 0;
+  }
+  lim.rlim_cur = lim.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &lim);
+  getrlimit(RLIMIT_NOFILE, &lim);
+  return static_cast<std::size_t>(lim.rlim_cur);
+}
+
+/// Runs the benchmark with `num_sockets` registered sockets, of which
+/// `num_active` receive a byte in each of the `num_rounds` rounds.
+bool run(std::size_t num_sockets, std::size_t num_active,
+         std::size_t num_rounds) {
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.listen", false);
+  net::multiplexer mpx;
+  if (auto err = mpx.init(net::multiplexer::manager_factory{}, cfg)) {
+    std::cerr << to_string(err) << '\n';
+    return false;
+  }
+  mpx.set_thread_id(std::this_thread::get_id());
+  std::size_t num_events = 0;
+  std::vector<net::stream_socket> peers;
+  peers.reserve(num_active);
+  bool success = true;
+  for (std::size_t i = 0; success && (i < num_active); ++i) {
+    auto res = net::make_stream_socket_pair();
+    if (util::get_error(res)) {
+      success = false;
+      break;
+    }
+    auto [server, client] = std::get<net::stream_socket_pair>(res);
+    peers.emplace_back(client);
+    mpx.add(util::make_intrusive<counting_manager>(server, &mpx, num_events),
+            net::operation::read);
+  }
+  // Unbound datagram sockets are neither readable nor hung up
+  for (std::size_t i = num_active; success && (i < num_sockets); ++i) {
+    const net::socket sock{::socket(AF_INET, SOCK_DGRAM, 0)};
+    if (sock == net::invalid_socket) {
+      success = false;
+      break;
+    }
+    mpx.add(util::make_intrusive<idle_manager>(sock, &mpx),
+            net::operation::read);
+  }
+  std::chrono::nanoseconds elapsed{0};
+  const util::byte_array<1> byte{};
+  for (std::size_t round = 0; success && (round < num_rounds); ++round) {
+    for (const auto peer : peers) {
+      success = success && (net::write(peer, byte) == 1);
+    }
+    num_events = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (success && (num_events < num_active)) {
+      success = !mpx.poll_once(false);
+    }
+    elapsed += std::chrono::steady_clock::now() - start;
+  }
+  for (const auto peer : peers) {
+    net::close(peer);
+  }
+  if (!success) {
+    std::cerr << num_sockets << " sockets: benchmark failed\n";
+    return false;
+  }
+  const auto num_dispatched = static_cast<double>(num_rounds * num_active);
+  std::cout << std::setw(10) << num_sockets << std::fixed
+            << std::setprecision(1) << std::setw(14)
+            << static_cast<double>(elapsed.count()) / num_dispatched << '\n';
+  return true;
+}
+
+} // namespace
+
+int main(int argc, const char** argv) {
+  const std::size_t num_rounds = (argc > 1) ? std::stoul(argv[1]) : 1000;
+  const std::size_t num_active = (argc > 2) ? std::stoul(argv[2]) : 1024;
+  const auto max_files = raise_file_limit();
+  std::cout << "dispatching " << num_active << " events per round over "
+            << num_rounds << " rounds\n"
+            << std::setw(10) << "sockets" << std::setw(14) << "ns/event"
+            << '\n';
+  for (const std::size_t num_sockets : {10'000, 100'000, 1'000'000}) {
+    // Each active socket pair occupies two descriptors
+    if (num_sockets + num_active + num_reserved_fds > max_files) {
+      std::cout << std::setw(10) << num_sockets
+                << "  skipped, RLIMIT_NOFILE is " << max_files << '\n';
+      continue;
+    }
+    if ((num_sockets < num_active) || !run(num_sockets, num_active,
+                                           num_rounds)) {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      connection.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/connection.hpp"
+
+#include "util/assert.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace net {
+
+// -- coroutine_layer interface ------------------------------------------------
+
+void connection::handle_bytes(util::const_byte_span bytes) {
+  if (state_ != state::reading) {
+    // The peer is ahead of the coroutine, keep the bytes for its next read
+    buffered_.insert(buffered_.end(), bytes.begin(), bytes.end());
+    return;
+  }
+  if (buffered_.empty()) {
+    // Common case, hand out the read buffer of the transport without copying
+    read_result_ = bytes;
+  } else {
+    buffered_.insert(buffered_.end(), bytes.begin(), bytes.end());
+    handed_out_ = std::min<std::size_t>(buffered_.size(),
+                                        read_policy_.max_size);
+    read_result_ = util::const_byte_span{buffered_.data(), handed_out_};
+  }
+  resume();
+}
+
+void connection::handle_write() {
+  resume();
+}
+
+bool connection::handle_timeout(std::uint64_t id) {
+  if ((state_ != state::sleeping) || (id != sleep_id_)) {
+    return false;
+  }
+  resume();
+  return true;
+}
+
+// -- private member functions -------------------------------------------------
+
+bool connection::try_read(receive_policy policy) noexcept {
+  ASSERT(policy.min_size > 0, "reads must wait for at least one byte");
+  if (handed_out_ > 0) {
+    buffered_.erase(buffered_.begin(),
+                    buffered_.begin() + static_cast<std::ptrdiff_t>(
+                                          std::exchange(handed_out_, 0)));
+  }
+  if (buffered_.size() < policy.min_size) {
+    return false;
+  }
+  handed_out_ = std::min<std::size_t>(buffered_.size(), policy.max_size);
+  read_result_ = util::const_byte_span{buffered_.data(), handed_out_};
+  return true;
+}
+
+void connection::suspend_read(std::coroutine_handle<> hdl,
+                              receive_policy policy) {
+  state_ = state::reading;
+  suspended_ = hdl;
+  read_policy_ = policy;
+  // Only the bytes missing from the buffered ones are read
+  const auto num_buffered = static_cast<std::uint32_t>(buffered_.size());
+  transport_->configure_next_read(receive_policy::between(
+    policy.min_size - num_buffered, policy.max_size - num_buffered));
+}
+
+void connection::suspend_write(std::coroutine_handle<> hdl,
+                               util::const_byte_span bytes) {
+  state_ = state::writing;
+  suspended_ = hdl;
+  // Read results point into buffers that are overwritten by further reads
+  // before the transport fetches the pending write
+  enqueue_(parent_, bytes);
+}
+
+void connection::suspend_sleep(std::coroutine_handle<> hdl,
+                               clock_type::time_point when) {
+  state_ = state::sleeping;
+  suspended_ = hdl;
+  sleep_id_ = manager_->set_timeout_at(when);
+}
+
+void connection::resume() {
+  state_ = state::idle;
+  std::exchange(suspended_, nullptr).resume();
+  if (state_ != state::reading) {
+    // Bytes arriving in the meantime are buffered for the next read, partial
+    // reads would be discarded when the read is configured
+    transport_->configure_next_read(receive_policy::up_to(idle_read_size));
+  }
+}
+
+} // namespace net
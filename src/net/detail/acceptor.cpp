@@ -11,9 +11,21 @@
 #include "net/detail/multiplexer_base.hpp"
 #include "net/socket/tcp_stream_socket.hpp"
 
+#include "net/ip/v4_endpoint.hpp"
+
+#include "util/config.hpp"
+#include "util/error.hpp"
 #include "util/error_code.hpp"
+#include "util/error_or.hpp"
 #include "util/logger.hpp"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+
 #if defined(LIB_NET_URING)
 #  include "net/detail/uring_manager.hpp"
 #  include "net/detail/uring_multiplexer.hpp"
@@ -29,35 +41,203 @@ acceptor_base<ManagerBase>::acceptor_base(tcp_accept_socket handle,
   LOG_TRACE();
 }
 
+template <class ManagerBase>
+util::error acceptor_base<ManagerBase>::init(const util::config& cfg) {
+  if (auto err = ManagerBase::init(cfg)) {
+    return err;
+  }
+  const std::chrono::seconds timeout{
+    cfg.get_or("multiplexer.defer-accept-s", std::int64_t{0})};
+  if ((timeout.count() != 0)
+      && !defer_accept(ManagerBase::template handle<tcp_accept_socket>(),
+                       timeout)) {
+    return util::error{util::error_code::socket_operation_failed,
+                       "Failed to set TCP_DEFER_ACCEPT: {0}",
+                       last_socket_error_as_string()};
+  }
+  const auto max_loop_lag_us = cfg.get_or("multiplexer.max-loop-lag-us",
+                                          std::int64_t{0});
+  const auto recheck_ms = cfg.get_or("multiplexer.overload-recheck-ms",
+                                     std::int64_t{10});
+  if ((max_loop_lag_us < 0) || (recheck_ms <= 0)) {
+    return util::error{util::error_code::invalid_argument,
+                       "invalid overload detection settings"};
+  }
+  max_loop_lag_ = std::chrono::microseconds{max_loop_lag_us};
+  recheck_interval_ = std::chrono::milliseconds{recheck_ms};
+  const auto policy = cfg.get_or("multiplexer.overload-policy",
+                                 std::string{"pause"});
+  if ((policy != "pause") && (policy != "shed")) {
+    return util::error{util::error_code::invalid_argument,
+                       "unknown multiplexer.overload-policy {0}", policy};
+  }
+  shed_ = (policy == "shed");
+  const auto rate = cfg.get_or("multiplexer.per-ip-connection-rate",
+                               std::int64_t{0});
+  const auto burst = cfg.get_or("multiplexer.per-ip-connection-burst", rate);
+  const auto max_sources = cfg.get_or(
+    "multiplexer.per-ip-max-sources",
+    static_cast<std::int64_t>(default_max_tracked_sources));
+  if ((rate < 0) || (burst < 0) || ((rate > 0) && (burst == 0))
+      || (max_sources <= 0)) {
+    return util::error{util::error_code::invalid_argument,
+                       "invalid per-ip connection limits"};
+  }
+  per_ip_rate_ = static_cast<double>(rate);
+  per_ip_burst_ = static_cast<double>(burst);
+  max_tracked_sources_ = static_cast<std::size_t>(max_sources);
+  return util::none;
+}
+
+template <class ManagerBase>
+manager_result acceptor_base<ManagerBase>::handle_timeout(uint64_t timeout_id) {
+  if (timeout_id != recheck_timeout_) {
+    return manager_result::ok;
+  }
+  if (overloaded()) {
+    recheck_timeout_ = ManagerBase::set_timeout_in(recheck_interval_);
+  } else {
+    LOG_DEBUG("acceptor resumes accepting on ",
+              NET_ARG2("handle", ManagerBase::handle().id));
+    ManagerBase::register_reading();
+  }
+  return manager_result::ok;
+}
+
+template <class ManagerBase>
+bool acceptor_base<ManagerBase>::lagging(
+  const multiplexer_base& mpx) const noexcept {
+  return (max_loop_lag_.count() > 0) && (mpx.loop_lag() > max_loop_lag_);
+}
+
+template <class ManagerBase>
+bool acceptor_base<ManagerBase>::pause_if_overloaded() {
+  if (shed_ || !overloaded()) {
+    return false;
+  }
+  LOG_DEBUG("acceptor pauses accepting on ",
+            NET_ARG2("handle", ManagerBase::handle().id));
+  ManagerBase::pause_reading();
+  recheck_timeout_ = ManagerBase::set_timeout_in(recheck_interval_);
+  return true;
+}
+
+template <class ManagerBase>
+bool acceptor_base<ManagerBase>::admit(tcp_stream_socket accepted) {
+  auto reject = [&]([[maybe_unused]] const char* reason) {
+    LOG_DEBUG("rejecting ", NET_ARG2("handle", accepted.id), ": ", reason);
+    ManagerBase::mpx()->stats().add_rejected();
+    close(accepted);
+    return false;
+  };
+  if (overloaded()) {
+    return reject("overloaded");
+  }
+  if (per_ip_rate_ == 0) {
+    return true;
+  }
+  auto peer = peer_of(accepted);
+  if (util::get_error(peer)) {
+    return true;
+  }
+  const auto now = ManagerBase::mpx()->loop_now();
+  const auto address = std::get<ip::v4_endpoint>(peer).address();
+  if (auto it = buckets_.find(address); it != buckets_.end()) {
+    sources_.splice(sources_.begin(), sources_, it->second);
+  } else if (sources_.size() < max_tracked_sources_) {
+    sources_.emplace_front(address, util::token_bucket{per_ip_rate_,
+                                                       per_ip_burst_, now});
+    buckets_.emplace(address, sources_.begin());
+  } else {
+    // Reuse the entry of the source seen least recently
+    buckets_.erase(sources_.back().first);
+    sources_.splice(sources_.begin(), sources_, std::prev(sources_.end()));
+    sources_.front() = {address,
+                        util::token_bucket{per_ip_rate_, per_ip_burst_, now}};
+    buckets_.emplace(address, sources_.begin());
+  }
+  return sources_.front().second.try_acquire(now) || reject("rate limited");
+}
+
 template <class ManagerBase>
 manager_result
-acceptor_base<ManagerBase>::handle_accepted(tcp_stream_socket accepted) {
+acceptor_base<ManagerBase>::handle_accepted(tcp_stream_socket accepted,
+                                            bool nonblocking) {
+  if (!admit(accepted)) {
+    return manager_result::ok;
+  }
   auto mgr = factory_(accepted);
+  if (!mgr) {
+    LOG_ERROR("factory did not create a manager for ",
+              NET_ARG2("handle", accepted.id));
+    close(accepted);
+    return manager_result::ok;
+  }
+  // The factory may have placed the manager on another multiplexer
+  auto* target = mgr->mpx();
+  if ((target != ManagerBase::mpx()) && lagging(*target)) {
+    LOG_DEBUG("rejecting ", NET_ARG2("handle", accepted.id),
+              ": target overloaded");
+    ManagerBase::mpx()->stats().add_rejected();
+    // Releasing the manager closes the connection
+    return manager_result::ok;
+  }
+  if (nonblocking) {
+    mgr->assume_nonblocking();
+  }
+  ManagerBase::mpx()->stats().add_accepted();
   const auto initial = mgr->initial_operation();
-  ManagerBase::mpx()->add(std::move(mgr), initial);
+  target->add(std::move(mgr), initial);
   return manager_result::ok;
 }
 
 // -- acceptor<event_handler> implementation (epoll/kqueue) -------------------
 
+util::error acceptor<event_handler>::init(const util::config& cfg) {
+  if (auto err = base::init(cfg)) {
+    return err;
+  }
+  accept_batch_size_ = cfg.get_or(
+    "multiplexer.accept-batch-size",
+    static_cast<std::int64_t>(default_accept_batch_size));
+  if (accept_batch_size_ == 0) {
+    return util::error{util::error_code::invalid_argument,
+                       "multiplexer.accept-batch-size must not be zero"};
+  }
+  return util::none;
+}
+
 manager_result acceptor<event_handler>::handle_read_event() {
   auto accept_handle = handle<tcp_accept_socket>();
   LOG_TRACE();
   LOG_DEBUG("event_acceptor handling read event ",
             NET_ARG2("accept_handle", accept_handle.id));
-  const auto accepted = accept(accept_handle);
-  if (accepted == invalid_socket) {
-    if (net::last_socket_error_is_temporary()) {
-      return manager_result::ok;
-    } else {
-      handle_error(util::error{util::error_code::socket_operation_failed,
-                               "accept returned an invalid socket: "
-                                 + net::last_socket_error_as_string()});
-      return manager_result::error;
+  if (base::pause_if_overloaded()) {
+    return manager_result::temporary_error;
+  }
+  // Connections left after a full batch are reported again, or handled from
+  // the ready list when edge-triggered
+  for (std::size_t i = 0; i < accept_batch_size_; ++i) {
+    const auto accepted = accept_nonblocking(accept_handle);
+    if (accepted == invalid_socket) {
+      if (net::last_socket_error_is_temporary()) {
+        return requeued_on_ok() ? manager_result::temporary_error
+                                : manager_result::ok;
+      } else {
+        handle_error(util::error{util::error_code::socket_operation_failed,
+                                 "accept returned an invalid socket: "
+                                   + net::last_socket_error_as_string()});
+        return manager_result::error;
+      }
+    }
+    LOG_DEBUG("event_acceptor connection ",
+              NET_ARG2("new_handle", accepted.id));
+    if (const auto res = base::handle_accepted(accepted, true);
+        res != manager_result::ok) {
+      return res;
     }
   }
-  LOG_DEBUG("event_acceptor connection ", NET_ARG2("new_handle", accepted.id));
-  return base::handle_accepted(accepted);
+  return manager_result::ok;
 }
 
 #if defined(LIB_NET_URING)
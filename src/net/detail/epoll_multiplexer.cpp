@@ -25,14 +25,60 @@
 #  include "util/logger.hpp"
 
 #  include <algorithm>
+#  include <cerrno>
 #  include <chrono>
+#  include <ctime>
+#  include <optional>
+#  include <sys/timerfd.h>
 #  include <unistd.h>
 #  include <utility>
 
 namespace net::detail {
 
+using std::chrono::steady_clock;
+using std::chrono::time_point_cast;
+
+namespace {
+
+using generation_type = manager_table::generation_type;
+
+/// Packs the descriptor and the generation of its manager into the user data
+/// of an epoll event.
+constexpr std::uint64_t to_event_data(int fd, generation_type generation) {
+  return (std::uint64_t{generation} << 32) | static_cast<std::uint32_t>(fd);
+}
+
+/// Extracts the descriptor from the user data of an epoll event.
+constexpr int event_fd(std::uint64_t data) {
+  return static_cast<int>(static_cast<std::uint32_t>(data));
+}
+
+/// Extracts the generation from the user data of an epoll event.
+constexpr generation_type event_generation(std::uint64_t data) {
+  return static_cast<generation_type>(data >> 32);
+}
+
+/// Checks whether the kernel implements epoll_pwait2.
+bool has_epoll_pwait2(int epoll_fd) {
+  epoll_event event{};
+  const timespec timeout{0, 0};
+  return (epoll_pwait2(epoll_fd, &event, 1, &timeout, nullptr) >= 0)
+         || (errno != ENOSYS);
+}
+
+/// Converts a duration to a timespec.
+timespec to_timespec(std::chrono::nanoseconds duration) {
+  const auto secs = std::chrono::duration_cast<std::chrono::seconds>(duration);
+  return timespec{secs.count(), (duration - secs).count()};
+}
+
+} // namespace
+
 epoll_multiplexer::~epoll_multiplexer() {
   LOG_TRACE();
+  if (uses_timerfd()) {
+    ::close(timer_fd_);
+  }
   ::close(mpx_fd_);
 }
 
@@ -51,6 +97,30 @@ util::error epoll_multiplexer::init(manager_factory factory,
             "[epoll_multiplexer]: Creating epoll fd failed"};
   }
   LOG_DEBUG("Created ", NET_ARG(mpx_fd_));
+  edge_triggered_ = cfg.get_or("multiplexer.edge-triggered", false);
+  fair_scheduling_ = cfg.get_or("multiplexer.fair-scheduling", false);
+  const auto max_ready_rounds = cfg.get_or("multiplexer.max-ready-rounds",
+                                           std::int64_t{1});
+  const auto min_batch_size = cfg.get_or(
+    "multiplexer.max-events", static_cast<std::int64_t>(max_events));
+  const auto batch_limit = cfg.get_or(
+    "multiplexer.max-events-limit",
+    static_cast<std::int64_t>(max_events_limit));
+  if ((max_ready_rounds <= 0) || (min_batch_size <= 0)
+      || (batch_limit < min_batch_size)) {
+    return {util::error_code::invalid_argument,
+            "[epoll_multiplexer]: invalid scheduling configuration"};
+  }
+  max_ready_rounds_ = static_cast<std::size_t>(max_ready_rounds);
+  min_batch_size_ = static_cast<std::size_t>(min_batch_size);
+  batch_size_ = min_batch_size_;
+  pollset_.resize(static_cast<std::size_t>(batch_limit));
+  if (cfg.get_or("multiplexer.use-timerfd", false)
+      || !has_epoll_pwait2(mpx_fd_)) {
+    if (auto err = init_timerfd()) {
+      return err;
+    }
+  }
 
   // TODO how to fix this sequence problem?
   if (auto err = multiplexer_base::init<event_handler>(
@@ -64,25 +134,56 @@ util::error epoll_multiplexer::init(manager_factory factory,
   return util::none;
 }
 
-using std::chrono::milliseconds;
-using std::chrono::steady_clock;
-using std::chrono::time_point_cast;
-
 // -- Interface functions ------------------------------------------------------
 
 void epoll_multiplexer::add(manager_base_ptr mgr, operation initial) {
-  mgr->mask_set(initial);
-  mod(mgr->handle().id, EPOLL_CTL_ADD, mgr->mask());
-  multiplexer_base::add(mgr);
+  if (!is_multiplexer_thread()) {
+    request_add(std::move(mgr), initial);
+    return;
+  }
+  attach(mgr, initial);
   if (auto err = mgr->init(cfg())) {
     handle_error(err);
   }
 }
 
+void epoll_multiplexer::detach(manager_base& mgr) {
+  // Pending events and ready list entries are dropped by the generation and
+  // registry checks of the handlers
+  mod(mgr.handle().id, EPOLL_CTL_DEL, operation::none);
+  auto& handler = static_cast<event_handler&>(mgr);
+  if (handler.ready_ops_ != operation::none) {
+    std::erase_if(ready_list_,
+                  [&handler](const auto& entry) {
+                    return entry.first.get() == &handler;
+                  });
+    handler.ready_ops_ = operation::none;
+  }
+  multiplexer_base::del(mgr.handle());
+}
+
+void epoll_multiplexer::attach(manager_base_ptr mgr, operation mask) {
+  mgr->mask_set(mask);
+  // Entries of a released manager may have been left on the ready list
+  static_cast<event_handler&>(*mgr).ready_ops_ = operation::none;
+  // Registering assigns the generation that is stored in the epoll event
+  const auto fd = mgr->handle().id;
+  multiplexer_base::add(std::move(mgr));
+  // In edge-triggered mode sockets are registered once for all events, the
+  // mask of the manager decides which events are dispatched. Sockets that are
+  // already ready are reported once registered
+  mod(fd, EPOLL_CTL_ADD, edge_triggered_ ? operation::read_write : mask);
+}
+
 void epoll_multiplexer::enable(manager_base& mgr, operation op) {
   if (!mgr.mask_add(op)) {
     return;
   }
+  if (edge_triggered_) {
+    // The edge may have passed while the operation was disabled
+    mark_ready(static_cast<event_handler&>(mgr), op);
+    return;
+  }
   mod(mgr.handle().id, EPOLL_CTL_MOD, mgr.mask());
 }
 
@@ -90,8 +191,10 @@ void epoll_multiplexer::disable(manager_base& mgr, operation op, bool remove) {
   if (!mgr.mask_del(op)) {
     return;
   }
-  mod(mgr.handle().id, EPOLL_CTL_MOD, mgr.mask());
-  if (remove && (mgr.mask() == operation::none)) {
+  if (!edge_triggered_) {
+    mod(mgr.handle().id, EPOLL_CTL_MOD, mgr.mask());
+  }
+  if (remove && (mgr.mask() == operation::none) && !mgr.reading_paused()) {
     del(mgr.handle());
   }
 }
@@ -106,10 +209,10 @@ void epoll_multiplexer::del(socket handle) {
 
 epoll_multiplexer::manager_map::iterator
 epoll_multiplexer::del(manager_map::iterator it) {
-  auto fd = it->second->handle().id;
+  auto fd = (*it)->handle().id;
   mod(fd, EPOLL_CTL_DEL, operation::none);
   auto new_it = multiplexer_base::del(it);
-  if (shutting_down_ && multiplexer_base::has_managers()) {
+  if (shutting_down_ && !multiplexer_base::has_managers()) {
     running_ = false;
   }
   return new_it;
@@ -131,31 +234,87 @@ void epoll_multiplexer::mod(int fd, int op, operation events) {
     }
   };
   epoll_event event{};
-  event.events = to_epoll_flag(events);
-  event.data.fd = fd;
+  event.events = to_epoll_flag(events)
+                 | (edge_triggered_ ? uint32_t{EPOLLET} : uint32_t{0});
+  event.data.u64 = to_event_data(fd, generation(socket{fd}));
+  ++num_pollset_updates_;
   if (epoll_ctl(mpx_fd_, op, fd, &event) < 0) {
     handle_error({util::error_code::runtime_error, "epoll_ctl: {0}",
                   util::last_error_as_string()});
   }
 }
 
+util::error epoll_multiplexer::init_timerfd() {
+  timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (timer_fd_ < 0) {
+    return {util::error_code::runtime_error, "timerfd_create: {0}",
+            util::last_error_as_string()};
+  }
+  // The timerfd has no manager, it is recognized by its descriptor alone
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.u64 = to_event_data(timer_fd_, 0);
+  if (epoll_ctl(mpx_fd_, EPOLL_CTL_ADD, timer_fd_, &event) < 0) {
+    return {util::error_code::runtime_error, "epoll_ctl: {0}",
+            util::last_error_as_string()};
+  }
+  LOG_DEBUG("Waiting for timeouts using ", NET_ARG(timer_fd_));
+  return util::none;
+}
+
+void epoll_multiplexer::arm_timer(steady_clock::time_point when) {
+  if (armed_timer_ == when) {
+    return;
+  }
+  // The steady clock is based on CLOCK_MONOTONIC
+  itimerspec spec{};
+  spec.it_value = to_timespec(when.time_since_epoch());
+  if (timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+    handle_error({util::error_code::runtime_error, "timerfd_settime: {0}",
+                  util::last_error_as_string()});
+    return;
+  }
+  armed_timer_ = when;
+}
+
+int epoll_multiplexer::wait_with_timerfd(
+  std::optional<std::chrono::nanoseconds> timeout) {
+  if (timeout && (timeout->count() == 0)) {
+    return epoll_wait(mpx_fd_, pollset_.data(), static_cast<int>(batch_size_),
+                      0);
+  }
+  // A pending timeout wakes the loop via the timerfd
+  if (timeout) {
+    arm_timer(*current_timeout_);
+  }
+  return epoll_wait(mpx_fd_, pollset_.data(), static_cast<int>(batch_size_),
+                    -1);
+}
+
 util::error epoll_multiplexer::poll_once(bool blocking) {
-  // Calculate the timeout value for the epoll call
-  int timeout = blocking ? -1 : 0;
-  if (blocking && current_timeout_.has_value()) {
-    const auto now = steady_clock::now();
-    if (now >= *current_timeout_) {
-      timeout = 0;
-    } else {
-      const auto diff = (*current_timeout_ - now);
-      const auto ms = std::chrono::ceil<std::chrono::milliseconds>(diff);
-      timeout = static_cast<int>(std::max(std::int64_t{0}, ms.count()));
-    }
+  using std::chrono::nanoseconds;
+  // Calculate the timeout value for the epoll call, none blocks indefinitely
+  // Managers on the ready list must not wait for further events
+  std::optional<nanoseconds> timeout;
+  if (!blocking || !ready_list_.empty()) {
+    timeout = nanoseconds{0};
+  } else if (current_timeout_.has_value()) {
+    timeout = std::max(nanoseconds{0},
+                       std::chrono::duration_cast<nanoseconds>(
+                         *current_timeout_ - steady_clock::now()));
   }
 
   // Poll for events on the reqistered sockets
-  auto num_events = epoll_wait(mpx_fd_, pollset_.data(),
-                               static_cast<int>(pollset_.size()), timeout);
+  stats_begin_wait();
+  int num_events = 0;
+  if (uses_timerfd()) {
+    num_events = wait_with_timerfd(timeout);
+  } else {
+    const auto ts = to_timespec(timeout.value_or(nanoseconds{0}));
+    num_events = epoll_pwait2(mpx_fd_, pollset_.data(),
+                              static_cast<int>(batch_size_),
+                              timeout ? &ts : nullptr, nullptr);
+  }
   // Check for errors
   if (num_events < 0) {
     return (errno == EINTR) ? util::none
@@ -163,44 +322,73 @@ util::error epoll_multiplexer::poll_once(bool blocking) {
                                           util::last_error_as_string()};
   }
   // Handle all timeouts and io-events that have been registered
+  update_loop_now();
   handle_timeouts();
+  stats_timeouts_handled();
   handle_events(event_span(pollset_.data(), static_cast<size_t>(num_events)));
+  // Busy managers take turns on the ready list, leftovers are handled after
+  // the next poll
+  for (std::size_t round = 0;
+       (round < max_ready_rounds_) && !ready_list_.empty(); ++round) {
+    handle_ready_list();
+  }
+  adapt_batch_size(static_cast<std::size_t>(num_events));
+  stats_end_iteration(static_cast<std::size_t>(num_events));
+  if (track_loop_lag_) {
+    record_loop_lag(steady_clock::now() - loop_now());
+  }
   return util::none;
 }
 
 void epoll_multiplexer::handle_events(event_span events) {
-  auto handle_result = [&](manager_base& mgr, manager_result res,
-                           operation op) -> bool {
-    if (res == manager_result::done) {
-      disable(mgr, op, true);
-    } else if (res == manager_result::error) {
-      del(mgr.handle());
-      return false;
-    }
-    return true;
-  };
-
+  // Hangups and errors must reach the reading handler when edge-triggered, as
+  // no further events will be reported for the socket
+  const uint32_t read_events = edge_triggered_
+                                 ? (EPOLLIN | EPOLLHUP | EPOLLERR)
+                                 : EPOLLIN;
   for (auto& event : events) {
+    const auto fd = event_fd(event.data.u64);
+    if (fd == timer_fd_) {
+      // Only wakes the loop, expired timeouts are handled every iteration
+      std::uint64_t num_expirations = 0;
+      if (::read(timer_fd_, &num_expirations, sizeof(num_expirations)) < 0) {
+        LOG_DEBUG("Reading the timerfd failed: ",
+                  util::last_error_as_string());
+      }
+      continue;
+    }
+    // Events of a removed manager may still be pending in the current batch,
+    // possibly for a descriptor that has been reused in the meantime
+    auto* mgr = manager<event_handler>(socket{fd},
+                                       event_generation(event.data.u64));
+    if (!mgr) {
+      LOG_DEBUG("Dropping stale event for socket = ", fd);
+      continue;
+    }
     if (event.events == (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) {
-      LOG_ERROR("epoll_wait failed on socket = ", event.data.fd, ": ",
+      LOG_ERROR("epoll_wait failed on socket = ", fd, ": ",
                 util::last_error_as_string());
-      del(socket{event.data.fd});
+      del(socket{fd});
       continue;
     } else {
-      auto* mgr = manager<event_handler>(net::socket{event.data.fd});
-      if (!mgr) {
-        LOG_ERROR("manager not found! This should never happen!");
-        continue;
-      }
-      // Handle possible read event
-      if ((event.events & EPOLLIN) == EPOLLIN) {
-        if (!handle_result(*mgr, mgr->handle_read_event(), operation::read)) {
+      // Handle possible read event. Managers on the ready list are handled
+      // there, as level-triggered sockets are reported again while ready
+      if (((event.events & read_events) != 0)
+          && !contains(mgr->ready_ops_, operation::read)
+          && (!edge_triggered_ || mgr->mask_contains(operation::read))) {
+        const auto res = invoke_handler(
+          *mgr, [mgr] { return mgr->handle_read_event(); });
+        if (!handle_result(*mgr, res, operation::read)) {
           continue;
         }
       }
       // Handle possible write event
-      if ((event.events & EPOLLOUT) == EPOLLOUT) {
-        if (!handle_result(*mgr, mgr->handle_write_event(), operation::read)) {
+      if (((event.events & EPOLLOUT) == EPOLLOUT)
+          && !contains(mgr->ready_ops_, operation::write)
+          && (!edge_triggered_ || mgr->mask_contains(operation::write))) {
+        const auto res = invoke_handler(
+          *mgr, [mgr] { return mgr->handle_write_event(); });
+        if (!handle_result(*mgr, res, operation::write)) {
           continue;
         }
       }
@@ -208,6 +396,78 @@ void epoll_multiplexer::handle_events(event_span events) {
   }
 }
 
+void epoll_multiplexer::handle_ready_list() {
+  // Managers marked ready while handling the list are handled in the next
+  // turn to give all other managers a chance to run first
+  ready_cache_.swap(ready_list_);
+  for (auto& [mgr, op] : ready_cache_) {
+    // Skip managers that have been removed in the meantime
+    if (manager<event_handler>(mgr->handle()) != mgr.get()) {
+      continue;
+    }
+    mgr->ready_ops_ = mgr->ready_ops_ & ~op;
+    if (contains(op, operation::read)
+        && mgr->mask_contains(operation::read)) {
+      const auto res = invoke_handler(
+        *mgr, [&mgr] { return mgr->handle_read_event(); });
+      if (!handle_result(*mgr, res, operation::read)) {
+        continue;
+      }
+    }
+    if (contains(op, operation::write)
+        && mgr->mask_contains(operation::write)) {
+      const auto res = invoke_handler(
+        *mgr, [&mgr] { return mgr->handle_write_event(); });
+      handle_result(*mgr, res, operation::write);
+    }
+  }
+  ready_cache_.clear();
+}
+
+void epoll_multiplexer::mark_ready(event_handler& mgr, operation op) {
+  if (contains(mgr.ready_ops_, op)) {
+    return;
+  }
+  mgr.ready_ops_ = mgr.ready_ops_ | op;
+  ready_list_.emplace_back(util::as_intrusive_ptr(mgr), op);
+}
+
+void epoll_multiplexer::adapt_batch_size(std::size_t num_events) {
+  // A full batch leaves events in the kernel for the next poll, while a
+  // mostly empty one only wastes space in the cache
+  if (num_events == batch_size_) {
+    batch_size_ = std::min(batch_size_ * 2, pollset_.size());
+  } else if (num_events < (batch_size_ / 4)) {
+    batch_size_ = std::max(batch_size_ / 2, min_batch_size_);
+  }
+}
+
+bool epoll_multiplexer::handle_result(event_handler& mgr, manager_result res,
+                                      operation op) {
+  switch (res) {
+    case manager_result::ok:
+      // The handler stopped before draining the socket. No further edge will
+      // be reported for the remaining data, and with fair scheduling the
+      // manager continues after all others had their turn
+      if (edge_triggered_ || fair_scheduling_) {
+        mark_ready(mgr, op);
+      }
+      return true;
+    case manager_result::done: {
+      const bool removed = ((mgr.mask() & ~op) == operation::none)
+                           && !mgr.reading_paused();
+      disable(mgr, op, true);
+      return !removed;
+    }
+    case manager_result::error:
+      del(mgr.handle());
+      return false;
+    case manager_result::temporary_error:
+    default:
+      return true;
+  }
+}
+
 } // namespace net::detail
 
 #endif
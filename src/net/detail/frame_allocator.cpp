@@ -0,0 +1,72 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      frame_allocator.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/frame_allocator.hpp"
+
+#include <new>
+
+namespace net::detail {
+
+frame_allocator::~frame_allocator() {
+  for (std::size_t i = 0; i < num_size_classes; ++i) {
+    auto* frame = classes_[i].head;
+    while (frame != nullptr) {
+      auto* next = frame->next;
+      ::operator delete(frame, (i + 1) * granularity);
+      frame = next;
+    }
+  }
+}
+
+frame_allocator& frame_allocator::local() noexcept {
+  thread_local frame_allocator allocator;
+  return allocator;
+}
+
+void* frame_allocator::allocate(std::size_t size) {
+  const auto idx = class_index(size);
+  if (idx >= num_size_classes) {
+    ++num_heap_allocations_;
+    return ::operator new(size);
+  }
+  auto& cls = classes_[idx];
+  if (cls.head != nullptr) {
+    ++num_reused_;
+    --cls.size;
+    auto* frame = cls.head;
+    cls.head = frame->next;
+    return frame;
+  }
+  ++num_heap_allocations_;
+  return ::operator new((idx + 1) * granularity);
+}
+
+void frame_allocator::deallocate(void* ptr, std::size_t size) noexcept {
+  const auto idx = class_index(size);
+  if (idx >= num_size_classes) {
+    ::operator delete(ptr, size);
+    return;
+  }
+  auto& cls = classes_[idx];
+  if (cls.size >= max_cached_frames) {
+    ::operator delete(ptr, (idx + 1) * granularity);
+    return;
+  }
+  cls.head = new (ptr) free_frame{cls.head};
+  ++cls.size;
+}
+
+std::size_t frame_allocator::num_cached() const noexcept {
+  std::size_t num = 0;
+  for (const auto& cls : classes_) {
+    num += cls.size;
+  }
+  return num;
+}
+
+} // namespace net::detail
@@ -17,7 +17,6 @@
 #  include "net/ip/v4_endpoint.hpp"
 #  include "net/manager_result.hpp"
 #  include "net/operation.hpp"
-#  include "net/socket/pipe_socket.hpp"
 #  include "net/socket/tcp_accept_socket.hpp"
 
 #  include "util/binary_serializer.hpp"
@@ -79,24 +78,33 @@ void kqueue_multiplexer::add(manager_base_ptr mgr, operation initial) {
   if (is_multiplexer_thread()) {
     LOG_DEBUG("Adding socket_manager with ", NET_ARG2("id", mgr->handle().id),
               " for ", NET_ARG(initial));
-    // Add the mgr to the pollset for both reading and writing and enable it for
-    // the initial operations
-    mod(mgr->handle().id, (EV_ADD | EV_DISABLE), operation::read_write);
-    enable(*mgr, initial);
-    auto& added_mgr = multiplexer_base::add(std::move(mgr));
+    attach(mgr, initial);
     // TODO: This should probably return an error instead of calling
     // handle_error
-    if (auto err = added_mgr->init(cfg())) {
+    if (auto err = mgr->init(cfg())) {
       handle_error(err);
     }
   } else {
-    LOG_DEBUG("Requesting to add socket_manager with ",
-              NET_ARG2("id", mgr->handle().id), " for ", NET_ARG(initial));
-    mgr->ref();
-    write_to_pipe(pollset_opcode::add, mgr.get(), initial);
+    request_add(std::move(mgr), initial);
   }
 }
 
+void kqueue_multiplexer::detach(manager_base& mgr) {
+  LOG_TRACE();
+  mod(mgr.handle().id, EV_DELETE, operation::read_write);
+  multiplexer_base::del(mgr.handle());
+}
+
+void kqueue_multiplexer::attach(manager_base_ptr mgr, operation mask) {
+  LOG_TRACE();
+  // Add the mgr to the pollset for both reading and writing and enable it for
+  // the given operations
+  mod(mgr->handle().id, (EV_ADD | EV_DISABLE), operation::read_write);
+  mgr->mask_set(operation::none);
+  enable(*mgr, mask);
+  multiplexer_base::add(std::move(mgr));
+}
+
 void kqueue_multiplexer::enable(manager_base& mgr, operation op) {
   LOG_TRACE();
   LOG_DEBUG("Enabling mgr with ", NET_ARG2("id", mgr->handle().id),
@@ -117,7 +125,7 @@ void kqueue_multiplexer::disable(manager_base& mgr, operation op, bool remove) {
     return;
   }
   mod(mgr.handle().id, EV_DISABLE, op);
-  if (remove && mgr.mask() == operation::none) {
+  if (remove && (mgr.mask() == operation::none) && !mgr.reading_paused()) {
     del(mgr.handle());
   }
 }
@@ -135,7 +143,7 @@ void kqueue_multiplexer::del(socket handle) {
 kqueue_multiplexer::manager_map::iterator
 kqueue_multiplexer::del(manager_map::iterator it) {
   LOG_TRACE();
-  auto fd = it->second->handle().id;
+  auto fd = (*it)->handle().id;
   LOG_DEBUG("Deleting mgr with ", NET_ARG2("id", fd));
   mod(fd, EV_DELETE, operation::read_write);
   auto new_it = multiplexer_base::del(it);
@@ -198,6 +206,7 @@ util::error kqueue_multiplexer::poll_once(bool blocking) {
   // actual timeout
   const auto* timeout_ptr = (blocking && !current_timeout_) ? nullptr
                                                             : &timeout;
+  stats_begin_wait();
   const int num_events = kevent(mpx_fd_, update_cache_.data(),
                                 static_cast<int>(update_cache_.size()),
                                 pollset_.data(),
@@ -211,8 +220,14 @@ util::error kqueue_multiplexer::poll_once(bool blocking) {
                                           util::last_error_as_string()};
   }
   // Handle all timeouts and io-events that have been registered
+  update_loop_now();
   handle_timeouts();
+  stats_timeouts_handled();
   handle_events(event_span(pollset_.data(), static_cast<size_t>(num_events)));
+  stats_end_iteration(static_cast<std::size_t>(num_events));
+  if (track_loop_lag_) {
+    record_loop_lag(steady_clock::now() - loop_now());
+  }
   return util::none;
 }
 
@@ -252,12 +267,18 @@ void kqueue_multiplexer::handle_events(event_span events) {
         case EVFILT_READ:
           LOG_DEBUG("Handling EVFILT_READ on manager with ",
                     NET_ARG2("id", handle.id));
-          handle_result(*mgr, mgr->handle_read_event(), operation::read);
+          handle_result(*mgr, invoke_handler(*mgr, [mgr] {
+                          return mgr->handle_read_event();
+                        }),
+                        operation::read);
           break;
         case EVFILT_WRITE:
           LOG_DEBUG("Handling EVFILT_WRITE on manager with ",
                     NET_ARG2("id", handle.id));
-          handle_result(*mgr, mgr->handle_write_event(), operation::write);
+          handle_result(*mgr, invoke_handler(*mgr, [mgr] {
+                          return mgr->handle_write_event();
+                        }),
+                        operation::write);
           break;
         default:
           LOG_WARNING("Event filter unknown");
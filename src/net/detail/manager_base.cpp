@@ -8,11 +8,13 @@
 
 #include "net/detail/manager_base.hpp"
 
+#include "net/detail/manager_pool.hpp"
 #include "net/detail/multiplexer_base.hpp"
 
 #include "net/manager_result.hpp"
 
 #include "util/assert.hpp"
+#include "util/cycle_clock.hpp"
 #include "util/error.hpp"
 #include "util/logger.hpp"
 
@@ -30,8 +32,40 @@ util::error manager_base::init(const util::config&) {
 
 manager_base::~manager_base() {
   LOG_TRACE();
+  release();
+}
+
+void manager_base::release() noexcept {
+  // Managers that were never added to the multiplexer may still own timeouts
+  if (!timeouts_.empty()) {
+    mpx_->cancel_timeouts(*this);
+  }
   shutdown(handle_, operation::read_write);
   close(handle_);
+  handle_ = invalid_socket;
+}
+
+void manager_base::dispose() noexcept {
+  auto pool = pool_.lock();
+  if (!pool) {
+    delete this;
+    return;
+  }
+  release();
+  handle_released();
+  if (!pool->put(*this)) {
+    delete this;
+  }
+}
+
+void manager_base::reset(socket handle) noexcept {
+  handle_ = handle;
+  mask_ = operation::none;
+  reading_paused_ = false;
+  nonblocking_ = false;
+  cpu_ticks_ = 0;
+  num_handler_calls_ = 0;
+  num_slow_handler_calls_ = 0;
 }
 
 bool manager_base::mask_add(operation flag) noexcept {
@@ -55,6 +89,7 @@ bool manager_base::mask_contains(operation flag) const noexcept {
 }
 
 void manager_base::register_reading() {
+  reading_paused_ = false;
   if ((mask() & operation::read) == operation::none) {
     mpx()->enable(*this, operation::read);
   }
@@ -66,6 +101,17 @@ void manager_base::register_writing() {
   }
 }
 
+void manager_base::pause_reading() {
+  if (mask_contains(operation::read)) {
+    reading_paused_ = true;
+    mpx()->disable(*this, operation::read, false);
+  }
+}
+
+void manager_base::deregister(operation op) {
+  mpx()->disable(*this, op, true);
+}
+
 uint64_t manager_base::set_timeout_in(std::chrono::steady_clock::duration in) {
   ASSERT(in >= std::chrono::steady_clock::duration{0});
   const auto when = std::chrono::steady_clock::now() + in;
@@ -77,12 +123,26 @@ manager_base::set_timeout_at(std::chrono::steady_clock::time_point when) {
   return mpx()->set_timeout(*this, when);
 }
 
+bool manager_base::cancel_timeout(uint64_t timeout_id) {
+  return mpx()->cancel_timeout(*this, timeout_id);
+}
+
+bool manager_base::reschedule_timeout(
+  uint64_t timeout_id, std::chrono::steady_clock::time_point when) {
+  return mpx()->reschedule_timeout(*this, timeout_id, when);
+}
+
 manager_result manager_base::handle_timeout(uint64_t) {
   LOG_ERROR("Default implementation, should never be called");
   ASSERT(false, "Timeout set without overriding the default timeout handler");
   return manager_result::error;
 }
 
+std::chrono::nanoseconds manager_base::cpu_time() const noexcept {
+  return (cpu_ticks_ == 0) ? std::chrono::nanoseconds{0}
+                           : util::cycle_clock::to_duration(cpu_ticks_);
+}
+
 void manager_base::handle_error(util::error err) const {
   mpx()->handle_error(std::move(err));
 }
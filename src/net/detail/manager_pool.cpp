@@ -0,0 +1,44 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      manager_pool.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/manager_pool.hpp"
+
+#include "net/detail/manager_base.hpp"
+
+#include "util/logger.hpp"
+
+namespace net::detail {
+
+manager_pool::manager_pool(std::size_t max_cached_per_type) noexcept
+  : max_cached_per_type_{max_cached_per_type} {
+  // nop
+}
+
+manager_pool::~manager_pool() {
+  for (auto& [type, mgrs] : cache_) {
+    for (auto* mgr : mgrs) {
+      delete mgr;
+    }
+  }
+}
+
+bool manager_pool::put(manager_base& mgr) {
+  if (std::this_thread::get_id() != owner_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  auto& mgrs = cache_[std::type_index{typeid(mgr)}];
+  if (mgrs.size() >= max_cached_per_type_) {
+    return false;
+  }
+  LOG_DEBUG("Caching released manager for reuse");
+  mgrs.push_back(&mgr);
+  ++num_cached_;
+  return true;
+}
+
+} // namespace net::detail
@@ -0,0 +1,48 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      manager_table.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/manager_table.hpp"
+
+#include "util/assert.hpp"
+
+#include <utility>
+
+namespace net::detail {
+
+manager_base_ptr& manager_table::emplace(manager_base_ptr mgr) {
+  const auto handle = mgr->handle().id;
+  ASSERT(handle >= 0, "Only valid sockets can be managed");
+  if (index(handle) >= slots_.size()) {
+    slots_.resize(index(handle) + 1);
+  }
+  auto& entry = slots_[index(handle)];
+  if (!entry.mgr) {
+    ++size_;
+  }
+  entry.mgr = std::move(mgr);
+  ++entry.generation;
+  return entry.mgr;
+}
+
+bool manager_table::erase(socket_id handle) noexcept {
+  if (!in_range(handle) || !slots_[index(handle)].mgr) {
+    return false;
+  }
+  // Clear the slot before the manager may be destroyed
+  auto mgr = std::move(slots_[index(handle)].mgr);
+  --size_;
+  return true;
+}
+
+manager_table::iterator manager_table::erase(iterator it) noexcept {
+  auto mgr = std::move(*it);
+  --size_;
+  return ++it;
+}
+
+} // namespace net::detail
@@ -11,17 +11,55 @@
 #include "net/detail/event_handler.hpp"
 #include "net/detail/pollset_updater.hpp"
 
+#include "net/socket/event_socket.hpp"
 #include "net/socket/tcp_accept_socket.hpp"
 
 #include "net/ip/v4_address.hpp"
 #include "net/ip/v4_endpoint.hpp"
 
+#include "net/timeout_entry.hpp"
+
+#include "util/assert.hpp"
 #include "util/config.hpp"
 #include "util/error_or.hpp"
+#include "util/intrusive_ptr.hpp"
 #include "util/logger.hpp"
+#include "util/mpsc_queue.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <thread>
 
 namespace net::detail {
 
+namespace {
+
+/// Set on threads running the event loop of a multiplexer.
+thread_local bool in_event_loop = false;
+
+} // namespace
+
+multiplexer_base::multiplexer_base()
+  : pool_{std::make_shared<manager_pool>(default_max_pooled_managers)},
+    commands_{
+      std::make_unique<command_queue>(default_command_queue_capacity)} {
+  // nop
+}
+
+multiplexer_base::~multiplexer_base() {
+  // Managers pushed after the updater was removed are still owned by the queue
+  pollset_command cmd;
+  while (commands_->try_pop(cmd)) {
+    if (cmd.code == pollset_opcode::add) {
+      auto mgr = util::make_intrusive(cmd.mgr, false);
+    }
+  }
+  if (wakeup_writer_ != invalid_socket) {
+    close(wakeup_writer_);
+  }
+}
+
 // -- Thread functions -------------------------------------------------------
 
 /// Creates a thread that runs this multiplexer indefinately.
@@ -30,13 +68,15 @@ void multiplexer_base::start() {
   if (!running_) {
     running_ = true;
     mpx_thread_ = std::thread(&multiplexer_base::run, this);
-    mpx_thread_id_ = mpx_thread_.get_id();
-    LOG_DEBUG(NET_ARG(mpx_thread_id_));
   }
 }
 
 void multiplexer_base::run() {
   LOG_TRACE();
+  set_thread_id(std::this_thread::get_id());
+  in_event_loop = true;
+  LOG_DEBUG(NET_ARG2("mpx_thread_id", std::this_thread::get_id()));
+  apply_placement();
   while (running_) {
     auto err = poll_once(true);
     if (err) {
@@ -45,6 +85,75 @@ void multiplexer_base::run() {
   }
 }
 
+util::error multiplexer_base::init_pool(const util::config& cfg) {
+  const auto max_pooled = cfg.get_or<std::int64_t>(
+    "multiplexer.max-pooled-managers",
+    static_cast<std::int64_t>(default_max_pooled_managers));
+  if (max_pooled < 0) {
+    return util::error{util::error_code::invalid_argument,
+                       "multiplexer.max-pooled-managers must not be negative"};
+  }
+  if (max_pooled == 0) {
+    pool_.reset();
+    return util::none;
+  }
+  pool_ = std::make_shared<manager_pool>(static_cast<std::size_t>(max_pooled));
+  pool_->set_owner(mpx_thread_id_.load(std::memory_order_relaxed));
+  return util::none;
+}
+
+util::error multiplexer_base::init_placement(const util::config& cfg) {
+  const auto affinity = cfg.get_or("multiplexer.cpu-affinity", std::string{});
+  if (!affinity.empty()) {
+    auto res = util::parse_cpu_list(affinity);
+    if (auto err = util::get_error(res)) {
+      return util::error{util::error_code::invalid_argument,
+                         "multiplexer.cpu-affinity: {0}", err->msg()};
+    }
+    cpu_affinity_ = std::move(std::get<util::cpu_list>(res));
+  }
+  // Negative values leave the memory policy untouched
+  const auto node = cfg.get_or<std::int64_t>("multiplexer.numa-node", -1);
+  if (node < 0) {
+    return util::none;
+  }
+  auto res = util::numa_node_cpus(static_cast<std::size_t>(node));
+  if (auto err = util::get_error(res)) {
+    return util::error{util::error_code::invalid_argument,
+                       "multiplexer.numa-node: {0}", err->msg()};
+  }
+  auto node_cpus = std::move(std::get<util::cpu_list>(res));
+  if (!cpu_affinity_.empty()) {
+    util::cpu_list cpus;
+    std::set_intersection(cpu_affinity_.begin(), cpu_affinity_.end(),
+                          node_cpus.begin(), node_cpus.end(),
+                          std::back_inserter(cpus));
+    if (cpus.empty()) {
+      return util::error{util::error_code::invalid_argument,
+                         "multiplexer.cpu-affinity contains no cpu of "
+                         "multiplexer.numa-node"};
+    }
+    node_cpus = std::move(cpus);
+  }
+  cpu_affinity_ = std::move(node_cpus);
+  numa_node_ = static_cast<std::size_t>(node);
+  return util::none;
+}
+
+void multiplexer_base::apply_placement() {
+  // Failing to pin the thread only degrades performance
+  if (!cpu_affinity_.empty()) {
+    if (auto err = util::pin_current_thread(cpu_affinity_)) {
+      LOG_ERROR("could not pin multiplexer thread: ", err);
+    }
+  }
+  if (numa_node_) {
+    if (auto err = util::prefer_numa_node(*numa_node_)) {
+      LOG_ERROR("could not set memory policy: ", err);
+    }
+  }
+}
+
 /// Shuts the multiplexer down!
 void multiplexer_base::shutdown() {
   LOG_TRACE();
@@ -53,29 +162,48 @@ void multiplexer_base::shutdown() {
     shutting_down_ = true;
     auto it = managers_.begin();
     while (it != managers_.end()) {
-      auto& mgr = it->second;
-      if (mgr->handle() != pipe_reader_) {
-        disable(*mgr, (operation::read_accept), false);
-        if (mgr->mask() == operation::none) {
-          it = del(it);
-        } else {
-          ++it;
-        }
+      auto& mgr = *it;
+      if (mgr->handle() == wakeup_reader_) {
+        ++it;
+        continue;
+      }
+      disable(*mgr, (operation::read_accept), false);
+      const auto num_bytes = mgr->num_enqueued_bytes();
+      if ((num_bytes > 0) && !mgr->mask_contains(operation::write)) {
+        // Queued data is flushed regardless of the current interest
+        enable(*mgr, operation::write);
+      }
+      if (mgr->mask() == operation::none) {
+        it = del(it);
       } else {
+        ++drain_stats_.num_managers;
+        drain_stats_.bytes_pending += num_bytes;
         ++it;
       }
     }
-    close(pipe_writer_);
-    pipe_writer_ = pipe_socket{};
-  } else if (!shutting_down_) {
-    LOG_DEBUG("requesting multiplexer shutdown");
-    auto res = write_to_pipe(pollset_opcode::shutdown, nullptr,
-                             operation::none);
-    if (res != 10) {
-      LOG_ERROR("could not write shutdown code to pipe: ",
+    if (drain_stats_.num_managers > 0) {
+      LOG_DEBUG("draining ", drain_stats_.num_managers, " managers with ",
+                drain_stats_.bytes_pending, " bytes");
+      if (drain_timeout_.count() == 0) {
+        close_draining_managers();
+      } else {
+        drain_deadline_ = std::chrono::steady_clock::now() + drain_timeout_;
+        current_timeout_ = current_timeout_
+                             ? std::min(*drain_deadline_, *current_timeout_)
+                             : drain_deadline_;
+      }
+    }
+    // Wake the pollset updater, which removes itself once shutting down.
+    // The write end stays open, other threads may still be notifying
+    commands_closed_.store(true);
+    if (!notify(wakeup_writer_)) {
+      LOG_ERROR("could not notify the pollset updater: ",
                 last_socket_error_as_string());
-      std::terminate(); // Can't be handled by shutting down, if shutdown fails.
     }
+  } else if (!shutting_down_) {
+    LOG_DEBUG("requesting multiplexer shutdown");
+    // Fails only if the multiplexer is already shutting down
+    push_command({pollset_opcode::shutdown, nullptr, operation::none});
   }
 }
 
@@ -88,12 +216,198 @@ void multiplexer_base::join() {
   }
 }
 
+// -- Task execution -----------------------------------------------------------
+
+bool multiplexer_base::post(task fn) {
+  if (!is_multiplexer_thread()) {
+    return push_command({pollset_opcode::run, nullptr, operation::none,
+                         std::move(fn)});
+  }
+  if (commands_closed_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  // Pushing to the queue could block the multiplexer thread while it is full
+  local_tasks_.emplace_back(std::move(fn));
+  if (!notified_.exchange(true) && !notify(wakeup_writer_)) {
+    LOG_ERROR("could not notify the pollset updater: ",
+              last_socket_error_as_string());
+  }
+  return true;
+}
+
+bool multiplexer_base::dispatch(task fn) {
+  if (!is_multiplexer_thread()) {
+    return post(std::move(fn));
+  }
+  fn();
+  return true;
+}
+
+void multiplexer_base::run_local_tasks() {
+  if (local_tasks_.empty()) {
+    return;
+  }
+  running_tasks_.swap(local_tasks_);
+  for (auto& fn : running_tasks_) {
+    fn();
+  }
+  running_tasks_.clear();
+}
+
+// -- Migration ----------------------------------------------------------------
+
+bool multiplexer_base::migrate(manager_base_ptr mgr, multiplexer_base& target) {
+  if (!supports_migration() || !target.supports_migration()
+      || !mgr->migratable()) {
+    return false;
+  }
+  if (&target == this) {
+    return true;
+  }
+  return post([this, mgr = std::move(mgr), target = &target]() mutable {
+    // The manager may have been removed while the task was pending
+    if (managers_.find(mgr->handle().id) == mgr.get()) {
+      migrate_now(std::move(mgr), *target);
+    }
+  });
+}
+
+bool multiplexer_base::migrate_managers(multiplexer_base& target,
+                                        std::size_t n) {
+  if (!supports_migration() || !target.supports_migration()) {
+    return false;
+  }
+  if ((&target == this) || (n == 0)) {
+    return true;
+  }
+  return post([this, target = &target, n] {
+    std::vector<manager_base_ptr> candidates;
+    for (const auto& mgr : managers_) {
+      if (mgr->migratable()) {
+        candidates.emplace_back(mgr);
+      }
+    }
+    const auto num = std::min(n, candidates.size());
+    if (profile_handlers_) {
+      std::partial_sort(candidates.begin(), candidates.begin() + num,
+                        candidates.end(),
+                        [](const auto& lhs, const auto& rhs) {
+                          return lhs->cpu_time() > rhs->cpu_time();
+                        });
+    }
+    for (std::size_t i = 0; i < num; ++i) {
+      migrate_now(std::move(candidates[i]), *target);
+    }
+  });
+}
+
+void multiplexer_base::detach(manager_base&) {
+  ASSERT(false, "multiplexer does not support migration");
+}
+
+void multiplexer_base::attach(manager_base_ptr, operation) {
+  ASSERT(false, "multiplexer does not support migration");
+}
+
+void multiplexer_base::migrate_now(manager_base_ptr mgr,
+                                   multiplexer_base& target) {
+  if (shutting_down_ || target.commands_closed_.load()) {
+    return;
+  }
+  [[maybe_unused]] const auto handle = mgr->handle();
+  LOG_DEBUG("Migrating mgr with ", NET_ARG2("id", handle.id));
+  const auto mask = mgr->mask();
+  auto timeouts = timeouts_.take_all(mgr->timeouts_);
+  detach(*mgr);
+  mgr->handle_detached();
+  // Handing the manager over via the command queue publishes the new owner
+  mgr->mpx_ = &target;
+  if (!mgr->pool_.expired()) {
+    mgr->pool_ = target.pool_;
+  }
+  target.num_pending_managers_.fetch_add(1, std::memory_order_relaxed);
+  auto adopt_task = [target = &target, mgr = std::move(mgr), mask,
+                     timeouts = std::move(timeouts)]() mutable {
+    target->num_pending_managers_.fetch_sub(1, std::memory_order_relaxed);
+    target->adopt(std::move(mgr), mask, std::move(timeouts));
+  };
+  if (!target.post(std::move(adopt_task))) {
+    // The target was shut down in the meantime or its queue stayed full, the
+    // manager is dropped
+    LOG_ERROR("could not migrate mgr with ", NET_ARG2("id", handle.id),
+              ", target multiplexer is shut down or busy");
+    target.num_pending_managers_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+void multiplexer_base::adopt(manager_base_ptr mgr, operation mask,
+                             std::vector<timeout_entry> timeouts) {
+  if (shutting_down_) {
+    LOG_DEBUG("Dropping mgr with ", NET_ARG2("id", mgr->handle().id),
+              " migrated during shutdown");
+    return;
+  }
+  auto& adopted = *mgr;
+  attach(std::move(mgr), mask);
+  for (const auto& entry : timeouts) {
+    // Keep the IDs the manager knows its timeouts by
+    timeouts_.insert(timeout_entry{entry.handle(), entry.when(), entry.id(),
+                                   &adopted},
+                     &adopted.timeouts_);
+    current_timeout_id_ = std::max(current_timeout_id_, entry.id() + 1);
+    current_timeout_ = current_timeout_
+                         ? std::min(entry.when(), *current_timeout_)
+                         : entry.when();
+  }
+  adopted.handle_attached();
+}
+
 bool multiplexer_base::is_running() const noexcept {
   return mpx_thread_.joinable();
 }
 
 void multiplexer_base::set_thread_id(std::thread::id tid) noexcept {
-  mpx_thread_id_ = tid;
+  mpx_thread_id_.store(tid, std::memory_order_relaxed);
+  if (pool_) {
+    pool_->set_owner(tid);
+  }
+}
+
+// -- Event handling -----------------------------------------------------------
+
+void multiplexer_base::request_add(manager_base_ptr mgr, operation initial) {
+  LOG_DEBUG("Requesting to add socket_manager with ",
+            NET_ARG2("id", mgr->handle().id), " for ", NET_ARG(initial));
+  num_pending_managers_.fetch_add(1, std::memory_order_relaxed);
+  auto* raw_mgr = mgr.release();
+  if (!push_command({pollset_opcode::add, raw_mgr, initial})) {
+    LOG_ERROR("could not add manager, multiplexer is shutting down or busy");
+    num_pending_managers_.fetch_sub(1, std::memory_order_relaxed);
+    // Reclaim the reference released above and drop the manager
+    mgr = util::make_intrusive(raw_mgr, false);
+  }
+}
+
+bool multiplexer_base::push_command(pollset_command cmd) {
+  for (std::size_t attempt = 1;
+       !commands_closed_.load(std::memory_order_relaxed); ++attempt) {
+    if (commands_->try_push(std::move(cmd))) {
+      // Only the first command after the updater drained the queue needs to
+      // wake the multiplexer, later ones are picked up by the same wakeup
+      if (!notified_.exchange(true) && !notify(wakeup_writer_)) {
+        LOG_ERROR("could not notify the pollset updater: ",
+                  last_socket_error_as_string());
+      }
+      return true;
+    }
+    if (in_event_loop && (attempt >= max_push_attempts)) {
+      LOG_ERROR("could not push command, the command queue is full");
+      return false;
+    }
+    // The queue is full, wait for the multiplexer to catch up
+    std::this_thread::yield();
+  }
+  return false;
 }
 
 // -- Timeout management -------------------------------------------------------
@@ -104,41 +418,115 @@ multiplexer_base::set_timeout(manager_base& mgr,
   LOG_TRACE();
   LOG_DEBUG("Setting timeout ", current_timeout_id_, " on ",
             NET_ARG2("mgr", mgr.handle().id));
-  timeouts_.emplace(mgr.handle().id, when, current_timeout_id_);
+  timeouts_.insert(
+    timeout_entry{mgr.handle().id, when, current_timeout_id_, &mgr},
+    &mgr.timeouts_);
   current_timeout_ = current_timeout_ ? std::min(when, *current_timeout_)
                                       : when;
   return current_timeout_id_++;
 }
 
+bool multiplexer_base::cancel_timeout(manager_base& mgr, std::uint64_t id) {
+  LOG_DEBUG("Cancelling timeout ", id, " on ",
+            NET_ARG2("mgr", mgr.handle().id));
+  // The next timeout is updated lazily by handle_timeouts
+  return timeouts_.cancel(mgr.timeouts_, id);
+}
+
+bool multiplexer_base::reschedule_timeout(
+  manager_base& mgr, std::uint64_t id,
+  std::chrono::steady_clock::time_point when) {
+  if (!timeouts_.reschedule(mgr.timeouts_, id, when)) {
+    return false;
+  }
+  current_timeout_ = current_timeout_ ? std::min(when, *current_timeout_)
+                                      : when;
+  return true;
+}
+
+void multiplexer_base::cancel_timeouts(manager_base& mgr) noexcept {
+  timeouts_.cancel_all(mgr.timeouts_);
+}
+
 void multiplexer_base::handle_timeouts() {
   LOG_TRACE();
-  // Swap with cached set to reuse allocated memory
-  cached_timeouts_.swap(timeouts_);
-
-  // Process all expired timeouts and collect unhandled ones
-  auto it = cached_timeouts_.begin();
-  while (it != cached_timeouts_.end()) {
-    if (it->has_expired()) {
-      // Registered timeout has expired
-      auto& mgr = managers_.at(it->handle());
-      mgr->handle_timeout(it->id());
+  if (!current_timeout_ || (*current_timeout_ > loop_now_)) {
+    return;
+  }
+  if (drain_deadline_ && (*drain_deadline_ <= loop_now_)) {
+    drain_deadline_.reset();
+    close_draining_managers();
+  }
+  timeouts_.expire(loop_now_, [this](const timeout_entry& entry) {
+    // The handler may remove the manager, keep it alive until it returns
+    auto mgr = util::as_intrusive_ptr(*entry.manager());
+    invoke_handler(*mgr, [&] { return mgr->handle_timeout(entry.id()); });
+  });
+
+  // Update current timeout to the next expiring timeout, if any
+  current_timeout_ = timeouts_.next_expiry();
+  if (drain_deadline_) {
+    current_timeout_ = current_timeout_
+                         ? std::min(*drain_deadline_, *current_timeout_)
+                         : drain_deadline_;
+  }
+  if (!current_timeout_) {
+    LOG_DEBUG("No further timeouts registered");
+  }
+}
+
+void multiplexer_base::close_draining_managers() {
+  auto it = managers_.begin();
+  while (it != managers_.end()) {
+    if ((*it)->handle() == wakeup_reader_) {
       ++it;
-    } else {
-      break;
+      continue;
     }
+    ++drain_stats_.num_closed;
+    drain_stats_.bytes_dropped += (*it)->num_enqueued_bytes();
+    it = del(it);
   }
+  LOG_WARNING("closed ", drain_stats_.num_closed,
+              " managers after the drain timeout, dropping ",
+              drain_stats_.bytes_dropped, " bytes");
+}
 
-  // Move unhandled timeouts back with any newly added timeouts
-  timeouts_.insert(it, cached_timeouts_.end());
-  cached_timeouts_.clear();
+// -- Instrumentation ----------------------------------------------------------
 
-  // Update current timeout to the next expiring timeout, if any
-  if (timeouts_.empty()) {
-    LOG_DEBUG("No further timeouts registered");
-    current_timeout_ = std::nullopt;
+std::vector<manager_cost> multiplexer_base::most_expensive_managers(
+  std::size_t k) {
+  std::vector<manager_cost> costs;
+  costs.reserve(managers_.size());
+  for (const auto& mgr : managers_) {
+    if (mgr->num_handler_calls() > 0) {
+      costs.push_back({mgr->handle(), mgr->cpu_time(),
+                       mgr->num_handler_calls(),
+                       mgr->num_slow_handler_calls()});
+    }
+  }
+  const auto num = std::min(k, costs.size());
+  std::partial_sort(costs.begin(), costs.begin() + num, costs.end(),
+                    [](const manager_cost& lhs, const manager_cost& rhs) {
+                      return lhs.cpu_time > rhs.cpu_time;
+                    });
+  costs.resize(num);
+  return costs;
+}
+
+void multiplexer_base::account_handler(manager_base& mgr,
+                                       std::uint64_t ticks) {
+  mgr.cpu_ticks_ += ticks;
+  ++mgr.num_handler_calls_;
+  if ((handler_budget_ == 0) || (ticks <= handler_budget_)) {
+    return;
+  }
+  ++mgr.num_slow_handler_calls_;
+  const auto elapsed = util::cycle_clock::to_duration(ticks);
+  if (slow_handler_callback_) {
+    slow_handler_callback_(mgr, elapsed);
   } else {
-    LOG_DEBUG("Next timeout with ", NET_ARG2("id", timeouts_.begin()->id()));
-    current_timeout_ = timeouts_.begin()->when();
+    LOG_WARNING("Handler of ", NET_ARG2("socket", mgr.handle().id),
+                " exceeded its budget: ", elapsed.count(), "ns");
   }
 }
 
@@ -0,0 +1,68 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      multiplexer_stats.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/multiplexer_stats.hpp"
+
+#include "util/histogram.hpp"
+
+namespace net::detail {
+
+namespace {
+
+std::uint64_t to_ns(multiplexer_stats::clock_type::duration d) noexcept {
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d);
+  return (ns.count() > 0) ? static_cast<std::uint64_t>(ns.count()) : 0;
+}
+
+} // namespace
+
+void multiplexer_stats::record(const iteration& it) noexcept {
+  util::increment(num_iterations_, 1);
+  util::increment(num_events_, it.num_events);
+  util::increment(num_accepted_, accepted_);
+  util::increment(num_rejected_, rejected_);
+  util::increment(bytes_read_total_, bytes_read_);
+  util::increment(bytes_written_total_, bytes_written_);
+  events_per_iteration_.record(it.num_events);
+  blocked_ns_.record(to_ns(it.blocked));
+  timeouts_ns_.record(to_ns(it.timeouts));
+  events_ns_.record(to_ns(it.events));
+  bytes_read_per_iteration_.record(bytes_read_);
+  bytes_written_per_iteration_.record(bytes_written_);
+  discard();
+}
+
+multiplexer_stats::snapshot multiplexer_stats::read() const noexcept {
+  snapshot result;
+  result.time = clock_type::now();
+  result.num_iterations = num_iterations_.load(std::memory_order_relaxed);
+  result.num_events = num_events_.load(std::memory_order_relaxed);
+  result.num_accepted = num_accepted_.load(std::memory_order_relaxed);
+  result.num_rejected = num_rejected_.load(std::memory_order_relaxed);
+  result.bytes_read = bytes_read_total_.load(std::memory_order_relaxed);
+  result.bytes_written = bytes_written_total_.load(std::memory_order_relaxed);
+  result.events_per_iteration = events_per_iteration_.read();
+  result.blocked_ns = blocked_ns_.read();
+  result.timeouts_ns = timeouts_ns_.read();
+  result.events_ns = events_ns_.read();
+  result.bytes_read_per_iteration = bytes_read_per_iteration_.read();
+  result.bytes_written_per_iteration = bytes_written_per_iteration_.read();
+  return result;
+}
+
+double accepts_per_second(const multiplexer_stats::snapshot& before,
+                          const multiplexer_stats::snapshot& after) noexcept {
+  const std::chrono::duration<double> elapsed = after.time - before.time;
+  if (elapsed.count() <= 0) {
+    return 0;
+  }
+  return static_cast<double>(after.num_accepted - before.num_accepted)
+         / elapsed.count();
+}
+
+} // namespace net::detail
@@ -15,46 +15,73 @@
 #  include "net/detail/uring_multiplexer.hpp"
 #endif
 
-#include "net/socket/pipe_socket.hpp"
+#include "net/socket/event_socket.hpp"
 
+#include "util/intrusive_ptr.hpp"
 #include "util/logger.hpp"
+#include "util/mpsc_queue.hpp"
 
-#include <sys/socket.h>
+#include <atomic>
 #include <sys/uio.h>
+#include <utility>
 
 namespace net::detail {
 
 // -- pollset_updater_base implementation --------------------------------------
 
 template <class ManagerBase>
-pollset_updater_base<ManagerBase>::pollset_updater_base(net::pipe_socket handle,
-                                                        multiplexer_base* mpx)
+pollset_updater_base<ManagerBase>::pollset_updater_base(
+  net::event_socket handle, multiplexer_base* mpx)
   : ManagerBase{handle, mpx} {
   LOG_TRACE();
-  // Add the different parts of the message to the iovecs for reading at once
-  iov_[0] = iovec{.iov_base = &code_, .iov_len = sizeof(code_)};
-  iov_[1] = iovec{.iov_base = &mgr_, .iov_len = sizeof(mgr_)};
-  iov_[2] = iovec{.iov_base = &op_, .iov_len = sizeof(op_)};
-  // Create a msghdr struct for use in recvmsg
-  msg_ = {}; // Zero-initialize
-  msg_.msg_iov = iov_.data();
-  msg_.msg_iovlen = iov_.size();
 }
 
 template <class ManagerBase>
-manager_result pollset_updater_base<ManagerBase>::handle_operation() {
-  switch (code_) {
-    case pollset_opcode::add:
+manager_result pollset_updater_base<ManagerBase>::handle_commands() {
+  auto* mpx = manager_base::mpx();
+  // Producers only signal the event socket if this flag was unset. Resetting
+  // it before draining ensures that commands pushed after the queue was found
+  // empty signal the event socket again
+  mpx->notified_.exchange(false);
+  pollset_command cmd;
+  while (mpx->commands_->try_pop(cmd)) {
+    if (const auto res = handle_operation(cmd); res != manager_result::ok) {
+      return res;
+    }
+  }
+  mpx->run_local_tasks();
+  return mpx->shutting_down() ? manager_result::done : manager_result::ok;
+}
+
+template <class ManagerBase>
+manager_result
+pollset_updater_base<ManagerBase>::handle_operation(pollset_command& cmd) {
+  auto* mpx = manager_base::mpx();
+  switch (cmd.code) {
+    case pollset_opcode::add: {
       LOG_DEBUG("Received opcode::add for mgr with ",
-                NET_ARG2("id", mgr->handle().id), " with ", NET_ARG(op_));
-      manager_base::mpx()->add(util::make_intrusive(mgr_, false), op_);
+                NET_ARG2("id", cmd.mgr->handle().id), " with ",
+                NET_ARG2("op", cmd.op));
+      mpx->num_pending_managers_.fetch_sub(1, std::memory_order_relaxed);
+      auto mgr = util::make_intrusive(cmd.mgr, false);
+      if (mpx->shutting_down()) {
+        LOG_DEBUG("Dropping mgr with ", NET_ARG2("id", mgr->handle().id),
+                  " added during shutdown");
+        return manager_result::ok;
+      }
+      mpx->add(std::move(mgr), cmd.op);
       return manager_result::ok;
+    }
 
     case pollset_opcode::shutdown:
       LOG_DEBUG("Received opcode::shutdown");
-      manager_base::mpx()->shutdown();
+      mpx->shutdown();
       return manager_result::done;
 
+    case pollset_opcode::run:
+      std::exchange(cmd.fn, nullptr)();
+      return manager_result::ok;
+
     default:
       LOG_WARNING("Received unhandled code");
       return manager_result::error;
@@ -65,24 +92,28 @@ manager_result pollset_updater_base<ManagerBase>::handle_operation() {
 
 manager_result pollset_updater<event_handler>::handle_read_event() {
   LOG_TRACE();
-  // TODO Recvmsg?
-  if (const auto res = net::readv(handle<pipe_socket>(), base::iov_);
-      res != pollset_updater_base::message_size) {
-    LOG_ERROR("Could not read ", pollset_message_size,
-              " bytes from pipe socket: ", net::last_socket_error_as_string());
+  if (!net::drain(handle<event_socket>())) {
+    LOG_ERROR("Could not read from event socket: ",
+              net::last_socket_error_as_string());
     return manager_result::error;
   }
-  return base::handle_operation();
+  const auto res = handle_commands();
+  // The event socket was read until EAGAIN, so the next event is reported
+  if (requeued_on_ok() && (res == manager_result::ok)) {
+    return manager_result::temporary_error;
+  }
+  return res;
 }
 
 #if defined(LIB_NET_URING)
 
 // -- pollset_updater<uring_manager> implementation (io_uring) -----------------
 
-pollset_updater<uring_manager>::pollset_updater(net::pipe_socket handle,
+pollset_updater<uring_manager>::pollset_updater(net::event_socket handle,
                                                 multiplexer_base* mpx)
   : pollset_updater_base{handle, mpx} {
-  // nop
+  wakeup_iov_ = iovec{.iov_base = &wakeup_value_,
+                      .iov_len = sizeof(wakeup_value_)};
 }
 
 manager_result pollset_updater<uring_manager>::enable(operation op) {
@@ -92,9 +123,7 @@ manager_result pollset_updater<uring_manager>::enable(operation op) {
     return manager_result::error;
   }
   mask_add(operation::read);
-  auto [success, submission_id]
-    = manager_base::mpx<uring_multiplexer>()->submit_readv(*this, iov_);
-  return success ? manager_result::ok : manager_result::error;
+  return submit_read() ? manager_result::ok : manager_result::error;
 }
 
 manager_result
@@ -105,22 +134,25 @@ pollset_updater<uring_manager>::handle_completion(operation op, int res,
     return manager_result::error;
   }
 
-  if (res != message_size) {
-    LOG_ERROR("Not enough bytes for pollset updater to use");
+  if (res <= 0) {
+    LOG_ERROR("Could not read from event socket: ", NET_ARG(res));
     return manager_result::error;
   }
 
-  const auto handle_res = base::handle_operation();
-  if (handle_res == manager_result::ok) {
-    auto [success, submission_id]
-      = manager_base::mpx<uring_multiplexer>()->submit_readv(*this, iov_);
-    if (!success) {
-      return manager_result::error;
-    }
+  const auto handle_res = handle_commands();
+  if ((handle_res == manager_result::ok) && !submit_read()) {
+    return manager_result::error;
   }
   return handle_res;
 }
 
+bool pollset_updater<uring_manager>::submit_read() {
+  auto [success, submission_id]
+    = manager_base::mpx<uring_multiplexer>()->submit_readv(
+      *this, std::span{&wakeup_iov_, 1});
+  return success;
+}
+
 #endif // LIB_NET_URING
 
 // -- Explicit template instantiations -----------------------------------------
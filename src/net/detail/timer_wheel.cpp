@@ -0,0 +1,308 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      timer_wheel.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/timer_wheel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <utility>
+
+namespace net::detail {
+
+namespace {
+
+constexpr std::uint64_t slot_mask = timer_wheel::num_slots - 1;
+
+/// Number of ticks covered by all levels of the wheel.
+constexpr std::uint64_t wheel_range
+  = std::uint64_t{1} << (timer_wheel::slot_bits * timer_wheel::num_levels);
+
+/// Returns the level a timer at `tick` belongs to when the wheel is at
+/// `elapsed`, i.e. the level of the most significant differing slot bits.
+std::size_t level_for(std::uint64_t elapsed, std::uint64_t tick) noexcept {
+  const auto masked = (elapsed ^ tick) | slot_mask;
+  const auto significant = 63 - std::countl_zero(masked);
+  return static_cast<std::size_t>(significant) / timer_wheel::slot_bits;
+}
+
+} // namespace
+
+timer_wheel::timer_wheel(duration resolution, time_point origin)
+  : resolution_{std::max(resolution, duration{1})}, origin_{origin} {
+  // nop
+}
+
+// -- scheduling ---------------------------------------------------------------
+
+void timer_wheel::insert(const timeout_entry& entry, timer_list* owner) {
+  auto* n = acquire();
+  n->entry = entry;
+  n->owner = owner;
+  if (owner != nullptr) {
+    n->owner_next = std::exchange(owner->head_, n);
+    if (n->owner_next != nullptr) {
+      n->owner_next->owner_prev = n;
+    }
+  }
+  link(n);
+  ++size_;
+}
+
+bool timer_wheel::cancel(timer_list& owner,
+                         timeout_entry::timeout_id id) noexcept {
+  auto* n = find(owner, id);
+  if (n == nullptr) {
+    return false;
+  }
+  erase(n);
+  return true;
+}
+
+bool timer_wheel::reschedule(timer_list& owner, timeout_entry::timeout_id id,
+                             time_point when) noexcept {
+  auto* n = find(owner, id);
+  if (n == nullptr) {
+    return false;
+  }
+  // Expiring nodes are skipped by expire() once they are scheduled again
+  if (n->state == node_state::scheduled) {
+    unlink(n);
+  }
+  n->entry = timeout_entry{n->entry.handle(), when, id, n->entry.manager()};
+  link(n);
+  return true;
+}
+
+std::size_t timer_wheel::cancel_all(timer_list& owner) noexcept {
+  std::size_t num_cancelled = 0;
+  while (owner.head_ != nullptr) {
+    erase(owner.head_);
+    ++num_cancelled;
+  }
+  return num_cancelled;
+}
+
+std::vector<timeout_entry> timer_wheel::take_all(timer_list& owner) {
+  std::vector<timeout_entry> entries;
+  while (owner.head_ != nullptr) {
+    entries.push_back(owner.head_->entry);
+    erase(owner.head_);
+  }
+  return entries;
+}
+
+void timer_wheel::clear() noexcept {
+  for (std::size_t lvl = 0; lvl < num_levels; ++lvl) {
+    for (std::size_t slot = 0; slot < num_slots; ++slot) {
+      auto* n = take(lvl, slot);
+      while (n != nullptr) {
+        auto* next = n->next;
+        unlink_owner(n);
+        release(n);
+        n = next;
+      }
+    }
+  }
+}
+
+// -- properties ---------------------------------------------------------------
+
+std::optional<timer_wheel::time_point>
+timer_wheel::next_expiry() const noexcept {
+  const auto next = next_expiration();
+  if (!next) {
+    return std::nullopt;
+  }
+  if (next->level != 0) {
+    // Timers on upper levels are only cascaded at the start of their slot
+    return origin_ + (resolution_ * next->tick);
+  }
+  // All timers of a slot on the lowest level share the same tick
+  auto when = time_point::max();
+  for (auto* n = levels_[0].slots[next->slot]; n != nullptr; n = n->next) {
+    when = std::min(when, n->entry.when());
+  }
+  return when;
+}
+
+// -- private member functions -------------------------------------------------
+
+void timer_wheel::collect_expired(time_point now) {
+  const auto now_tick = to_tick(now);
+  for (auto next = next_expiration(); next && (next->tick <= now_tick);
+       next = next_expiration()) {
+    elapsed_ = next->tick;
+    auto* n = take(next->level, next->slot);
+    while (n != nullptr) {
+      auto* following = n->next;
+      if (next->level != 0) {
+        // Cascade to a lower level relative to the start of the slot
+        link(n);
+      } else if (n->entry.has_expired(now)) {
+        n->state = node_state::expiring;
+        expired_.push_back(n);
+      } else {
+        // Due later within the current tick
+        pending_.push_back(n);
+      }
+      n = following;
+    }
+  }
+  elapsed_ = std::max(elapsed_, now_tick);
+  for (auto* n : pending_) {
+    link(n);
+  }
+  pending_.clear();
+  std::sort(expired_.begin(), expired_.end(), [](const node* lhs,
+                                                 const node* rhs) {
+    return std::pair{lhs->entry.when(), lhs->entry.id()}
+           < std::pair{rhs->entry.when(), rhs->entry.id()};
+  });
+}
+
+std::optional<timer_wheel::expiration>
+timer_wheel::next_expiration() const noexcept {
+  std::optional<expiration> result;
+  for (std::size_t lvl = 0; lvl < num_levels; ++lvl) {
+    const auto shift = lvl * slot_bits;
+    const auto level_range = std::uint64_t{num_slots} << shift;
+    const auto current = static_cast<std::size_t>((elapsed_ >> shift)
+                                                  & slot_mask);
+    // Occupied slots never lie before the current slot of their level
+    const auto& occupied = levels_[lvl].occupied;
+    for (auto word = current / 64; word < occupied.size(); ++word) {
+      auto bits = occupied[word];
+      if (word == current / 64) {
+        bits &= (std::numeric_limits<std::uint64_t>::max() << (current % 64));
+      }
+      if (bits == 0) {
+        continue;
+      }
+      const auto slot = (word * 64)
+                        + static_cast<std::size_t>(std::countr_zero(bits));
+      const auto tick = (elapsed_ & ~(level_range - 1))
+                        + (std::uint64_t{slot} << shift);
+      // Lower levels win ties, their timers are due first
+      if (!result || (tick < result->tick)) {
+        result = expiration{lvl, slot, tick};
+      }
+      break;
+    }
+  }
+  return result;
+}
+
+std::uint64_t timer_wheel::to_tick(time_point when) const noexcept {
+  if (when <= origin_) {
+    return 0;
+  }
+  return static_cast<std::uint64_t>((when - origin_) / resolution_);
+}
+
+void timer_wheel::link(node* n) noexcept {
+  // Deadlines beyond the range of the wheel are parked in the last slot of
+  // the current range and relinked once it is reached
+  const auto max_tick = elapsed_ | (wheel_range - 1);
+  const auto tick = std::clamp(to_tick(n->entry.when()), elapsed_, max_tick);
+  const auto lvl = level_for(elapsed_, tick);
+  const auto slot = static_cast<std::size_t>((tick >> (lvl * slot_bits))
+                                             & slot_mask);
+  auto& head = levels_[lvl].slots[slot];
+  n->state = node_state::scheduled;
+  n->level = static_cast<std::uint8_t>(lvl);
+  n->slot = static_cast<std::uint8_t>(slot);
+  n->prev = nullptr;
+  n->next = head;
+  if (head != nullptr) {
+    head->prev = n;
+  }
+  head = n;
+  levels_[lvl].occupied[slot / 64] |= (std::uint64_t{1} << (slot % 64));
+}
+
+void timer_wheel::unlink(node* n) noexcept {
+  auto& lvl = levels_[n->level];
+  if (n->prev != nullptr) {
+    n->prev->next = n->next;
+  } else {
+    lvl.slots[n->slot] = n->next;
+  }
+  if (n->next != nullptr) {
+    n->next->prev = n->prev;
+  }
+  if (lvl.slots[n->slot] == nullptr) {
+    lvl.occupied[n->slot / 64] &= ~(std::uint64_t{1} << (n->slot % 64));
+  }
+  n->prev = nullptr;
+  n->next = nullptr;
+}
+
+timer_wheel::node* timer_wheel::take(std::size_t lvl,
+                                     std::size_t slot) noexcept {
+  levels_[lvl].occupied[slot / 64] &= ~(std::uint64_t{1} << (slot % 64));
+  return std::exchange(levels_[lvl].slots[slot], nullptr);
+}
+
+void timer_wheel::unlink_owner(node* n) noexcept {
+  if (n->owner == nullptr) {
+    return;
+  }
+  if (n->owner_prev != nullptr) {
+    n->owner_prev->owner_next = n->owner_next;
+  } else {
+    n->owner->head_ = n->owner_next;
+  }
+  if (n->owner_next != nullptr) {
+    n->owner_next->owner_prev = n->owner_prev;
+  }
+  n->owner_prev = nullptr;
+  n->owner_next = nullptr;
+  n->owner = nullptr;
+}
+
+timer_wheel::node* timer_wheel::find(const timer_list& owner,
+                                     timeout_entry::timeout_id id) noexcept {
+  for (auto* n = owner.head_; n != nullptr; n = n->owner_next) {
+    if (n->entry.id() == id) {
+      return n;
+    }
+  }
+  return nullptr;
+}
+
+void timer_wheel::erase(node* n) noexcept {
+  unlink_owner(n);
+  if (n->state == node_state::expiring) {
+    // Still referenced by expire(), which releases it
+    n->state = node_state::cancelled;
+    return;
+  }
+  unlink(n);
+  release(n);
+}
+
+timer_wheel::node* timer_wheel::acquire() {
+  if (free_list_ == nullptr) {
+    auto chunk = std::make_unique<node[]>(chunk_size);
+    for (std::size_t i = 0; i < chunk_size; ++i) {
+      chunk[i].next = free_list_;
+      free_list_ = &chunk[i];
+    }
+    chunks_.emplace_back(std::move(chunk));
+  }
+  return std::exchange(free_list_, free_list_->next);
+}
+
+void timer_wheel::release(node* n) noexcept {
+  n->prev = nullptr;
+  n->next = std::exchange(free_list_, n);
+  --size_;
+}
+
+} // namespace net::detail
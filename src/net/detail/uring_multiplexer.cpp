@@ -30,32 +30,33 @@
 #  include "util/logger.hpp"
 
 #  include <algorithm>
+#  include <bit>
 #  include <csignal>
 #  include <cstring>
+#  include <limits>
 #  include <iostream>
+#  include <optional>
 #  include <poll.h>
 #  include <sys/socket.h>
+#  include <sys/uio.h>
 #  include <unistd.h>
 #  include <utility>
-
-namespace {
-
-struct submission_data {
-  net::detail::uring_manager_ptr mgr;
-  net::operation op;
-  std::uint64_t id;
-  bool multishot;
-};
-
-} // namespace
+#  include <vector>
 
 namespace net::detail {
 
 uring_multiplexer::~uring_multiplexer() {
   LOG_TRACE();
+  if (buf_ring_ != nullptr) {
+    io_uring_free_buf_ring(&uring_, buf_ring_, num_provided_buffers_,
+                           provided_buffer_group);
+  }
   if (initialized_) {
     io_uring_queue_exit(&uring_);
   }
+  // Operations still in flight have been cancelled with the ring
+  submissions_.for_each(
+    [](submission& sub) { release_submission(*sub.mgr); });
 }
 
 util::error uring_multiplexer::init(manager_factory factory,
@@ -74,6 +75,22 @@ util::error uring_multiplexer::init(manager_factory factory,
             "[uring_multiplexer]: initializing uring failed"};
   }
   LOG_DEBUG("Created io_uring with depth ", NET_ARG(max_uring_depth));
+  auto err = init_provided_buffers(cfg);
+  if (!err) {
+    err = init_fixed_files(cfg);
+  }
+  if (!err) {
+    err = init_fixed_buffers(cfg);
+  }
+  if (err) {
+    if (buf_ring_ != nullptr) {
+      io_uring_free_buf_ring(&uring_, buf_ring_, num_provided_buffers_,
+                             provided_buffer_group);
+      buf_ring_ = nullptr;
+    }
+    io_uring_queue_exit(&uring_);
+    return err;
+  }
 
   // TODO how to fix this sequence problem?
   if (auto err = multiplexer_base::init<uring_manager>(
@@ -87,58 +104,281 @@ util::error uring_multiplexer::init(manager_factory factory,
   return util::none;
 }
 
+util::error uring_multiplexer::init_provided_buffers(const util::config& cfg) {
+  if (!cfg.get_or("multiplexer.provided-buffers", false)) {
+    return util::none;
+  }
+  const auto count = cfg.get_or<std::int64_t>(
+    "multiplexer.provided-buffer-count",
+    static_cast<std::int64_t>(default_num_provided_buffers));
+  const auto size = cfg.get_or<std::int64_t>(
+    "multiplexer.provided-buffer-size",
+    static_cast<std::int64_t>(default_provided_buffer_size));
+  if ((count <= 0) || (static_cast<std::size_t>(count) > max_provided_buffers)
+      || !std::has_single_bit(static_cast<std::uint64_t>(count))) {
+    return util::error{util::error_code::invalid_argument,
+                       "multiplexer.provided-buffer-count must be a power of "
+                       "two of at most {0}",
+                       max_provided_buffers};
+  }
+  if ((size <= 0) || (size > std::numeric_limits<std::int32_t>::max())) {
+    return util::error{util::error_code::invalid_argument,
+                       "multiplexer.provided-buffer-size must be positive"};
+  }
+  num_provided_buffers_ = static_cast<unsigned>(count);
+  provided_buffer_size_ = static_cast<std::size_t>(size);
+  int res = 0;
+  buf_ring_ = io_uring_setup_buf_ring(&uring_, num_provided_buffers_,
+                                      provided_buffer_group, 0, &res);
+  if (buf_ring_ == nullptr) {
+    return util::error{util::error_code::runtime_error,
+                       "[uring_multiplexer]: registering the buffer ring "
+                       "failed: {0}",
+                       std::strerror(-res)};
+  }
+  provided_buffers_.resize(num_provided_buffers_ * provided_buffer_size_);
+  const auto mask = io_uring_buf_ring_mask(num_provided_buffers_);
+  for (unsigned bid = 0; bid < num_provided_buffers_; ++bid) {
+    io_uring_buf_ring_add(buf_ring_,
+                          provided_buffers_.data()
+                            + (bid * provided_buffer_size_),
+                          static_cast<unsigned>(provided_buffer_size_),
+                          static_cast<unsigned short>(bid), mask,
+                          static_cast<int>(bid));
+  }
+  io_uring_buf_ring_advance(buf_ring_, static_cast<int>(num_provided_buffers_));
+  LOG_DEBUG("Registered ", NET_ARG2("num_buffers", num_provided_buffers_),
+            " provided buffers of ", NET_ARG2("size", provided_buffer_size_));
+  return util::none;
+}
+
+util::error uring_multiplexer::init_fixed_files(const util::config& cfg) {
+  const auto size = cfg.get_or("multiplexer.fixed-files", std::int64_t{0});
+  if ((size < 0) || (static_cast<std::size_t>(size) > max_fixed_files)) {
+    return util::error{util::error_code::invalid_argument,
+                       "multiplexer.fixed-files must be between 0 and {0}",
+                       max_fixed_files};
+  }
+  if (size == 0) {
+    return util::none;
+  }
+  const auto num_files = static_cast<unsigned>(size);
+  if (auto res = io_uring_register_files_sparse(&uring_, num_files); res < 0) {
+    return util::error{util::error_code::runtime_error,
+                       "[uring_multiplexer]: registering the fixed file table "
+                       "failed: {0}",
+                       std::strerror(-res)};
+  }
+  num_fixed_files_ = num_files;
+  LOG_DEBUG("Registered fixed file table of ",
+            NET_ARG2("size", num_fixed_files_));
+  return util::none;
+}
+
+util::error uring_multiplexer::init_fixed_buffers(const util::config& cfg) {
+  if (!cfg.get_or("multiplexer.fixed-buffers", false)) {
+    return util::none;
+  }
+  const auto count = cfg.get_or<std::int64_t>(
+    "multiplexer.fixed-buffer-count",
+    static_cast<std::int64_t>(default_num_fixed_buffers));
+  const auto size = cfg.get_or<std::int64_t>(
+    "multiplexer.fixed-buffer-size",
+    static_cast<std::int64_t>(default_fixed_buffer_size));
+  if ((count <= 0) || (static_cast<std::size_t>(count) > max_fixed_buffers)) {
+    return util::error{util::error_code::invalid_argument,
+                       "multiplexer.fixed-buffer-count must be between 1 and "
+                       "{0}",
+                       max_fixed_buffers};
+  }
+  if ((size <= 0) || (static_cast<std::size_t>(size) > max_fixed_buffer_size)) {
+    return util::error{util::error_code::invalid_argument,
+                       "multiplexer.fixed-buffer-size must be between 1 and "
+                       "{0}",
+                       max_fixed_buffer_size};
+  }
+  const auto num_buffers = static_cast<unsigned>(count);
+  const auto buffer_size = static_cast<std::size_t>(size);
+  fixed_buffers_.resize(num_buffers * buffer_size);
+  std::vector<iovec> vecs;
+  vecs.reserve(num_buffers);
+  for (unsigned i = 0; i < num_buffers; ++i) {
+    vecs.emplace_back(fixed_buffers_.data() + (i * buffer_size), buffer_size);
+  }
+  if (auto res = io_uring_register_buffers(&uring_, vecs.data(), num_buffers);
+      res < 0) {
+    fixed_buffers_ = {};
+    return util::error{util::error_code::runtime_error,
+                       "[uring_multiplexer]: registering the fixed buffers "
+                       "failed: {0}",
+                       std::strerror(-res)};
+  }
+  num_fixed_buffers_ = num_buffers;
+  fixed_buffer_size_ = buffer_size;
+  // Lower indices are borrowed first
+  free_fixed_buffers_.reserve(num_buffers);
+  for (auto i = num_buffers; i > 0; --i) {
+    free_fixed_buffers_.push_back(static_cast<std::uint16_t>(i - 1));
+  }
+  LOG_DEBUG("Registered ", NET_ARG2("num_buffers", num_fixed_buffers_),
+            " fixed buffers of ", NET_ARG2("size", fixed_buffer_size_));
+  return util::none;
+}
+
+void uring_multiplexer::cancel_submissions(uring_manager& mgr) {
+  // Completions of removed managers must not submit further operations
+  mgr.mask_set(operation::none);
+  if (mgr.num_pending_submissions_ == 0) {
+    return;
+  }
+  if (auto* sqe = io_uring_get_sqe(&uring_)) {
+    io_uring_prep_cancel_fd(sqe, mgr.handle().id, IORING_ASYNC_CANCEL_ALL);
+    io_uring_sqe_set_data64(sqe, internal_submission_id);
+  }
+}
+
+// -- Fixed files --------------------------------------------------------------
+
+void uring_multiplexer::register_file(uring_manager& mgr) {
+  const auto fd = mgr.handle().id;
+  if ((fd < 0) || (static_cast<unsigned>(fd) >= num_fixed_files_)) {
+    return;
+  }
+  // Sockets whose slot cannot be updated keep using their descriptor
+  const auto index = static_cast<unsigned>(fd);
+  if (auto res = io_uring_register_files_update(&uring_, index, &fd, 1);
+      res < 0) {
+    LOG_ERROR("Registering fixed file ", NET_ARG(fd),
+              " failed: ", std::strerror(-res));
+    return;
+  }
+  mgr.fixed_file_ = true;
+}
+
+void uring_multiplexer::unregister_file(uring_manager& mgr) {
+  if (!mgr.fixed_file_) {
+    return;
+  }
+  // Operations in flight keep the file referenced until they complete
+  static constexpr int no_file = -1;
+  const auto index = static_cast<unsigned>(mgr.handle().id);
+  if (auto res = io_uring_register_files_update(&uring_, index, &no_file, 1);
+      res < 0) {
+    LOG_ERROR("Freeing fixed file ", NET_ARG(index),
+              " failed: ", std::strerror(-res));
+  }
+  mgr.fixed_file_ = false;
+}
+
+void uring_multiplexer::use_fixed_file(io_uring_sqe* sqe,
+                                       const uring_manager& mgr) {
+  // The prepared descriptor doubles as the index of the fixed file slot
+  if (mgr.fixed_file_) {
+    sqe->flags |= IOSQE_FIXED_FILE;
+  }
+}
+
+// -- Fixed buffers ------------------------------------------------------------
+
+std::optional<std::uint16_t>
+uring_multiplexer::acquire_fixed_buffer() noexcept {
+  if (free_fixed_buffers_.empty()) {
+    return std::nullopt;
+  }
+  const auto index = free_fixed_buffers_.back();
+  free_fixed_buffers_.pop_back();
+  return index;
+}
+
+util::byte_span uring_multiplexer::fixed_buffer(std::uint16_t index) noexcept {
+  ASSERT(index < num_fixed_buffers_);
+  return {fixed_buffers_.data() + (index * fixed_buffer_size_),
+          fixed_buffer_size_};
+}
+
+void uring_multiplexer::release_fixed_buffer(std::uint16_t index) noexcept {
+  ASSERT(index < num_fixed_buffers_);
+  ASSERT(free_fixed_buffers_.size() < num_fixed_buffers_);
+  free_fixed_buffers_.push_back(index);
+}
+
+// -- Provided buffers ---------------------------------------------------------
+
+util::byte_span uring_multiplexer::provided_buffer(std::uint16_t bid,
+                                                   std::size_t size) noexcept {
+  ASSERT(bid < num_provided_buffers_);
+  ASSERT(size <= provided_buffer_size_);
+  return {provided_buffers_.data() + (bid * provided_buffer_size_), size};
+}
+
+void uring_multiplexer::return_provided_buffer(std::uint16_t bid) noexcept {
+  io_uring_buf_ring_add(buf_ring_,
+                        provided_buffers_.data()
+                          + (bid * provided_buffer_size_),
+                        static_cast<unsigned>(provided_buffer_size_), bid,
+                        io_uring_buf_ring_mask(num_provided_buffers_), 0);
+  io_uring_buf_ring_advance(buf_ring_, 1);
+}
+
 // -- IO Operation submission --------------------------------------------------
 
-io_uring_sqe* uring_multiplexer::prepare_submission(uring_manager_ptr mgr,
-                                                    operation op,
-                                                    bool multishot) {
+std::pair<io_uring_sqe*, std::uint64_t>
+uring_multiplexer::prepare_submission(uring_manager& mgr, operation op) {
   if (auto* sqe = io_uring_get_sqe(&uring_)) {
-    io_uring_sqe_set_data(sqe, new submission_data{std::move(mgr), op,
-                                                   current_submission_id_,
-                                                   multishot});
-    return sqe;
+    if (mgr.num_pending_submissions_++ == 0) {
+      mgr.ref();
+    }
+    const auto id = submissions_.insert({&mgr, op});
+    io_uring_sqe_set_data64(sqe, id);
+    return {sqe, id};
+  }
+  return {nullptr, 0};
+}
+
+void uring_multiplexer::release_submission(uring_manager& mgr) {
+  if (--mgr.num_pending_submissions_ == 0) {
+    mgr.deref();
   }
-  return nullptr;
 }
 
 std::pair<bool, uint64_t> uring_multiplexer::submit_accept(uring_manager& mgr,
                                                            bool multishot) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr), operation::accept,
-                                     multishot)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::accept); sqe) {
     if (multishot) [[unlikely]] {
       io_uring_prep_multishot_accept(sqe, mgr.handle().id, nullptr, nullptr, 0);
     } else [[likely]] {
       io_uring_prep_accept(sqe, mgr.handle().id, nullptr, nullptr, 0);
     }
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
 
 std::pair<bool, uint64_t>
 uring_multiplexer::submit_poll_read(uring_manager& mgr, bool multishot) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr),
-                                     operation::poll_read, multishot)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::poll_read); sqe) {
     if (multishot) [[unlikely]] {
       io_uring_prep_poll_multishot(sqe, mgr.handle().id, POLLIN);
     } else [[likely]] {
       io_uring_prep_poll_add(sqe, mgr.handle().id, POLLIN);
     }
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
 
 std::pair<bool, uint64_t>
 uring_multiplexer::submit_poll_write(uring_manager& mgr, bool multishot) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr),
-                                     operation::poll_write, multishot)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::poll_write); sqe) {
     if (multishot) [[unlikely]] {
       io_uring_prep_poll_multishot(sqe, mgr.handle().id, POLLOUT);
     } else [[likely]] {
       io_uring_prep_poll_add(sqe, mgr.handle().id, POLLOUT);
     }
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
@@ -146,11 +386,12 @@ uring_multiplexer::submit_poll_write(uring_manager& mgr, bool multishot) {
 std::pair<bool, uint64_t>
 uring_multiplexer::submit_read(uring_manager& mgr,
                                util::byte_span read_buffer) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr), operation::read)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::read); sqe) {
     io_uring_prep_read(sqe, mgr.handle().id,
                        static_cast<void*>(read_buffer.data()),
                        read_buffer.size(), 0);
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
@@ -158,11 +399,12 @@ uring_multiplexer::submit_read(uring_manager& mgr,
 std::pair<bool, uint64_t>
 uring_multiplexer::submit_write(uring_manager& mgr,
                                 util::byte_span write_buffer) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr), operation::write)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::write); sqe) {
     io_uring_prep_write(sqe, mgr.handle().id,
                         static_cast<void*>(write_buffer.data()),
                         write_buffer.size(), 0);
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
@@ -170,10 +412,11 @@ uring_multiplexer::submit_write(uring_manager& mgr,
 std::pair<bool, uint64_t>
 uring_multiplexer::submit_readv(uring_manager& mgr,
                                 std::span<iovec> read_vecs) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr), operation::read)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::read); sqe) {
     io_uring_prep_readv(sqe, mgr.handle().id, read_vecs.data(),
                         read_vecs.size(), 0);
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
@@ -181,10 +424,11 @@ uring_multiplexer::submit_readv(uring_manager& mgr,
 std::pair<bool, uint64_t>
 uring_multiplexer::submit_writev(uring_manager& mgr,
                                  std::span<iovec> write_vecs) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr), operation::write)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::write); sqe) {
     io_uring_prep_writev(sqe, mgr.handle().id, write_vecs.data(),
                          write_vecs.size(), 0);
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
@@ -192,23 +436,76 @@ uring_multiplexer::submit_writev(uring_manager& mgr,
 std::pair<bool, uint64_t> uring_multiplexer::submit_recvmsg(uring_manager& mgr,
                                                             msghdr& read_msghdr,
                                                             bool multishot) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr), operation::read,
-                                     multishot)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::read); sqe) {
     if (multishot) [[unlikely]] {
       io_uring_prep_recvmsg_multishot(sqe, mgr.handle().id, &read_msghdr, 0);
     } else [[likely]] {
       io_uring_prep_recvmsg(sqe, mgr.handle().id, &read_msghdr, 0);
     }
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
 
+std::pair<bool, uint64_t>
+uring_multiplexer::submit_recv_multishot(uring_manager& mgr) {
+  ASSERT(uses_provided_buffers());
+  if (auto [sqe, id] = prepare_submission(mgr, operation::read); sqe) {
+    io_uring_prep_recv_multishot(sqe, mgr.handle().id, nullptr, 0, 0);
+    sqe->flags |= IOSQE_BUFFER_SELECT;
+    sqe->buf_group = provided_buffer_group;
+    use_fixed_file(sqe, mgr);
+    return {true, id};
+  }
+  return {false, 0};
+}
+
+std::pair<bool, uint64_t>
+uring_multiplexer::submit_read_fixed(uring_manager& mgr,
+                                     util::byte_span read_buffer,
+                                     std::uint16_t index) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::read); sqe) {
+    io_uring_prep_read_fixed(sqe, mgr.handle().id,
+                             static_cast<void*>(read_buffer.data()),
+                             static_cast<unsigned>(read_buffer.size()), 0,
+                             index);
+    use_fixed_file(sqe, mgr);
+    return {true, id};
+  }
+  return {false, 0};
+}
+
+std::pair<bool, uint64_t>
+uring_multiplexer::submit_write_fixed(uring_manager& mgr,
+                                      util::const_byte_span write_buffer,
+                                      std::uint16_t index) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::write); sqe) {
+    io_uring_prep_write_fixed(sqe, mgr.handle().id,
+                              static_cast<const void*>(write_buffer.data()),
+                              static_cast<unsigned>(write_buffer.size()), 0,
+                              index);
+    use_fixed_file(sqe, mgr);
+    return {true, id};
+  }
+  return {false, 0};
+}
+
+bool uring_multiplexer::submit_cancel(std::uint64_t id) {
+  if (auto* sqe = io_uring_get_sqe(&uring_)) {
+    io_uring_prep_cancel64(sqe, id, 0);
+    io_uring_sqe_set_data64(sqe, internal_submission_id);
+    return true;
+  }
+  return false;
+}
+
 std::pair<bool, uint64_t>
 uring_multiplexer::submit_sendmsg(uring_manager& mgr, msghdr& write_msghdr) {
-  if (auto* sqe = prepare_submission(as_intrusive_ptr(mgr), operation::write)) {
+  if (auto [sqe, id] = prepare_submission(mgr, operation::write); sqe) {
     io_uring_prep_sendmsg(sqe, mgr.handle().id, &write_msghdr, 0);
-    return {true, current_submission_id_++};
+    use_fixed_file(sqe, mgr);
+    return {true, id};
   }
   return {false, 0};
 }
@@ -221,23 +518,34 @@ void uring_multiplexer::add(manager_base_ptr mgr, operation initial) {
     LOG_DEBUG("Adding socket_manager with ", NET_ARG2("id", mgr->handle().id),
               " for ", NET_ARG(initial));
     auto& added_mgr = multiplexer_base::add(std::move(mgr));
+    register_file(static_cast<uring_manager&>(*added_mgr));
     if (auto err = added_mgr->init(cfg())) {
       handle_error(err);
     }
     enable(*added_mgr, initial);
   } else {
-    LOG_DEBUG("Requesting to add socket_manager with ",
-              NET_ARG2("id", mgr->handle().id), " for ", NET_ARG(initial));
-    write_to_pipe(pollset_opcode::add, mgr.release(), initial);
+    request_add(std::move(mgr), initial);
+  }
+}
+
+void uring_multiplexer::del(net::socket handle) {
+  LOG_TRACE();
+  if (auto* mgr = manager<uring_manager>(handle)) {
+    cancel_submissions(*mgr);
+    unregister_file(*mgr);
   }
+  multiplexer_base::del(handle);
 }
 
 uring_multiplexer::manager_map::iterator
 uring_multiplexer::del(manager_map::iterator it) {
   LOG_TRACE();
-  LOG_DEBUG("Deleting mgr with ", NET_ARG2("id", it->second->handle().id));
+  LOG_DEBUG("Deleting mgr with ", NET_ARG2("id", (*it)->handle().id));
+  auto& mgr = static_cast<uring_manager&>(**it);
+  cancel_submissions(mgr);
+  unregister_file(mgr);
   auto new_it = multiplexer_base::del(it);
-  if (shutting_down_ && multiplexer_base::has_managers()) {
+  if (shutting_down_ && !multiplexer_base::has_managers()) {
     running_ = false;
   }
   return new_it;
@@ -266,8 +574,8 @@ void uring_multiplexer::disable(manager_base& mgr, operation op, bool remove) {
   if (!mgr.mask_del(op)) {
     return;
   }
-  if (remove && (mgr.mask() == operation::none)) {
-    multiplexer_base::del(mgr.handle());
+  if (remove && (mgr.mask() == operation::none) && !mgr.reading_paused()) {
+    del(mgr.handle());
   }
 }
 
@@ -284,17 +592,17 @@ util::error uring_multiplexer::poll_once(bool blocking) {
   }
   LOG_DEBUG("Submitted ", submit_res, " operations to io_uring");
 
-  const auto now = time_point_cast<milliseconds>(steady_clock::now());
+  const auto now = steady_clock::now();
   const auto timeout_passed = (current_timeout_ ? (now > *current_timeout_)
                                                 : false);
-  // Calculate the timeout value for the kqueue call
+  // Calculate the timeout value for the io_uring call
   __kernel_timespec timeout{0, 0};
 
   if (blocking && current_timeout_ && !timeout_passed) {
-    const auto timeout_tp = time_point_cast<milliseconds>(*current_timeout_);
-    const auto diff_ms = (timeout_tp - now).count();
-    timeout.tv_nsec = (diff_ms / 1000);
-    timeout.tv_nsec = ((diff_ms % 1000) * 1000000);
+    const auto diff = duration_cast<nanoseconds>(*current_timeout_ - now);
+    const auto secs = duration_cast<seconds>(diff);
+    timeout.tv_sec = secs.count();
+    timeout.tv_nsec = (diff - secs).count();
   }
 
   // Pass nullptr only when blocking indefinitely (no timeout set)
@@ -303,6 +611,7 @@ util::error uring_multiplexer::poll_once(bool blocking) {
   auto* timeout_ptr = (blocking && !current_timeout_) ? nullptr : &timeout;
   // Wait for completion events with timeout
   io_uring_cqe* cqe = nullptr;
+  stats_begin_wait();
   int ret = io_uring_wait_cqe_timeout(&uring_, &cqe, timeout_ptr);
 
   if (ret < 0 && ret != -ETIME) {
@@ -312,12 +621,17 @@ util::error uring_multiplexer::poll_once(bool blocking) {
   }
 
   // Handle all timeouts and io-events that have been registered
+  update_loop_now();
   handle_timeouts();
-  handle_events();
+  stats_timeouts_handled();
+  stats_end_iteration(handle_events());
+  if (track_loop_lag_) {
+    record_loop_lag(steady_clock::now() - loop_now());
+  }
   return util::none;
 }
 
-void uring_multiplexer::handle_events() {
+std::size_t uring_multiplexer::handle_events() {
   LOG_TRACE();
   io_uring_cqe* cqe;
   unsigned head;
@@ -325,37 +639,54 @@ void uring_multiplexer::handle_events() {
 
   // Iterate through all available completion events
   io_uring_for_each_cqe(&uring_, head, cqe) {
-    auto* data = reinterpret_cast<submission_data*>(io_uring_cqe_get_data(cqe));
-    if (!data) {
-      LOG_ERROR("Received CQE with null user_data");
+    const auto id = io_uring_cqe_get_data64(cqe);
+    if (id == internal_submission_id) {
+      // Completion of a cancellation, which is not tracked
+      ++count;
+      continue;
+    }
+    auto* sub = submissions_.find(id);
+    if (!sub) {
+      LOG_ERROR("Received CQE for unknown submission ", NET_ARG(id));
       ++count;
       continue;
     }
+    // Copied, since handlers may submit operations and grow the table
+    const auto [mgr, op] = *sub;
+    // Multishot submissions complete until a CQE without the MORE flag
+    const bool final_completion = (cqe->flags & IORING_CQE_F_MORE) == 0;
+    if (final_completion) {
+      submissions_.erase(id);
+    }
+    completion_flags_ = cqe->flags;
 
-    LOG_DEBUG("Handling CQE for fd=", data->mgr->handle().id,
-              " op=", to_string(data->op), " res=", cqe->res);
+    LOG_DEBUG("Handling CQE for fd=", mgr->handle().id, " op=", to_string(op),
+              " res=", cqe->res);
 
-    auto result = data->mgr->handle_completion(data->op, cqe->res, data->id);
+    auto result = invoke_handler(*mgr, [mgr, op, id, cqe] {
+      return mgr->handle_completion(op, cqe->res, id);
+    });
     switch (result) {
       case manager_result::ok:
         break;
       case manager_result::temporary_error:
       case manager_result::done:
-        disable(*data->mgr, data->op, true);
+        disable(*mgr, op, true);
         break;
       case manager_result::error:
-        multiplexer_base::del(data->mgr->handle());
+        del(mgr->handle());
         break;
     }
 
-    if (!data->multishot) {
-      delete data;
+    if (final_completion) {
+      release_submission(*mgr);
     }
     count++;
   }
 
   // Mark all CQEs as consumed
   io_uring_cq_advance(&uring_, count);
+  return count;
 }
 
 util::error_or<uring_multiplexer_ptr>
@@ -0,0 +1,51 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      placement_policy.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/placement_policy.hpp"
+
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+
+#include <ostream>
+
+namespace net {
+
+util::error_or<placement_policy> parse_placement_policy(std::string_view str) {
+  if (str == "reuse-port") {
+    return placement_policy::reuse_port;
+  } else if (str == "round-robin") {
+    return placement_policy::round_robin;
+  } else if (str == "least-connections") {
+    return placement_policy::least_connections;
+  } else if (str == "least-lag") {
+    return placement_policy::least_lag;
+  }
+  return util::error{util::error_code::invalid_argument,
+                     "unknown placement policy '{0}'", std::string{str}};
+}
+
+std::string to_string(placement_policy policy) {
+  switch (policy) {
+    case placement_policy::reuse_port:
+      return "reuse-port";
+    case placement_policy::round_robin:
+      return "round-robin";
+    case placement_policy::least_connections:
+      return "least-connections";
+    case placement_policy::least_lag:
+      return "least-lag";
+    default:
+      return "unknown";
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, placement_policy policy) {
+  return os << to_string(policy);
+}
+
+} // namespace net
@@ -0,0 +1,85 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      event_socket.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/socket/event_socket.hpp"
+
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+#include "util/logger.hpp"
+
+#include <array>
+#include <cstdint>
+#include <unistd.h>
+
+#if defined(__linux__)
+#  include <sys/eventfd.h>
+#endif
+
+namespace net {
+
+util::error_or<event_socket_pair> make_event_socket() {
+#if defined(__linux__)
+  const auto fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (fd < 0) {
+    return util::error(util::error_code::socket_operation_failed,
+                       "make_event_socket: {0}", last_socket_error_as_string());
+  }
+  // A second descriptor for the same eventfd keeps the ends independent
+  const auto writer = ::dup(fd);
+  if (writer < 0) {
+    ::close(fd);
+    return util::error(util::error_code::socket_operation_failed,
+                       "make_event_socket: {0}", last_socket_error_as_string());
+  }
+  LOG_DEBUG("Created eventfd with fds=[", fd, ",", writer, "]");
+  return std::make_pair(event_socket{fd}, event_socket{writer});
+#else
+  std::array<socket_id, 2> pipefds;
+  if (::pipe(pipefds.data()) != 0) {
+    return util::error(util::error_code::socket_operation_failed,
+                       "make_event_socket: {0}", last_socket_error_as_string());
+  }
+  const event_socket_pair result{event_socket{pipefds[0]},
+                                 event_socket{pipefds[1]}};
+  if (!nonblocking(result.first, true) || !nonblocking(result.second, true)) {
+    close(result.first);
+    close(result.second);
+    return util::error(util::error_code::socket_operation_failed,
+                       "make_event_socket: {0}", last_socket_error_as_string());
+  }
+  LOG_DEBUG("Created pipe with fds=[", pipefds[0], ",", pipefds[1], "]");
+  return result;
+#endif
+}
+
+bool notify(event_socket x) {
+#if defined(__linux__)
+  const std::uint64_t value = 1;
+#else
+  const std::uint8_t value = 1;
+#endif
+  // A full pipe already guarantees a pending notification
+  return (::write(x.id, &value, sizeof(value)) == sizeof(value))
+         || last_socket_error_is_temporary();
+}
+
+bool drain(event_socket x) {
+  // A single read resets an eventfd, a pipe may contain several bytes
+  std::array<std::uint64_t, 16> buf;
+  for (;;) {
+    const auto res = ::read(x.id, buf.data(), sizeof(buf));
+    if (res < 0) {
+      return last_socket_error_is_temporary();
+    } else if (res == 0) {
+      LOG_ERROR("event socket with ", NET_ARG2("fd", x.id), " was closed");
+      return false;
+    }
+  }
+}
+
+} // namespace net
@@ -103,6 +103,16 @@ util::error_or<uint16_t> port_of(socket x) {
   return ntohs(sin.sin_port);
 }
 
+util::error_or<ip::v4_endpoint> peer_of(socket x) {
+  sockaddr_in sin = {};
+  socklen_t len = sizeof(sockaddr_in);
+  if (getpeername(x.id, reinterpret_cast<sockaddr*>(&sin), &len) == -1) {
+    return util::error(util::error_code::socket_operation_failed,
+                       last_socket_error_as_string());
+  }
+  return ip::v4_endpoint{sin};
+}
+
 bool reuseaddr(socket sock, bool new_value) {
   LOG_DEBUG("reuseaddr on ", NET_ARG2("socket", sock.id), ", ",
             NET_ARG(new_value));
@@ -113,4 +123,14 @@ bool reuseaddr(socket sock, bool new_value) {
   return res == 0;
 }
 
+bool reuseport(socket sock, bool new_value) {
+  LOG_DEBUG("reuseport on ", NET_ARG2("socket", sock.id), ", ",
+            NET_ARG(new_value));
+  int on = new_value ? 1 : 0;
+  const auto res = setsockopt(sock.id, SOL_SOCKET, SO_REUSEPORT,
+                              reinterpret_cast<const void*>(&on),
+                              static_cast<unsigned>(sizeof(on)));
+  return res == 0;
+}
+
 } // namespace net
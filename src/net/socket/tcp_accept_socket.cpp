@@ -18,6 +18,11 @@
 #include "util/error_or.hpp"
 #include "util/logger.hpp"
 
+#include <chrono>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
 #include <utility>
 
 namespace net {
@@ -39,10 +44,42 @@ tcp_stream_socket accept(tcp_accept_socket sock) {
     ::accept(sock.id, reinterpret_cast<sockaddr*>(&cli), &len)};
 }
 
+tcp_stream_socket accept_nonblocking(tcp_accept_socket sock) {
+  LOG_DEBUG("accept_nonblocking on ", NET_ARG2("socket", sock.id));
+#if defined(__linux__)
+  return tcp_stream_socket{
+    ::accept4(sock.id, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)};
+#else
+  auto accepted = accept(sock);
+  if ((accepted != invalid_socket)
+      && ((fcntl(accepted.id, F_SETFD, FD_CLOEXEC) != 0)
+          || !nonblocking(accepted, true))) {
+    close(accepted);
+    return tcp_stream_socket{invalid_socket_id};
+  }
+  return accepted;
+#endif
+}
+
+bool defer_accept(tcp_accept_socket sock, std::chrono::seconds timeout) {
+  LOG_DEBUG("defer_accept on ", NET_ARG2("socket", sock.id), ", ",
+            NET_ARG2("timeout", timeout.count()));
+#if defined(__linux__)
+  const int secs = static_cast<int>(timeout.count());
+  return setsockopt(sock.id, IPPROTO_TCP, TCP_DEFER_ACCEPT, &secs,
+                    sizeof(secs))
+         == 0;
+#else
+  return timeout.count() == 0;
+#endif
+}
+
 util::error_or<acceptor_pair> make_tcp_accept_socket(const ip::v4_endpoint& ep,
-                                                     const int conn_backlog) {
+                                                     const int conn_backlog,
+                                                     const bool reuse_port) {
   LOG_DEBUG("Creating tcp_accept_socket for ",
-            NET_ARG2("endpoint", to_string(ep)), ", ", NET_ARG(conn_backlog));
+            NET_ARG2("endpoint", to_string(ep)), ", ", NET_ARG(conn_backlog),
+            ", ", NET_ARG(reuse_port));
   const tcp_accept_socket sock{::socket(AF_INET, SOCK_STREAM, 0)};
   if (sock == invalid_socket) {
     return util::error(util::error_code::socket_operation_failed,
@@ -50,6 +87,11 @@ util::error_or<acceptor_pair> make_tcp_accept_socket(const ip::v4_endpoint& ep,
                        util::last_error_as_string());
   }
   auto guard = make_socket_guard(sock);
+  if (reuse_port && !reuseport(sock, true)) {
+    return util::error(util::error_code::socket_operation_failed,
+                       "Failed to set SO_REUSEPORT {0}",
+                       util::last_error_as_string());
+  }
   if (auto err = bind(sock, ep))
     return err;
   if (auto err = listen(sock, conn_backlog))
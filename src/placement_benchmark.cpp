@@ -0,0 +1,223 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      placement_benchmark.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/byte_array.hpp"
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+#include "util/intrusive_ptr.hpp"
+
+#include "net/ip/v4_address.hpp"
+#include "net/ip/v4_endpoint.hpp"
+
+#include "net/multiplexer_group.hpp"
+#include "net/placement_policy.hpp"
+
+#include "net/socket/stream_socket.hpp"
+#include "net/socket/tcp_stream_socket.hpp"
+
+#include "net/manager_result.hpp"
+
+#include "net/detail/event_handler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Compares the connection placement policies of a multiplexer_group. Clients
+// send one-byte requests that make the server spin for as many work units as
+// the byte says before answering. Every `num_workers`-th connection is heavy
+// and requests expensive work, the others request none. Connections are
+// opened one at a time while the already placed ones produce load, giving
+// load-aware policies a signal to act on. Afterwards, the request throughput
+// and the latency of the light requests are measured.
+// Usage: placement_benchmark [num_connections] [num_workers] [duration_ms]
+
+namespace {
+
+constexpr auto work_unit = std::chrono::microseconds{10};
+constexpr std::uint8_t heavy_work_units = 20;
+constexpr std::size_t num_clients = 4;
+
+/// Spins for the requested number of work units, then answers the request.
+struct work_manager : public net::detail::event_handler {
+  work_manager(net::socket handle, net::detail::multiplexer_base* mpx)
+    : net::detail::event_handler(handle, mpx) {
+    // nop
+  }
+
+  net::manager_result handle_read_event() override {
+    util::byte_array<1> req;
+    const auto res = net::read(handle<net::stream_socket>(), req);
+    if (res <= 0) {
+      return ((res < 0) && net::last_socket_error_is_temporary())
+               ? net::manager_result::temporary_error
+               : net::manager_result::done;
+    }
+    const auto deadline = std::chrono::steady_clock::now()
+                          + (work_unit * static_cast<int>(req[0]));
+    while (std::chrono::steady_clock::now() < deadline) {
+      // spin
+    }
+    return (net::write(handle<net::stream_socket>(), req) == 1)
+             ? net::manager_result::ok
+             : net::manager_result::error;
+  }
+
+  net::manager_result handle_write_event() override {
+    return net::manager_result::done;
+  }
+};
+
+struct client_connection {
+  net::tcp_stream_socket sock;
+  std::uint8_t work_units;
+};
+
+bool round_trip(const client_connection& conn) {
+  util::byte_array<1> buf{std::byte{conn.work_units}};
+  return (net::write(conn.sock, buf) == 1) && (net::read(conn.sock, buf) == 1);
+}
+
+/// Runs the benchmark against a group using `policy`.
+bool run(net::placement_policy policy, std::size_t num_connections,
+         std::int64_t num_workers, std::chrono::milliseconds duration) {
+  const auto name = to_string(policy);
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.num-threads", num_workers);
+  cfg.add_config_entry("multiplexer.placement", name);
+  cfg.add_config_entry("multiplexer.backlog", std::int64_t{1024});
+  auto factory = [](net::socket handle, net::detail::multiplexer_base* mpx) {
+    return mpx->make_manager<work_manager>(
+      net::socket_cast<net::stream_socket>(handle));
+  };
+  net::multiplexer_group<> group;
+  if (auto err = group.init(std::move(factory), cfg)) {
+    std::cerr << name << ": " << to_string(err) << '\n';
+    return false;
+  }
+  group.start();
+  const net::ip::v4_endpoint ep{net::ip::v4_address::localhost, group.port()};
+  std::vector<client_connection> conns(num_connections);
+  std::atomic<std::size_t> num_connected{0};
+  std::atomic<bool> measuring{false};
+  std::atomic<bool> done{false};
+  std::atomic<bool> success{true};
+  std::atomic<std::size_t> num_requests{0};
+  std::vector<std::vector<std::int64_t>> samples(num_clients);
+  std::vector<std::thread> clients;
+  for (std::size_t i = 0; i < num_clients; ++i) {
+    clients.emplace_back([&, i] {
+      std::size_t local_requests = 0;
+      while (success && !done) {
+        const auto connected = num_connected.load(std::memory_order_acquire);
+        if (connected <= i) {
+          std::this_thread::yield();
+          continue;
+        }
+        for (auto j = i; success && !done && (j < connected);
+             j += num_clients) {
+          const auto start = std::chrono::steady_clock::now();
+          success = success && round_trip(conns[j]);
+          const auto elapsed = std::chrono::steady_clock::now() - start;
+          if (!measuring) {
+            continue;
+          }
+          ++local_requests;
+          if (conns[j].work_units == 0) {
+            samples[i].emplace_back(
+              std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                .count());
+          }
+        }
+      }
+      num_requests.fetch_add(local_requests);
+    });
+  }
+  for (std::size_t i = 0; success && (i < num_connections); ++i) {
+    auto sock_res = net::make_connected_tcp_stream_socket(ep);
+    if (util::get_error(sock_res)) {
+      success = false;
+      break;
+    }
+    const auto heavy = (i % static_cast<std::size_t>(num_workers)) == 0;
+    conns[i] = {std::get<net::tcp_stream_socket>(sock_res),
+                heavy ? heavy_work_units : std::uint8_t{0}};
+    num_connected.store(i + 1, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  measuring = true;
+  const auto begin = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(duration);
+  done = true;
+  for (auto& client : clients) {
+    client.join();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - begin;
+  for (std::size_t i = 0; i < num_connected; ++i) {
+    net::close(conns[i].sock);
+  }
+  if (!success) {
+    std::cerr << name << ": round trip failed\n";
+    return false;
+  }
+  std::vector<std::int64_t> light;
+  for (const auto& s : samples) {
+    light.insert(light.end(), s.begin(), s.end());
+  }
+  if (light.empty()) {
+    std::cerr << name << ": no light requests completed\n";
+    return false;
+  }
+  std::sort(light.begin(), light.end());
+  auto percentile = [&light](double p) {
+    return light[static_cast<std::size_t>(
+      p * static_cast<double>(light.size() - 1))];
+  };
+  const auto secs = std::chrono::duration<double>(elapsed).count();
+  std::cout << std::left << std::setw(20) << name << std::right << std::fixed
+            << std::setprecision(0) << std::setw(12)
+            << static_cast<double>(num_requests) / secs << std::setw(10)
+            << percentile(0.5) << std::setw(10) << percentile(0.99)
+            << std::setw(10) << light.back() << '\n';
+  return true;
+}
+
+} // namespace
+
+int main(int argc, const char** argv) {
+  const std::size_t num_connections = (argc > 1) ? std::stoul(argv[1]) : 64;
+  const std::int64_t num_workers = (argc > 2) ? std::stoll(argv[2]) : 4;
+  const std::chrono::milliseconds duration{(argc > 3) ? std::stoll(argv[3])
+                                                      : 2000};
+  if ((num_workers <= 0) || (num_connections < num_clients)) {
+    std::cerr << "requires a positive number of workers and at least "
+              << num_clients << " connections\n";
+    return EXIT_FAILURE;
+  }
+  std::cout << num_connections << " connections on " << num_workers
+            << " workers, light request latency in us\n"
+            << std::left << std::setw(20) << "policy" << std::right
+            << std::setw(12) << "req/s" << std::setw(10) << "p50"
+            << std::setw(10) << "p99" << std::setw(10) << "max" << '\n';
+  bool success = true;
+  for (const auto policy :
+       {net::placement_policy::reuse_port, net::placement_policy::round_robin,
+        net::placement_policy::least_connections,
+        net::placement_policy::least_lag}) {
+    success = success && run(policy, num_connections, num_workers, duration);
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,169 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      cpu_affinity.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/cpu_affinity.hpp"
+
+#include "util/format.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#  include <linux/mempolicy.h>
+#  include <sched.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace util {
+
+namespace {
+
+/// Maximum number of CPUs accepted in a list, bounds the size of ranges.
+constexpr std::size_t max_cpus = 4096;
+
+std::string_view trim(std::string_view str) noexcept {
+  constexpr std::string_view whitespace = " \t\n";
+  const auto first = str.find_first_not_of(whitespace);
+  if (first == std::string_view::npos) {
+    return {};
+  }
+  const auto last = str.find_last_not_of(whitespace);
+  return str.substr(first, last - first + 1);
+}
+
+bool parse_cpu(std::string_view str, std::size_t& cpu) noexcept {
+  str = trim(str);
+  const auto* end = str.data() + str.size();
+  const auto res = std::from_chars(str.data(), end, cpu);
+  return !str.empty() && (res.ec == std::errc{}) && (res.ptr == end)
+         && (cpu < max_cpus);
+}
+
+} // namespace
+
+error_or<cpu_list> parse_cpu_list(std::string_view str) {
+  cpu_list cpus;
+  str = trim(str);
+  if (str.empty()) {
+    return error{error_code::parser_error, "empty cpu list"};
+  }
+  for (const auto token : split(str, ',')) {
+    std::size_t first = 0;
+    std::size_t last = 0;
+    const auto dash = token.find('-');
+    if (dash == std::string_view::npos) {
+      if (!parse_cpu(token, first)) {
+        return error{error_code::parser_error, "invalid cpu '{0}'",
+                     std::string{token}};
+      }
+      last = first;
+    } else if (!parse_cpu(token.substr(0, dash), first)
+               || !parse_cpu(token.substr(dash + 1), last) || (last < first)) {
+      return error{error_code::parser_error, "invalid cpu range '{0}'",
+                   std::string{token}};
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) {
+      cpus.emplace_back(cpu);
+    }
+  }
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+#if defined(__linux__)
+
+cpu_list allowed_cpus() {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+    return {};
+  }
+  cpu_list cpus;
+  for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &set)) {
+      cpus.emplace_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+error_or<cpu_list> numa_node_cpus(std::size_t node) {
+  const auto path = "/sys/devices/system/node/node" + std::to_string(node)
+                    + "/cpulist";
+  std::ifstream file{path};
+  if (!file) {
+    return error{error_code::invalid_argument, "no such NUMA node: {0}",
+                 node};
+  }
+  std::stringstream content;
+  content << file.rdbuf();
+  return parse_cpu_list(content.str());
+}
+
+error pin_current_thread(const cpu_list& cpus) {
+  if (cpus.empty()) {
+    return error{error_code::invalid_argument, "cpu list must not be empty"};
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const auto cpu : cpus) {
+    if (cpu >= CPU_SETSIZE) {
+      return error{error_code::invalid_argument, "cpu {0} out of range", cpu};
+    }
+    CPU_SET(cpu, &set);
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    return error{error_code::runtime_error, "sched_setaffinity failed: {0}",
+                 last_error_as_string()};
+  }
+  return none;
+}
+
+error prefer_numa_node(std::size_t node) {
+  constexpr std::size_t bits_per_word = sizeof(unsigned long) * CHAR_BIT;
+  std::vector<unsigned long> mask((node / bits_per_word) + 1, 0);
+  mask[node / bits_per_word] = 1ul << (node % bits_per_word);
+  // The kernel ignores the last bit of maxnode
+  const auto max_node = (mask.size() * bits_per_word) + 1;
+  if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.data(), max_node) != 0) {
+    return error{error_code::runtime_error, "set_mempolicy failed: {0}",
+                 last_error_as_string()};
+  }
+  return none;
+}
+
+#else
+
+cpu_list allowed_cpus() {
+  return {};
+}
+
+error_or<cpu_list> numa_node_cpus(std::size_t) {
+  return error{error_code::runtime_error,
+               "NUMA information is not available on this platform"};
+}
+
+error pin_current_thread(const cpu_list&) {
+  return error{error_code::runtime_error,
+               "thread affinity is not supported on this platform"};
+}
+
+error prefer_numa_node(std::size_t) {
+  return error{error_code::runtime_error,
+               "NUMA memory policies are not supported on this platform"};
+}
+
+#endif
+
+} // namespace util
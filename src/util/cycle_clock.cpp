@@ -0,0 +1,39 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      cycle_clock.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/cycle_clock.hpp"
+
+namespace util {
+
+namespace {
+
+/// Measures the rate of the counter against the steady clock.
+double calibrate() noexcept {
+  using namespace std::chrono;
+  constexpr auto calibration_time = milliseconds{10};
+  const auto start_time = steady_clock::now();
+  const auto start_ticks = cycle_clock::now();
+  auto elapsed = steady_clock::duration{0};
+  do {
+    elapsed = steady_clock::now() - start_time;
+  } while (elapsed < calibration_time);
+  const auto ticks = cycle_clock::now() - start_ticks;
+  const auto ns = duration_cast<nanoseconds>(elapsed).count();
+  const auto rate = static_cast<double>(ticks) / static_cast<double>(ns);
+  // Guard against counters that did not advance
+  return (rate > 0) ? rate : 1.0;
+}
+
+} // namespace
+
+double cycle_clock::ticks_per_ns() noexcept {
+  static const double rate = calibrate();
+  return rate;
+}
+
+} // namespace util
@@ -0,0 +1,217 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      coroutine_layer.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/coroutine_layer.hpp"
+
+#include "net/connection.hpp"
+#include "net/multiplexer.hpp"
+#include "net/receive_policy.hpp"
+#include "net/socket/stream_socket.hpp"
+#include "net/socket_guard.hpp"
+#include "net/task.hpp"
+
+#include "net/detail/event_handler.hpp"
+#include "net/detail/frame_allocator.hpp"
+#include "net/detail/stream_transport.hpp"
+
+#include "util/byte_buffer.hpp"
+#include "util/byte_span.hpp"
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/intrusive_ptr.hpp"
+
+#include "net_test.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+using namespace net;
+using namespace std::chrono_literals;
+
+namespace {
+
+using coroutine_function = std::function<task<>(connection&)>;
+
+using coroutine_transport
+  = detail::event_stream_transport<coroutine_layer<coroutine_function>>;
+
+util::const_byte_span as_bytes(std::string_view str) {
+  return {reinterpret_cast<const std::byte*>(str.data()), str.size()};
+}
+
+std::string_view as_string(util::const_byte_span bytes) {
+  return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+/// Reads a length-prefixed message.
+task<util::byte_buffer> read_message(connection& conn) {
+  const auto header = co_await conn.read(receive_policy::exactly(1));
+  const auto size = static_cast<std::uint32_t>(header[0]);
+  const auto body = co_await conn.read(receive_policy::exactly(size));
+  co_return util::byte_buffer{body.begin(), body.end()};
+}
+
+struct coroutine_layer_test : public testing::Test {
+  coroutine_layer_test()
+    : sockets{UNPACK_EXPRESSION(make_stream_socket_pair())},
+      peer{sockets.second} {
+    cfg.add_config_entry("multiplexer.listen", false);
+    EXPECT_EQ(mpx.init(multiplexer::manager_factory{}, cfg), util::none);
+    mpx.set_thread_id(std::this_thread::get_id());
+    EXPECT_TRUE(nonblocking(sockets.second, true));
+  }
+
+  void run(coroutine_function fn) {
+    mpx.add(util::make_intrusive<coroutine_transport>(sockets.first, &mpx,
+                                                      std::move(fn)),
+            operation::read);
+  }
+
+  bool poll_until(const std::function<bool()>& predicate,
+                  bool blocking = false, std::size_t max_num_polls = 100) {
+    for (std::size_t i = 0; !predicate() && (i < max_num_polls); ++i) {
+      EXPECT_EQ(mpx.poll_once(blocking), util::none);
+    }
+    return predicate();
+  }
+
+  void send(std::string_view str) {
+    ASSERT_EQ(test::write_all(peer.get(), as_bytes(str)),
+              manager_result::done);
+  }
+
+  /// Receives bytes from the coroutine until `num_bytes` arrived or the
+  /// connection is closed.
+  std::string receive(std::size_t num_bytes, bool blocking = false) {
+    std::string received;
+    util::byte_array<1024> buf;
+    poll_until([&] {
+      const auto res = read(peer.get(), buf);
+      if (res > 0) {
+        received.append(as_string({buf.data(), static_cast<size_t>(res)}));
+      } else if ((res == 0) || !last_socket_error_is_temporary()) {
+        closed = true;
+      }
+      return closed || (received.size() >= num_bytes);
+    }, blocking);
+    return received;
+  }
+
+  util::config cfg;
+  multiplexer mpx;
+  stream_socket_pair sockets;
+  socket_guard<stream_socket> peer;
+  bool closed{false};
+};
+
+} // namespace
+
+TEST_F(coroutine_layer_test, echo) {
+  run([](connection& conn) -> task<> {
+    for (;;) {
+      const auto bytes = co_await conn.read(receive_policy::up_to(1024));
+      co_await conn.write(bytes);
+    }
+  });
+  send("hello");
+  EXPECT_EQ(receive(5), "hello");
+  send("world");
+  EXPECT_EQ(receive(5), "world");
+}
+
+TEST_F(coroutine_layer_test, echo_exceeding_the_read_size) {
+  run([](connection& conn) -> task<> {
+    for (;;) {
+      const auto bytes = co_await conn.read(receive_policy::up_to(1024));
+      co_await conn.write(bytes);
+    }
+  });
+  std::string input;
+  for (std::size_t i = 0; i < 3000; ++i) {
+    input.push_back(static_cast<char>('a' + (i % 26)));
+  }
+  send(input);
+  EXPECT_EQ(receive(input.size()), input);
+}
+
+TEST_F(coroutine_layer_test, nested_tasks_and_pipelined_requests) {
+  run([](connection& conn) -> task<> {
+    for (;;) {
+      auto msg = co_await read_message(conn);
+      std::reverse(msg.begin(), msg.end());
+      co_await conn.write(msg);
+    }
+  });
+  // Both requests arrive at once, the second is buffered for the next read
+  send("\x03" "abc" "\x05" "hello");
+  EXPECT_EQ(receive(8), "cbaolleh");
+  // Requests split across several writes are reassembled
+  send("\x04" "te");
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(mpx.poll_once(false), util::none);
+  }
+  send("st");
+  EXPECT_EQ(receive(4), "tset");
+}
+
+TEST_F(coroutine_layer_test, sleep) {
+  const auto start = std::chrono::steady_clock::now();
+  run([](connection& conn) -> task<> {
+    co_await conn.sleep_for(2ms);
+    co_await conn.write(as_bytes("awake"));
+    co_await conn.read(receive_policy::exactly(1));
+  });
+  EXPECT_EQ(receive(5, true), "awake");
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 2ms);
+}
+
+TEST_F(coroutine_layer_test, connection_closes_when_coroutine_returns) {
+  const auto num_managers = mpx.num_socket_managers();
+  run([](connection& conn) -> task<> {
+    co_await conn.write(as_bytes("bye"));
+  });
+  EXPECT_EQ(receive(4), "bye");
+  EXPECT_TRUE(closed);
+  EXPECT_EQ(mpx.num_socket_managers(), num_managers);
+}
+
+TEST_F(coroutine_layer_test, connection_closes_when_coroutine_throws) {
+  const auto num_managers = mpx.num_socket_managers();
+  run([](connection& conn) -> task<> {
+    co_await conn.read(receive_policy::exactly(1));
+    throw std::runtime_error("failed");
+  });
+  send("x");
+  EXPECT_EQ(receive(1), "");
+  EXPECT_TRUE(closed);
+  EXPECT_EQ(mpx.num_socket_managers(), num_managers);
+}
+
+TEST_F(coroutine_layer_test, frames_are_reused) {
+  run([](connection& conn) -> task<> {
+    for (;;) {
+      auto msg = co_await read_message(conn);
+      co_await conn.write(msg);
+    }
+  });
+  send("\x04" "ping");
+  ASSERT_EQ(receive(4), "ping");
+  const auto& alloc = detail::frame_allocator::local();
+  const auto num_heap_allocations = alloc.num_heap_allocations();
+  for (int i = 0; i < 100; ++i) {
+    send("\x04" "pong");
+    ASSERT_EQ(receive(4), "pong");
+  }
+  EXPECT_EQ(alloc.num_heap_allocations(), num_heap_allocations);
+}
@@ -23,11 +23,22 @@
 #include "net/socket/tcp_accept_socket.hpp"
 #include "net/socket/tcp_stream_socket.hpp"
 
+#include "util/byte_array.hpp"
+#include "util/config.hpp"
 #include "util/error.hpp"
 #include "util/error_or.hpp"
 
 #include "net_test.hpp"
 
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
 using namespace net;
 using namespace net::ip;
 
@@ -47,8 +58,16 @@ public:
   MOCK_METHOD(util::error, poll_once, (bool), (override));
   MOCK_METHOD(void, handle_error, (util::error), (override));
   MOCK_METHOD(void, shutdown, (), (override));
+
+  using multiplexer_base::record_loop_lag;
 };
 
+/// Returns whether the peer closed the connection.
+bool closed_by_peer(tcp_stream_socket sock) {
+  util::byte_array<1> buf;
+  return read(sock, buf) == 0;
+}
+
 } // namespace
 
 TEST(event_handler_acceptor_test, handle_read_event) {
@@ -75,6 +94,224 @@ TEST(event_handler_acceptor_test, handle_read_event) {
   EXPECT_TRUE(factory_called);
 }
 
+TEST(event_handler_acceptor_test, accepts_batches_of_nonblocking_sockets) {
+  multiplexer_mock mpx;
+  EXPECT_CALL(mpx, add(testing::NotNull(), operation::read)).Times(3);
+  auto [accept_socket, port] = UNPACK_EXPRESSION(
+    make_tcp_accept_socket({net::ip::v4_address::localhost, 0}));
+  std::vector<detail::manager_base_ptr> mgrs;
+  auto factory = [&mgrs, &mpx](net::socket handle) -> detail::manager_base_ptr {
+    mgrs.emplace_back(
+      util::make_intrusive<detail::event_handler>(handle, &mpx));
+    return mgrs.back();
+  };
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.accept-batch-size", std::int64_t{2});
+  detail::event_handler_acceptor acceptor{accept_socket, &mpx,
+                                          std::move(factory)};
+  ASSERT_EQ(acceptor.init(cfg), util::none);
+  std::vector<net::socket_guard<tcp_stream_socket>> clients;
+  for (int i = 0; i < 3; ++i) {
+    clients.emplace_back(UNPACK_EXPRESSION(make_connected_tcp_stream_socket(
+      v4_endpoint{v4_address::localhost, port})));
+  }
+  // Connections beyond the batch are left for the next read event
+  test::invoke([&] {
+    EXPECT_EQ(acceptor.handle_read_event(), manager_result::ok);
+  }).until([&mgrs] { return mgrs.size() >= 2; });
+  EXPECT_EQ(mgrs.size(), 2);
+  test::invoke([&] {
+    EXPECT_EQ(acceptor.handle_read_event(), manager_result::ok);
+  }).until([&mgrs] { return mgrs.size() >= 3; });
+  EXPECT_EQ(mgrs.size(), 3);
+  for (const auto& mgr : mgrs) {
+    EXPECT_TRUE(mgr->assumes_nonblocking());
+    EXPECT_NE(fcntl(mgr->handle().id, F_GETFL) & O_NONBLOCK, 0);
+    EXPECT_NE(fcntl(mgr->handle().id, F_GETFD) & FD_CLOEXEC, 0);
+  }
+}
+
+TEST(event_handler_acceptor_test, invalid_batch_size_is_rejected) {
+  multiplexer_mock mpx;
+  auto [accept_socket, port] = UNPACK_EXPRESSION(
+    make_tcp_accept_socket({net::ip::v4_address::localhost, 0}));
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.accept-batch-size", std::int64_t{0});
+  detail::event_handler_acceptor acceptor{
+    accept_socket, &mpx,
+    [](net::socket) -> detail::manager_base_ptr { return nullptr; }};
+  EXPECT_NE(acceptor.init(cfg), util::none);
+}
+
+TEST(event_handler_acceptor_test, sheds_connections_while_overloaded) {
+  multiplexer_mock mpx;
+  EXPECT_CALL(mpx, add(testing::_, testing::_)).Times(0);
+  auto [accept_socket, port] = UNPACK_EXPRESSION(
+    make_tcp_accept_socket({net::ip::v4_address::localhost, 0}));
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.max-loop-lag-us", std::int64_t{1000});
+  cfg.add_config_entry("multiplexer.overload-policy", std::string{"shed"});
+  detail::event_handler_acceptor acceptor{
+    accept_socket, &mpx,
+    [](net::socket) -> detail::manager_base_ptr { return nullptr; }};
+  ASSERT_EQ(acceptor.init(cfg), util::none);
+  EXPECT_FALSE(acceptor.overloaded());
+  mpx.record_loop_lag(std::chrono::milliseconds{10});
+  EXPECT_TRUE(acceptor.overloaded());
+  net::socket_guard client{UNPACK_EXPRESSION(make_connected_tcp_stream_socket(
+    v4_endpoint{v4_address::localhost, port}))};
+  EXPECT_EQ(acceptor.handle_read_event(), manager_result::ok);
+  EXPECT_TRUE(closed_by_peer(client.get()));
+}
+
+TEST(event_handler_acceptor_test, sheds_connections_placed_on_lagging_targets) {
+  multiplexer_mock mpx;
+  multiplexer_mock worker;
+  EXPECT_CALL(mpx, add(testing::_, testing::_)).Times(0);
+  EXPECT_CALL(worker, add(testing::NotNull(), operation::read)).Times(1);
+  auto [accept_socket, port] = UNPACK_EXPRESSION(
+    make_tcp_accept_socket({net::ip::v4_address::localhost, 0}));
+  auto factory = [&worker](net::socket handle) -> detail::manager_base_ptr {
+    return util::make_intrusive<detail::event_handler>(handle, &worker);
+  };
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.max-loop-lag-us", std::int64_t{1000});
+  detail::event_handler_acceptor acceptor{accept_socket, &mpx,
+                                          std::move(factory)};
+  ASSERT_EQ(acceptor.init(cfg), util::none);
+  auto connect = [port] {
+    return net::socket_guard{UNPACK_EXPRESSION(make_connected_tcp_stream_socket(
+      v4_endpoint{v4_address::localhost, port}))};
+  };
+  auto placed = connect();
+  EXPECT_EQ(acceptor.handle_read_event(), manager_result::ok);
+  // The acceptor itself keeps up, only the worker falls behind
+  worker.record_loop_lag(std::chrono::milliseconds{10});
+  EXPECT_FALSE(acceptor.overloaded());
+  auto shed = connect();
+  EXPECT_EQ(acceptor.handle_read_event(), manager_result::ok);
+  EXPECT_TRUE(closed_by_peer(shed.get()));
+}
+
+TEST(event_handler_acceptor_test, limits_connections_per_source) {
+  multiplexer_mock mpx;
+  EXPECT_CALL(mpx, add(testing::NotNull(), operation::read)).Times(2);
+  auto [accept_socket, port] = UNPACK_EXPRESSION(
+    make_tcp_accept_socket({net::ip::v4_address::localhost, 0}));
+  std::size_t num_created = 0;
+  auto factory = [&](net::socket handle) -> detail::manager_base_ptr {
+    ++num_created;
+    return util::make_intrusive<detail::event_handler>(handle, &mpx);
+  };
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.per-ip-connection-rate", std::int64_t{1});
+  cfg.add_config_entry("multiplexer.per-ip-connection-burst", std::int64_t{2});
+  detail::event_handler_acceptor acceptor{accept_socket, &mpx,
+                                          std::move(factory)};
+  ASSERT_EQ(acceptor.init(cfg), util::none);
+  std::vector<net::socket_guard<tcp_stream_socket>> clients;
+  for (int i = 0; i < 3; ++i) {
+    clients.emplace_back(UNPACK_EXPRESSION(make_connected_tcp_stream_socket(
+      v4_endpoint{v4_address::localhost, port})));
+  }
+  EXPECT_EQ(acceptor.handle_read_event(), manager_result::ok);
+  // The multiplexer time does not advance, so the bucket is not refilled
+  EXPECT_EQ(num_created, 2);
+  EXPECT_TRUE(closed_by_peer(clients.back().get()));
+}
+
+TEST(event_handler_acceptor_test, invalid_admission_control_is_rejected) {
+  auto init_with = [](const std::string& key, auto value) {
+    multiplexer_mock mpx;
+    auto [accept_socket, port] = UNPACK_EXPRESSION(
+      make_tcp_accept_socket({net::ip::v4_address::localhost, 0}));
+    util::config cfg;
+    cfg.add_config_entry(key, std::move(value));
+    detail::event_handler_acceptor acceptor{
+      accept_socket, &mpx,
+      [](net::socket) -> detail::manager_base_ptr { return nullptr; }};
+    return acceptor.init(cfg);
+  };
+  EXPECT_NE(init_with("multiplexer.overload-policy", std::string{"drop"}),
+            util::none);
+  EXPECT_NE(init_with("multiplexer.per-ip-connection-rate", std::int64_t{-1}),
+            util::none);
+  EXPECT_NE(init_with("multiplexer.per-ip-max-sources", std::int64_t{0}),
+            util::none);
+  EXPECT_NE(init_with("multiplexer.overload-recheck-ms", std::int64_t{0}),
+            util::none);
+  EXPECT_NE(init_with("multiplexer.overload-recheck-ms", std::int64_t{-1}),
+            util::none);
+  EXPECT_NE(init_with("multiplexer.max-loop-lag-us", std::int64_t{-1}),
+            util::none);
+}
+
+#if defined(__linux__)
+
+TEST(event_handler_acceptor_test, defers_accepting) {
+  multiplexer_mock mpx;
+  auto [accept_socket, port] = UNPACK_EXPRESSION(
+    make_tcp_accept_socket({net::ip::v4_address::localhost, 0}));
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.defer-accept-s", std::int64_t{5});
+  detail::event_handler_acceptor acceptor{
+    accept_socket, &mpx,
+    [](net::socket) -> detail::manager_base_ptr { return nullptr; }};
+  ASSERT_EQ(acceptor.init(cfg), util::none);
+  int timeout = 0;
+  socklen_t len = sizeof(timeout);
+  ASSERT_EQ(getsockopt(accept_socket.id, IPPROTO_TCP, TCP_DEFER_ACCEPT,
+                       &timeout, &len),
+            0);
+  // The kernel rounds the timeout to retransmission intervals
+  EXPECT_GE(timeout, 5);
+}
+
+TEST(event_handler_acceptor_test, forgets_the_least_recently_seen_source) {
+  multiplexer_mock mpx;
+  EXPECT_CALL(mpx, add(testing::NotNull(), operation::read)).Times(3);
+  auto [accept_socket, port] = UNPACK_EXPRESSION(
+    make_tcp_accept_socket({net::ip::v4_address::localhost, 0}));
+  std::size_t num_created = 0;
+  auto factory = [&](net::socket handle) -> detail::manager_base_ptr {
+    ++num_created;
+    return util::make_intrusive<detail::event_handler>(handle, &mpx);
+  };
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.per-ip-connection-rate", std::int64_t{1});
+  cfg.add_config_entry("multiplexer.per-ip-max-sources", std::int64_t{1});
+  detail::event_handler_acceptor acceptor{accept_socket, &mpx,
+                                          std::move(factory)};
+  ASSERT_EQ(acceptor.init(cfg), util::none);
+  // Connects from 127.0.0.<host>, all of 127.0.0.0/8 is local on Linux
+  auto connect_from = [port](std::uint32_t host) {
+    net::socket_guard sock{
+      tcp_stream_socket{::socket(AF_INET, SOCK_STREAM, 0)}};
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl((INADDR_LOOPBACK & ~0xFFu) | host);
+    EXPECT_EQ(::bind(sock.get().id, reinterpret_cast<sockaddr*>(&addr),
+                     sizeof(addr)),
+              0);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    EXPECT_EQ(::connect(sock.get().id, reinterpret_cast<sockaddr*>(&addr),
+                        sizeof(addr)),
+              0);
+    return sock;
+  };
+  std::vector<net::socket_guard<tcp_stream_socket>> clients;
+  clients.emplace_back(connect_from(1));
+  clients.emplace_back(connect_from(2));
+  // The second source evicted the first, which starts with a full bucket
+  clients.emplace_back(connect_from(1));
+  EXPECT_EQ(acceptor.handle_read_event(), manager_result::ok);
+  EXPECT_EQ(num_created, 3);
+  EXPECT_EQ(acceptor.num_tracked_sources(), 1);
+}
+
+#endif
+
 #if defined(LIB_NET_URING)
 
 class uring_manager_mock : public detail::uring_manager {
@@ -0,0 +1,63 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      frame_allocator.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/frame_allocator.hpp"
+
+#include "net_test.hpp"
+
+#include <vector>
+
+using net::detail::frame_allocator;
+
+TEST(frame_allocator, reuses_released_frames) {
+  frame_allocator alloc;
+  auto* frame = alloc.allocate(100);
+  alloc.deallocate(frame, 100);
+  EXPECT_EQ(alloc.num_cached(), 1);
+  // Frames of the same size class share the cache
+  EXPECT_EQ(alloc.allocate(120), frame);
+  EXPECT_EQ(alloc.num_heap_allocations(), 1);
+  EXPECT_EQ(alloc.num_reused(), 1);
+  EXPECT_EQ(alloc.num_cached(), 0);
+  alloc.deallocate(frame, 120);
+}
+
+TEST(frame_allocator, size_classes_are_separate) {
+  frame_allocator alloc;
+  auto* small = alloc.allocate(frame_allocator::granularity);
+  alloc.deallocate(small, frame_allocator::granularity);
+  auto* large = alloc.allocate(frame_allocator::granularity + 1);
+  EXPECT_EQ(alloc.num_heap_allocations(), 2);
+  EXPECT_EQ(alloc.num_cached(), 1);
+  alloc.deallocate(large, frame_allocator::granularity + 1);
+  EXPECT_EQ(alloc.num_cached(), 2);
+}
+
+TEST(frame_allocator, large_frames_are_not_cached) {
+  static constexpr auto size = (frame_allocator::num_size_classes
+                                * frame_allocator::granularity)
+                               + 1;
+  frame_allocator alloc;
+  auto* frame = alloc.allocate(size);
+  alloc.deallocate(frame, size);
+  EXPECT_EQ(alloc.num_cached(), 0);
+  EXPECT_EQ(alloc.num_heap_allocations(), 1);
+}
+
+TEST(frame_allocator, cache_is_bounded) {
+  static constexpr auto num_frames = frame_allocator::max_cached_frames + 10;
+  frame_allocator alloc;
+  std::vector<void*> frames;
+  for (std::size_t i = 0; i < num_frames; ++i) {
+    frames.push_back(alloc.allocate(256));
+  }
+  for (auto* frame : frames) {
+    alloc.deallocate(frame, 256);
+  }
+  EXPECT_EQ(alloc.num_cached(), frame_allocator::max_cached_frames);
+}
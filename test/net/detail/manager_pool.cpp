@@ -0,0 +1,230 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      manager_pool.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/manager_pool.hpp"
+
+#include "net/detail/event_handler.hpp"
+#include "net/detail/stream_transport.hpp"
+
+#include "net/manager_result.hpp"
+#include "net/receive_policy.hpp"
+#include "net/socket/stream_socket.hpp"
+
+#include "util/byte_buffer.hpp"
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/error_or.hpp"
+
+#include "multiplexer_mock.hpp"
+#include "net_test.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace net;
+
+namespace {
+
+struct counting_application {
+  explicit counting_application(std::size_t& num_destroyed)
+    : num_destroyed_{&num_destroyed} {
+    // nop
+  }
+
+  ~counting_application() { ++*num_destroyed_; }
+
+  util::error init(auto& parent, const util::config&) {
+    parent.configure_next_read(receive_policy::up_to(4096));
+    return util::none;
+  }
+
+  manager_result produce(auto&) { return manager_result::ok; }
+
+  bool has_more_data() const noexcept { return false; }
+
+  manager_result consume(auto&, util::const_byte_span) {
+    return manager_result::ok;
+  }
+
+  manager_result handle_timeout(auto&, uint64_t) { return manager_result::ok; }
+
+  std::size_t* num_destroyed_;
+};
+
+using counting_transport
+  = detail::event_stream_transport<counting_application>;
+
+struct pooled_transport : public counting_transport {
+  using counting_transport::counting_transport;
+
+  std::size_t read_buffer_capacity() const noexcept {
+    return read_buffer_.capacity();
+  }
+};
+
+struct throwing_application {
+  explicit throwing_application(bool fail) {
+    if (fail) {
+      throw std::runtime_error("failed");
+    }
+  }
+
+  util::error init(auto&, const util::config&) { return util::none; }
+
+  manager_result produce(auto&) { return manager_result::ok; }
+
+  bool has_more_data() const noexcept { return false; }
+
+  manager_result consume(auto&, util::const_byte_span) {
+    return manager_result::ok;
+  }
+
+  manager_result handle_timeout(auto&, uint64_t) { return manager_result::ok; }
+};
+
+using throwing_transport
+  = detail::event_stream_transport<throwing_application>;
+
+struct plain_manager : public detail::event_handler {
+  plain_manager(net::socket handle, detail::multiplexer_base* mpx)
+    : detail::event_handler(handle, mpx) {
+    // nop
+  }
+
+  manager_result handle_read_event() override { return manager_result::done; }
+
+  manager_result handle_write_event() override {
+    return manager_result::done;
+  }
+};
+
+struct manager_pool_test : public testing::Test {
+  manager_pool_test() { mpx.set_thread_id(std::this_thread::get_id()); }
+
+  stream_socket_pair make_sockets() {
+    auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+    EXPECT_TRUE(nonblocking(sockets.second, true));
+    peers.push_back(sockets.second);
+    return sockets;
+  }
+
+  ~manager_pool_test() {
+    for (const auto peer : peers) {
+      close(peer);
+    }
+  }
+
+  util::config cfg;
+  multiplexer_mock mpx;
+  std::vector<stream_socket> peers;
+  std::size_t num_destroyed{0};
+};
+
+} // namespace
+
+TEST_F(manager_pool_test, released_transports_are_reused) {
+  const auto first = make_sockets();
+  auto mgr = mpx.make_manager<pooled_transport>(first.first, num_destroyed);
+  ASSERT_EQ(mgr->init(cfg), util::none);
+  auto* raw_mgr = mgr.get();
+  EXPECT_EQ(mgr->read_buffer_capacity(), 4096);
+  mgr.reset();
+  EXPECT_EQ(mpx.pool()->num_cached(), 1);
+  // The socket is closed once the transport is released
+  util::byte_buffer buf(1);
+  EXPECT_EQ(read(first.second, buf), 0);
+
+  const auto second = make_sockets();
+  mgr = mpx.make_manager<pooled_transport>(second.first, num_destroyed);
+  EXPECT_EQ(mgr.get(), raw_mgr);
+  EXPECT_EQ(mgr->ref_count(), 1);
+  EXPECT_EQ(mgr->handle(), second.first);
+  EXPECT_EQ(mgr->mask(), operation::none);
+  EXPECT_EQ(mgr->read_buffer_capacity(), 4096);
+  EXPECT_EQ(num_destroyed, 1);
+  EXPECT_EQ(mpx.pool()->num_cached(), 0);
+  EXPECT_EQ(mpx.pool()->num_reused(), 1);
+  ASSERT_EQ(mgr->init(cfg), util::none);
+}
+
+TEST_F(manager_pool_test, next_layers_are_destroyed_on_release) {
+  auto mgr = mpx.make_manager<pooled_transport>(make_sockets().first,
+                                                num_destroyed);
+  mgr.reset();
+  ASSERT_EQ(mpx.pool()->num_cached(), 1);
+  EXPECT_EQ(num_destroyed, 1);
+  mgr = mpx.make_manager<pooled_transport>(make_sockets().first,
+                                           num_destroyed);
+  EXPECT_EQ(num_destroyed, 1);
+  mgr.reset();
+  EXPECT_EQ(num_destroyed, 2);
+}
+
+TEST_F(manager_pool_test, throwing_next_layers_leave_the_transport_pooled) {
+  auto mgr = mpx.make_manager<throwing_transport>(make_sockets().first,
+                                                  false);
+  auto* raw_mgr = mgr.get();
+  mgr.reset();
+  ASSERT_EQ(mpx.pool()->num_cached(), 1);
+  EXPECT_THROW(mpx.make_manager<throwing_transport>(make_sockets().first,
+                                                    true),
+               std::runtime_error);
+  EXPECT_EQ(mpx.pool()->num_cached(), 1);
+  mgr = mpx.make_manager<throwing_transport>(make_sockets().first, false);
+  EXPECT_EQ(mgr.get(), raw_mgr);
+  EXPECT_EQ(mpx.pool()->num_cached(), 0);
+}
+
+TEST_F(manager_pool_test, managers_without_recycle_are_deleted) {
+  auto mgr = mpx.make_manager<plain_manager>(make_sockets().first);
+  mgr.reset();
+  EXPECT_EQ(mpx.pool()->num_cached(), 0);
+}
+
+TEST_F(manager_pool_test, managers_released_on_other_threads_are_deleted) {
+  auto mgr = mpx.make_manager<pooled_transport>(make_sockets().first,
+                                                num_destroyed);
+  std::thread{[mgr = std::move(mgr)]() mutable { mgr.reset(); }}.join();
+  EXPECT_EQ(mpx.pool()->num_cached(), 0);
+  EXPECT_EQ(num_destroyed, 1);
+}
+
+TEST_F(manager_pool_test, managers_made_on_other_threads_are_constructed) {
+  auto mgr = mpx.make_manager<pooled_transport>(make_sockets().first,
+                                                num_destroyed);
+  auto* raw_mgr = mgr.get();
+  mgr.reset();
+  ASSERT_EQ(mpx.pool()->num_cached(), 1);
+  const auto handle = make_sockets().first;
+  std::thread{[&] {
+    mgr = mpx.make_manager<pooled_transport>(handle, num_destroyed);
+  }}.join();
+  EXPECT_NE(mgr.get(), raw_mgr);
+  EXPECT_EQ(mpx.pool()->num_cached(), 1);
+  EXPECT_EQ(mpx.pool()->num_reused(), 0);
+  // Released on the multiplexer thread, the manager is cached nonetheless
+  mgr.reset();
+  EXPECT_EQ(mpx.pool()->num_cached(), 2);
+}
+
+TEST_F(manager_pool_test, caches_are_bounded_per_type) {
+  detail::manager_pool pool{1};
+  pool.set_owner(std::this_thread::get_id());
+  auto* first = new plain_manager(invalid_socket, &mpx);
+  auto* second = new plain_manager(invalid_socket, &mpx);
+  EXPECT_TRUE(pool.put(*first));
+  EXPECT_FALSE(pool.put(*second));
+  EXPECT_EQ(pool.num_cached(), 1);
+  delete second;
+  EXPECT_EQ(pool.take<pooled_transport>(), nullptr);
+  EXPECT_EQ(pool.take<plain_manager>(), first);
+  EXPECT_EQ(pool.take<plain_manager>(), nullptr);
+  EXPECT_TRUE(pool.put(*first));
+}
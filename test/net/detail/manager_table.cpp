@@ -0,0 +1,108 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      manager_table.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/manager_table.hpp"
+
+#include "net/detail/manager_base.hpp"
+
+#include "net/socket/stream_socket.hpp"
+
+#include "util/error_or.hpp"
+#include "util/intrusive_ptr.hpp"
+
+#include "multiplexer_mock.hpp"
+#include "net_test.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace net;
+
+using detail::manager_base;
+using detail::manager_table;
+
+namespace {
+
+struct manager_table_test : public testing::Test {
+  manager_table_test() {
+    auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+    first = util::make_intrusive<manager_base>(sockets.first, &mpx);
+    second = util::make_intrusive<manager_base>(sockets.second, &mpx);
+  }
+
+  multiplexer_mock mpx;
+  // Managers close their sockets once released by the test and the table
+  detail::manager_base_ptr first;
+  detail::manager_base_ptr second;
+  manager_table table;
+};
+
+} // namespace
+
+TEST_F(manager_table_test, emplace_and_find) {
+  const auto fd = first->handle().id;
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.find(fd), nullptr);
+  EXPECT_EQ(table.find(invalid_socket_id), nullptr);
+  EXPECT_EQ(table.emplace(first), first);
+  EXPECT_EQ(table.size(), 1);
+  EXPECT_EQ(table.find(fd), first.get());
+  EXPECT_EQ(table.find(second->handle().id), nullptr);
+  EXPECT_EQ(table.find(fd, table.generation(fd)), first.get());
+  EXPECT_EQ(table.find(fd, table.generation(fd) + 1), nullptr);
+}
+
+TEST_F(manager_table_test, erase) {
+  table.emplace(first);
+  table.emplace(second);
+  EXPECT_EQ(table.size(), 2);
+  EXPECT_TRUE(table.erase(first->handle().id));
+  EXPECT_FALSE(table.erase(first->handle().id));
+  EXPECT_EQ(table.find(first->handle().id), nullptr);
+  EXPECT_EQ(table.size(), 1);
+  auto it = table.erase(table.begin());
+  EXPECT_EQ(it, table.end());
+  EXPECT_TRUE(table.empty());
+}
+
+TEST_F(manager_table_test, reused_descriptors_are_detected) {
+  const auto fd = first->handle().id;
+  table.emplace(first);
+  const auto old_generation = table.generation(fd);
+  // Destroying the manager closes the socket, freeing the descriptor
+  table.erase(fd);
+  first.reset();
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  auto reused = util::make_intrusive<manager_base>(sockets.first, &mpx);
+  auto other = util::make_intrusive<manager_base>(sockets.second, &mpx);
+  ASSERT_EQ(reused->handle().id, fd);
+  table.emplace(reused);
+  // Events for the previous manager of the descriptor are detected
+  EXPECT_NE(table.generation(fd), old_generation);
+  EXPECT_EQ(table.find(fd, old_generation), nullptr);
+  EXPECT_EQ(table.find(fd, table.generation(fd)), reused.get());
+}
+
+TEST_F(manager_table_test, iteration) {
+  table.emplace(second);
+  table.emplace(first);
+  std::vector<socket_id> handles;
+  for (auto& mgr : table) {
+    handles.push_back(mgr->handle().id);
+  }
+  std::vector<socket_id> expected{first->handle().id, second->handle().id};
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(handles, expected);
+  // Erasing while iterating visits all managers
+  auto it = table.begin();
+  while (it != table.end()) {
+    it = table.erase(it);
+  }
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.begin(), table.end());
+}
@@ -0,0 +1,62 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      multiplexer_stats.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/multiplexer_stats.hpp"
+
+#include "net_test.hpp"
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+using net::detail::multiplexer_stats;
+
+TEST(multiplexer_stats, record) {
+  multiplexer_stats stats;
+  stats.add_bytes_read(100);
+  stats.add_bytes_written(50);
+  stats.add_accepted();
+  stats.record({3, 2ms, 1us, 10us});
+  stats.add_bytes_read(20);
+  stats.record({1, 1ms, 0ns, 5us});
+  const auto snapshot = stats.read();
+  EXPECT_EQ(snapshot.num_iterations, 2);
+  EXPECT_EQ(snapshot.num_events, 4);
+  EXPECT_EQ(snapshot.num_accepted, 1);
+  EXPECT_EQ(snapshot.bytes_read, 120);
+  EXPECT_EQ(snapshot.bytes_written, 50);
+  EXPECT_EQ(snapshot.events_per_iteration.max, 3);
+  EXPECT_EQ(snapshot.blocked_ns.sum, 3000000);
+  EXPECT_EQ(snapshot.timeouts_ns.sum, 1000);
+  EXPECT_EQ(snapshot.events_ns.sum, 15000);
+  EXPECT_EQ(snapshot.bytes_read_per_iteration.max, 100);
+  EXPECT_EQ(snapshot.bytes_written_per_iteration.count, 2);
+}
+
+TEST(multiplexer_stats, discard) {
+  multiplexer_stats stats;
+  stats.add_bytes_read(100);
+  stats.add_accepted();
+  stats.discard();
+  stats.record({});
+  const auto snapshot = stats.read();
+  EXPECT_EQ(snapshot.num_iterations, 1);
+  EXPECT_EQ(snapshot.num_accepted, 0);
+  EXPECT_EQ(snapshot.bytes_read, 0);
+}
+
+TEST(multiplexer_stats, accepts_per_second) {
+  multiplexer_stats::snapshot before;
+  multiplexer_stats::snapshot after;
+  before.time = multiplexer_stats::clock_type::time_point{1s};
+  after.time = multiplexer_stats::clock_type::time_point{3s};
+  before.num_accepted = 10;
+  after.num_accepted = 30;
+  EXPECT_DOUBLE_EQ(net::detail::accepts_per_second(before, after), 10.0);
+  EXPECT_DOUBLE_EQ(net::detail::accepts_per_second(after, after), 0.0);
+}
@@ -14,17 +14,17 @@
 #include "net/operation.hpp"
 #include "net/socket_guard.hpp"
 
-#include "net/socket/pipe_socket.hpp"
+#include "net/socket/event_socket.hpp"
 #include "net/socket/stream_socket.hpp"
 
-#include "util/binary_serializer.hpp"
-#include "util/byte_buffer.hpp"
 #include "util/config.hpp"
 #include "util/error.hpp"
 #include "util/error_or.hpp"
 
 #include "net_test.hpp"
 
+#include <vector>
+
 #include "net/detail/uring_manager.hpp"
 using event_pollset_updater
   = net::detail::pollset_updater<net::detail::event_handler>;
@@ -41,6 +41,10 @@ namespace {
 
 class multiplexer_mock : public detail::multiplexer_base {
 public:
+  using multiplexer_base::push_command;
+
+  void set_shutting_down() { shutting_down_ = true; }
+
   MOCK_METHOD(void, add, (detail::manager_base_ptr, operation), (override));
 
 private:
@@ -57,8 +61,8 @@ public:
 
 struct event_pollset_updater_test : public ::testing::Test {
   event_pollset_updater_test() {
-    auto [reader, writer] = UNPACK_EXPRESSION(make_pipe());
-    pipe_writer = writer;
+    auto [reader, writer] = UNPACK_EXPRESSION(make_event_socket());
+    event_writer = writer;
     updater = std::make_unique<event_pollset_updater>(reader, &mpx);
   }
 
@@ -66,15 +70,13 @@ struct event_pollset_updater_test : public ::testing::Test {
     EXPECT_EQ(updater->init(util::config{}), util::none);
   }
 
-  template <class... Ts>
-  void write(pipe_socket handle, Ts&&... ts) {
-    util::byte_buffer buf;
-    util::binary_serializer sink{buf};
-    sink(std::forward<Ts>(ts)...);
-    EXPECT_EQ(net::write(handle, buf), static_cast<ptrdiff_t>(buf.size()));
+  void push(detail::pollset_opcode code, detail::manager_base* mgr,
+            operation op) {
+    EXPECT_TRUE(mpx.push_command({code, mgr, op}));
+    EXPECT_TRUE(notify(*event_writer));
   }
 
-  socket_guard<pipe_socket> pipe_writer;
+  socket_guard<event_socket> event_writer;
   multiplexer_mock mpx;
   std::unique_ptr<event_pollset_updater> updater;
 };
@@ -99,8 +101,7 @@ TEST_F(event_pollset_updater_test, handle_shutdown) {
   EXPECT_CALL(mpx, handle_error).Times(0);
   EXPECT_CALL(mpx, shutdown).Times(1);
 
-  write(*pipe_writer, detail::pollset_opcode::shutdown, nullptr,
-        operation::none);
+  push(detail::pollset_opcode::shutdown, nullptr, operation::none);
   EXPECT_EQ(updater->handle_read_event(), manager_result::done);
 }
 
@@ -117,8 +118,45 @@ TEST_F(event_pollset_updater_test, handle_add) {
   auto mgr = util::make_intrusive<detail::event_handler>(sock2, &mpx);
   mgr->ref();
   EXPECT_EQ(mgr->ref_count(), 2);
-  write(*pipe_writer, detail::pollset_opcode::add, mgr.get(), operation::read);
+  push(detail::pollset_opcode::add, mgr.get(), operation::read);
+  EXPECT_EQ(updater->handle_read_event(), manager_result::ok);
+  EXPECT_EQ(mgr->ref_count(), 1);
+}
+
+TEST_F(event_pollset_updater_test, handle_all_commands_at_once) {
+  static constexpr int num_managers = 3;
+  EXPECT_CALL(mpx, add(testing::NotNull(), operation::read))
+    .Times(num_managers);
+  EXPECT_CALL(mpx, shutdown).Times(0);
+
+  std::vector<socket_guard<stream_socket>> guards;
+  std::vector<detail::manager_base_ptr> mgrs;
+  for (int i = 0; i < num_managers; ++i) {
+    auto [sock1, sock2] = UNPACK_EXPRESSION(net::make_stream_socket_pair());
+    guards.emplace_back(sock1);
+    auto& mgr = mgrs.emplace_back(
+      util::make_intrusive<detail::event_handler>(sock2, &mpx));
+    mgr->ref();
+    push(detail::pollset_opcode::add, mgr.get(), operation::read);
+  }
+  // A single wakeup handles all queued commands
   EXPECT_EQ(updater->handle_read_event(), manager_result::ok);
+  for (const auto& mgr : mgrs) {
+    EXPECT_EQ(mgr->ref_count(), 1);
+  }
+}
+
+TEST_F(event_pollset_updater_test, drop_add_during_shutdown) {
+  EXPECT_CALL(mpx, add).Times(0);
+  EXPECT_CALL(mpx, shutdown).Times(0);
+
+  auto [sock1, sock2] = UNPACK_EXPRESSION(net::make_stream_socket_pair());
+  const net::socket_guard guard{sock1};
+  auto mgr = util::make_intrusive<detail::event_handler>(sock2, &mpx);
+  mgr->ref();
+  push(detail::pollset_opcode::add, mgr.get(), operation::read);
+  mpx.set_shutting_down();
+  EXPECT_EQ(updater->handle_read_event(), manager_result::done);
   EXPECT_EQ(mgr->ref_count(), 1);
 }
 
@@ -128,6 +166,8 @@ namespace {
 
 class uring_multiplexer_mock : public detail::uring_multiplexer {
 public:
+  using multiplexer_base::push_command;
+
   MOCK_METHOD(void, add, (detail::manager_base_ptr, operation), (override));
 
 private:
@@ -143,8 +183,8 @@ public:
 
 struct uring_pollset_updater_test : public ::testing::Test {
   uring_pollset_updater_test() {
-    auto [reader, writer] = UNPACK_EXPRESSION(make_pipe());
-    pipe_writer = writer;
+    auto [reader, writer] = UNPACK_EXPRESSION(make_event_socket());
+    event_writer = writer;
     updater = std::make_unique<uring_pollset_updater>(reader, &mpx);
   }
 
@@ -152,15 +192,7 @@ struct uring_pollset_updater_test : public ::testing::Test {
     EXPECT_EQ(updater->init(util::config{}), util::none);
   }
 
-  template <class... Ts>
-  void write(pipe_socket handle, Ts&&... ts) {
-    util::byte_buffer buf;
-    util::binary_serializer sink{buf};
-    sink(std::forward<Ts>(ts)...);
-    EXPECT_EQ(net::write(handle, buf), static_cast<ptrdiff_t>(buf.size()));
-  }
-
-  socket_guard<pipe_socket> pipe_writer;
+  socket_guard<event_socket> event_writer;
   uring_multiplexer_mock mpx;
   std::unique_ptr<uring_pollset_updater> updater;
 };
@@ -189,8 +221,8 @@ TEST_F(uring_pollset_updater_test, handle_shutdown) {
             util::none);
   mpx.set_thread_id(std::this_thread::get_id());
   EXPECT_EQ(updater->enable(operation::read), manager_result::ok);
-  write(*pipe_writer, detail::pollset_opcode::shutdown, nullptr,
-        operation::none);
+  EXPECT_TRUE(mpx.push_command(
+    {detail::pollset_opcode::shutdown, nullptr, operation::none}));
   EXPECT_EQ(mpx.poll_once(false), util::none);
 }
 
@@ -215,7 +247,8 @@ TEST_F(uring_pollset_updater_test, handle_add) {
   auto mgr = util::make_intrusive<detail::event_handler>(sock2, &mpx);
   mgr->ref();
   EXPECT_EQ(mgr->ref_count(), 2);
-  write(*pipe_writer, detail::pollset_opcode::add, mgr.get(), operation::read);
+  EXPECT_TRUE(mpx.push_command(
+    {detail::pollset_opcode::add, mgr.get(), operation::read}));
   mpx.set_thread_id(std::this_thread::get_id());
   EXPECT_EQ(mpx.poll_once(false), util::none);
 }
@@ -14,7 +14,9 @@
 #  include "net/detail/uring_manager.hpp"
 #endif
 
+#include "net/multiplexer.hpp"
 #include "net/receive_policy.hpp"
+#include "net/send_handle.hpp"
 #include "net/socket/stream_socket.hpp"
 
 #include "util/byte_span.hpp"
@@ -26,10 +28,12 @@
 #include "net_test.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <numeric>
 #include <ranges>
 #include <thread>
+#include <vector>
 
 using namespace net;
 
@@ -39,6 +43,8 @@ struct test_data {
   util::byte_buffer received;
   util::const_byte_span data;
   uint64_t last_timeout_id;
+  std::size_t num_write_blocked{0};
+  std::size_t num_write_unblocked{0};
 };
 
 struct dummy_application {
@@ -73,6 +79,10 @@ struct dummy_application {
     return manager_result::ok;
   }
 
+  void on_write_blocked(auto&) { ++data_.num_write_blocked; }
+
+  void on_write_unblocked(auto&) { ++data_.num_write_unblocked; }
+
 private:
   test_data& data_;
 };
@@ -107,6 +117,36 @@ struct event_stream_transport_test : public testing::Test, public test_data {
   event_stream_transport mgr;
 };
 
+/// Runs a transport on a multiplexer that is polled by the test thread.
+/// Suites add their config entries to `cfg` before calling init().
+struct multiplexer_transport_test : public testing::Test, public test_data {
+  multiplexer_transport_test()
+    : sockets{UNPACK_EXPRESSION(make_stream_socket_pair())} {
+    cfg.add_config_entry("multiplexer.listen", false);
+    EXPECT_TRUE(nonblocking(sockets.second, true));
+  }
+
+  ~multiplexer_transport_test() {
+    if (sockets.second != invalid_socket) {
+      close(sockets.second);
+    }
+  }
+
+  /// Initializes the multiplexer and adds a transport for the first socket.
+  void init() {
+    ASSERT_EQ(mpx.init(multiplexer::manager_factory{}, cfg), util::none);
+    mpx.set_thread_id(std::this_thread::get_id());
+    mgr = util::make_intrusive<event_stream_transport>(sockets.first, &mpx,
+                                                       *this);
+    mpx.add(mgr, operation::read);
+  }
+
+  stream_socket_pair sockets;
+  util::config cfg;
+  multiplexer mpx;
+  util::intrusive_ptr<event_stream_transport> mgr;
+};
+
 } // namespace
 
 TEST_F(event_stream_transport_test, handle_read_event) {
@@ -139,6 +179,34 @@ TEST_F(event_stream_transport_test, partial_read) {
     std::equal(received.begin(), received.end(), data_buffer.begin()));
 }
 
+TEST_F(event_stream_transport_test, consumes_bytes_received_elsewhere) {
+  struct consuming_transport : public event_stream_transport {
+    using event_stream_transport::event_stream_transport;
+    using event_stream_transport::consume_received;
+  };
+  auto pair = UNPACK_EXPRESSION(make_stream_socket_pair());
+  consuming_transport transport{pair.first, &mpx, *this};
+  ASSERT_EQ(transport.init(cfg), util::none);
+  transport.mask_set(operation::read);
+  // Chunks smaller and larger than the read size are consumed in order
+  for (const std::size_t chunk_size : {300, 1000, 2748, 1067, 5}) {
+    auto chunk = data.first(chunk_size);
+    data = data.subspan(chunk_size);
+    ASSERT_EQ(transport.consume_received(chunk), manager_result::ok);
+    EXPECT_TRUE(chunk.empty());
+  }
+  EXPECT_EQ(received.size(), 5 * dummy_application::min_read_size);
+  EXPECT_TRUE(
+    std::equal(received.begin(), received.end(), data_buffer.begin()));
+  // Remaining bytes are left untouched once reading is disabled
+  transport.mask_set(operation::none);
+  auto chunk = data.first(2048);
+  ASSERT_EQ(transport.consume_received(chunk), manager_result::ok);
+  EXPECT_EQ(chunk.size(), 2048);
+  EXPECT_EQ(received.size(), 5 * dummy_application::min_read_size);
+  close(pair.second);
+}
+
 TEST_F(event_stream_transport_test, handle_write_event) {
   size_t received = 0;
   util::byte_array<32768> buf;
@@ -167,6 +235,290 @@ TEST_F(event_stream_transport_test, timeout_handling) {
   EXPECT_EQ(last_timeout_id, 42);
 }
 
+namespace {
+
+struct send_handle_test : public multiplexer_transport_test {
+  send_handle_test() { init(); }
+
+  util::byte_buffer receive_until(std::size_t num_bytes) {
+    return receive_until(mpx, num_bytes);
+  }
+
+  util::byte_buffer receive_until(multiplexer& poller, std::size_t num_bytes) {
+    using namespace std::chrono_literals;
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    util::byte_buffer result;
+    util::byte_array<1024> buf;
+    while ((result.size() < num_bytes)
+           && (std::chrono::steady_clock::now() < deadline)) {
+      EXPECT_EQ(poller.poll_once(false), util::none);
+      const auto res = read(sockets.second, buf);
+      if (res > 0) {
+        result.insert(result.end(), buf.begin(), buf.begin() + res);
+      }
+    }
+    return result;
+  }
+};
+
+} // namespace
+
+TEST_F(send_handle_test, send_from_multiplexer_thread) {
+  const auto handle = mgr->make_send_handle();
+  EXPECT_EQ(handle.id(), sockets.first);
+  EXPECT_FALSE(handle.expired());
+  EXPECT_TRUE(handle.send(util::byte_buffer(16, std::byte{1})));
+  EXPECT_TRUE(handle.send(util::byte_buffer(16, std::byte{2})));
+  // Buffers are spliced into the write queue by the next iteration
+  EXPECT_TRUE(mgr->write_queue().empty());
+  const auto received = receive_until(32);
+  ASSERT_EQ(received.size(), 32);
+  EXPECT_EQ(received.front(), std::byte{1});
+  EXPECT_EQ(received.back(), std::byte{2});
+}
+
+TEST_F(send_handle_test, send_from_other_threads) {
+  static constexpr std::size_t num_threads = 4;
+  static constexpr std::size_t num_buffers = 100;
+  static constexpr std::size_t buffer_size = 64;
+  const auto handle = mgr->make_send_handle();
+  {
+    std::vector<std::jthread> threads;
+    for (std::size_t t = 0; t < num_threads; ++t) {
+      threads.emplace_back([handle, t](std::stop_token stop) {
+        for (std::size_t i = 0; i < num_buffers; ++i) {
+          util::byte_buffer buf(buffer_size, static_cast<std::byte>(t));
+          // The queue may be full until the multiplexer catches up
+          while (!handle.send(std::move(buf))) {
+            if (stop.stop_requested()) {
+              return;
+            }
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+    const auto received = receive_until(num_threads * num_buffers
+                                        * buffer_size);
+    EXPECT_EQ(received.size(), num_threads * num_buffers * buffer_size);
+  }
+}
+
+TEST_F(send_handle_test, send_follows_migration) {
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.listen", false);
+  multiplexer other;
+  ASSERT_EQ(other.init(multiplexer::manager_factory{}, other_cfg), util::none);
+  other.set_thread_id(std::this_thread::get_id());
+  const auto handle = mgr->make_send_handle();
+  EXPECT_TRUE(handle.send(util::byte_buffer(16, std::byte{1})));
+  ASSERT_TRUE(mpx.migrate(mgr, other));
+  // Flushes the first buffer and hands the transport over
+  for (int i = 0; (i < 10) && (mgr->mpx() != &other); ++i) {
+    EXPECT_EQ(mpx.poll_once(false), util::none);
+  }
+  ASSERT_EQ(mgr->mpx(), &other);
+  // Queued while migrating, flushed once the transport is attached
+  EXPECT_TRUE(handle.send(util::byte_buffer(16, std::byte{2})));
+  const auto received = receive_until(other, 32);
+  ASSERT_EQ(received.size(), 32);
+  EXPECT_EQ(received.front(), std::byte{1});
+  EXPECT_EQ(received.back(), std::byte{2});
+  // Later sends are flushed by the new multiplexer
+  EXPECT_TRUE(handle.send(util::byte_buffer(16, std::byte{3})));
+  const auto later = receive_until(other, 16);
+  ASSERT_EQ(later.size(), 16);
+  EXPECT_EQ(later.front(), std::byte{3});
+  mgr.reset();
+}
+
+TEST_F(send_handle_test, expires_with_transport) {
+  const auto handle = mgr->make_send_handle();
+  EXPECT_TRUE(handle.send(util::byte_buffer(16)));
+  // Closing the peer removes the transport from the multiplexer
+  close(sockets.second);
+  sockets.second = stream_socket{};
+  mgr.reset();
+  for (int i = 0; (i < 10) && !handle.expired(); ++i) {
+    EXPECT_EQ(mpx.poll_once(false), util::none);
+  }
+  EXPECT_TRUE(handle.expired());
+  EXPECT_FALSE(handle.send(util::byte_buffer(16)));
+  EXPECT_FALSE(send_handle<util::byte_buffer>{}.send(util::byte_buffer(16)));
+}
+
+TEST_F(send_handle_test, send_fails_after_shutdown) {
+  const auto handle = mgr->make_send_handle();
+  mpx.shutdown();
+  // Queued, but no flush can be scheduled anymore
+  EXPECT_FALSE(handle.send(util::byte_buffer(16)));
+  EXPECT_FALSE(handle.send(util::byte_buffer(16)));
+}
+
+namespace {
+
+struct drain_test : public multiplexer_transport_test {
+  /// Initializes the multiplexer and enqueues `num_bytes` on the transport,
+  /// which is owned by the multiplexer afterwards.
+  void init(std::int64_t drain_timeout_ms, std::size_t num_bytes) {
+    cfg.add_config_entry("multiplexer.drain-timeout-ms", drain_timeout_ms);
+    multiplexer_transport_test::init();
+    mgr->enqueue(util::byte_buffer(num_bytes, std::byte{1}));
+    mgr.reset();
+  }
+
+  /// Polls until all managers are removed, reading from the peer if set.
+  std::size_t poll_until_empty(bool read_peer) {
+    using namespace std::chrono_literals;
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    std::size_t num_received = 0;
+    util::byte_array<65536> buf;
+    while ((mpx.num_socket_managers() > 0)
+           && (std::chrono::steady_clock::now() < deadline)) {
+      EXPECT_EQ(mpx.poll_once(false), util::none);
+      while (read_peer) {
+        const auto res = read(sockets.second, buf);
+        if (res <= 0) {
+          break;
+        }
+        num_received += static_cast<std::size_t>(res);
+      }
+    }
+    EXPECT_EQ(mpx.num_socket_managers(), 0);
+    return num_received;
+  }
+};
+
+} // namespace
+
+TEST_F(drain_test, shutdown_flushes_pending_writes) {
+  static constexpr std::size_t num_bytes = 1 << 20;
+  init(5000, num_bytes);
+  mpx.shutdown();
+  EXPECT_EQ(poll_until_empty(true), num_bytes);
+  const auto& stats = mpx.shutdown_stats();
+  EXPECT_EQ(stats.num_managers, 1);
+  EXPECT_EQ(stats.num_closed, 0);
+  EXPECT_EQ(stats.bytes_pending, num_bytes);
+  EXPECT_EQ(stats.bytes_dropped, 0);
+  EXPECT_EQ(stats.bytes_flushed(), num_bytes);
+}
+
+TEST_F(drain_test, shutdown_closes_after_drain_timeout) {
+  using namespace std::chrono_literals;
+  // More than fits into the socket buffers, while the peer never reads
+  static constexpr std::size_t num_bytes = 16 << 20;
+  init(20, num_bytes);
+  const auto start = std::chrono::steady_clock::now();
+  mpx.shutdown();
+  poll_until_empty(false);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+  const auto& stats = mpx.shutdown_stats();
+  EXPECT_EQ(stats.num_managers, 1);
+  EXPECT_EQ(stats.num_closed, 1);
+  EXPECT_EQ(stats.bytes_pending, num_bytes);
+  EXPECT_GT(stats.bytes_dropped, 0);
+  EXPECT_EQ(stats.bytes_flushed() + stats.bytes_dropped, num_bytes);
+}
+
+TEST_F(drain_test, zero_drain_timeout_closes_immediately) {
+  static constexpr std::size_t num_bytes = 1024;
+  init(0, num_bytes);
+  mpx.shutdown();
+  const auto& stats = mpx.shutdown_stats();
+  EXPECT_EQ(stats.num_closed, 1);
+  EXPECT_EQ(stats.bytes_dropped, num_bytes);
+  EXPECT_EQ(poll_until_empty(true), 0);
+}
+
+namespace {
+
+struct watermark_test : public multiplexer_transport_test {
+  watermark_test() {
+    cfg.add_config_entry("transport.write-high-watermark",
+                         std::int64_t{1 << 20});
+    cfg.add_config_entry("transport.write-low-watermark",
+                         std::int64_t{64 << 10});
+  }
+
+  /// Reads from the peer until the transport flushed its queue.
+  void drain() {
+    util::byte_array<65536> buf;
+    for (std::size_t i = 0; (i < 10'000) && (mgr->num_enqueued_bytes() > 0);
+         ++i) {
+      EXPECT_EQ(mpx.poll_once(false), util::none);
+      while (read(sockets.second, buf) > 0) {
+        // nop
+      }
+    }
+    EXPECT_EQ(mgr->num_enqueued_bytes(), 0);
+  }
+};
+
+} // namespace
+
+TEST_F(watermark_test, crossing_watermarks_notifies_next_layer) {
+  init();
+  mgr->enqueue(util::byte_buffer((1 << 20) - 1, std::byte{1}));
+  EXPECT_FALSE(mgr->write_blocked());
+  EXPECT_EQ(num_write_blocked, 0);
+  mgr->enqueue(util::byte_buffer(1, std::byte{1}));
+  EXPECT_TRUE(mgr->write_blocked());
+  EXPECT_EQ(num_write_blocked, 1);
+  // Notifications are only sent on transitions
+  mgr->enqueue(util::byte_buffer(1024, std::byte{1}));
+  EXPECT_EQ(num_write_blocked, 1);
+  EXPECT_FALSE(mgr->reading_paused());
+  drain();
+  EXPECT_FALSE(mgr->write_blocked());
+  EXPECT_EQ(num_write_blocked, 1);
+  EXPECT_EQ(num_write_unblocked, 1);
+}
+
+TEST_F(watermark_test, reads_pause_while_writing_is_blocked) {
+  cfg.add_config_entry("transport.pause-reads-when-blocked", true);
+  init();
+  // More than fits into the socket buffers, while the peer does not read
+  mgr->enqueue(util::byte_buffer(16 << 20, std::byte{1}));
+  ASSERT_TRUE(mgr->write_blocked());
+  EXPECT_TRUE(mgr->reading_paused());
+  EXPECT_FALSE(mgr->mask_contains(operation::read));
+  util::byte_array<1024> request{};
+  ASSERT_EQ(write(sockets.second, request), request.size());
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(mpx.poll_once(false), util::none);
+  }
+  EXPECT_TRUE(received.empty());
+  drain();
+  EXPECT_FALSE(mgr->reading_paused());
+  EXPECT_TRUE(mgr->mask_contains(operation::read));
+  for (int i = 0; (i < 10) && received.empty(); ++i) {
+    EXPECT_EQ(mpx.poll_once(false), util::none);
+  }
+  EXPECT_EQ(received.size(), request.size());
+}
+
+TEST_F(watermark_test, paused_managers_stay_registered) {
+  init();
+  const auto num_managers = mpx.num_socket_managers();
+  mgr->pause_reading();
+  mgr->enqueue(util::byte_buffer(1024, std::byte{1}));
+  drain();
+  // The write interest is gone, but the manager waits for reads to resume
+  EXPECT_EQ(mgr->mask(), operation::none);
+  EXPECT_EQ(mpx.num_socket_managers(), num_managers);
+  mgr->register_reading();
+  EXPECT_TRUE(mgr->mask_contains(operation::read));
+}
+
+TEST_F(watermark_test, invalid_watermarks_are_rejected) {
+  cfg.set_config_entry("transport.write-low-watermark",
+                       std::int64_t{1 << 20});
+  ASSERT_EQ(mpx.init(multiplexer::manager_factory{}, cfg), util::none);
+  event_stream_transport transport{sockets.first, &mpx, *this};
+  EXPECT_NE(transport.init(cfg), util::none);
+}
+
 #if defined(LIB_NET_URING)
 
 using uring_stream_transport
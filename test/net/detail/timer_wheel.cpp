@@ -0,0 +1,211 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      timer_wheel.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/detail/timer_wheel.hpp"
+
+#include "net/timeout_entry.hpp"
+
+#include "net_test.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace net;
+using namespace std::chrono_literals;
+
+using detail::timer_wheel;
+
+namespace {
+
+const timer_wheel::time_point origin{};
+
+struct timer_wheel_test : public testing::Test {
+  /// Schedules a timeout with the next ID, `in` after the origin.
+  std::uint64_t schedule(timer_wheel::duration in) {
+    wheel.insert(timeout_entry{0, origin + in, next_id});
+    return next_id++;
+  }
+
+  /// Expires all timeouts that are due `at` after the origin.
+  std::vector<std::uint64_t> expire(timer_wheel::duration at) {
+    std::vector<std::uint64_t> ids;
+    wheel.expire(origin + at, [&ids](const timeout_entry& entry) {
+      ids.push_back(entry.id());
+    });
+    return ids;
+  }
+
+  timer_wheel wheel{1ms, origin};
+  std::uint64_t next_id{0};
+};
+
+using ids = std::vector<std::uint64_t>;
+
+} // namespace
+
+TEST_F(timer_wheel_test, empty) {
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.next_expiry(), std::nullopt);
+  EXPECT_EQ(expire(1h), ids{});
+}
+
+TEST_F(timer_wheel_test, expires_in_order) {
+  schedule(3ms);
+  schedule(1ms);
+  schedule(2ms);
+  schedule(1ms);
+  EXPECT_EQ(wheel.size(), 4);
+  EXPECT_EQ(wheel.next_expiry(), origin + 1ms);
+  // Ties are broken by the ID
+  EXPECT_EQ(expire(10ms), (ids{1, 3, 2, 0}));
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.next_expiry(), std::nullopt);
+}
+
+TEST_F(timer_wheel_test, does_not_expire_early) {
+  schedule(5ms + 500us);
+  EXPECT_EQ(expire(5ms), ids{});
+  // Same tick, but before the deadline
+  EXPECT_EQ(expire(5ms + 499us), ids{});
+  EXPECT_EQ(wheel.next_expiry(), origin + 5ms + 500us);
+  EXPECT_EQ(expire(5ms + 500us), ids{0});
+}
+
+TEST_F(timer_wheel_test, cascades_from_upper_levels) {
+  const std::vector<timer_wheel::duration> delays{300ms, 70s, 5h, 60 * 24h};
+  for (auto delay : delays) {
+    schedule(delay);
+  }
+  for (std::uint64_t id = 0; id < delays.size(); ++id) {
+    const auto delay = delays[id];
+    // The next expiry never lies after the deadline
+    ASSERT_TRUE(wheel.next_expiry());
+    EXPECT_LE(*wheel.next_expiry(), origin + delay);
+    EXPECT_EQ(expire(delay - 1ms), ids{});
+    EXPECT_EQ(wheel.next_expiry(), origin + delay);
+    EXPECT_EQ(expire(delay), ids{id});
+  }
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST_F(timer_wheel_test, advances_over_many_ticks) {
+  for (auto i = 1; i <= 1000; ++i) {
+    schedule(i * 7ms);
+  }
+  ids expected;
+  for (std::uint64_t id = 0; id < 1000; ++id) {
+    expected.push_back(id);
+  }
+  ids expired;
+  for (auto now = 0ms; now <= 7000ms; now += 13ms) {
+    for (auto id : expire(now)) {
+      expired.push_back(id);
+    }
+  }
+  for (auto id : expire(7000ms)) {
+    expired.push_back(id);
+  }
+  EXPECT_EQ(expired, expected);
+}
+
+TEST_F(timer_wheel_test, past_deadlines_expire_immediately) {
+  EXPECT_EQ(expire(10ms), ids{});
+  schedule(1ms);
+  EXPECT_EQ(wheel.next_expiry(), origin + 1ms);
+  EXPECT_EQ(expire(10ms), ids{0});
+}
+
+TEST_F(timer_wheel_test, timeouts_scheduled_while_expiring) {
+  schedule(1ms);
+  ids expired;
+  wheel.expire(origin + 1ms, [&](const timeout_entry& entry) {
+    expired.push_back(entry.id());
+    // Due immediately, but only expired by the next call
+    schedule(0ms);
+  });
+  EXPECT_EQ(expired, ids{0});
+  EXPECT_EQ(wheel.size(), 1);
+  EXPECT_EQ(expire(1ms), ids{1});
+}
+
+TEST_F(timer_wheel_test, cancel) {
+  timer_wheel::timer_list owner;
+  wheel.insert(timeout_entry{0, origin + 1ms, 0}, &owner);
+  wheel.insert(timeout_entry{0, origin + 300ms, 1}, &owner);
+  wheel.insert(timeout_entry{0, origin + 2ms, 2}, &owner);
+  EXPECT_TRUE(wheel.cancel(owner, 0));
+  EXPECT_FALSE(wheel.cancel(owner, 0));
+  EXPECT_TRUE(wheel.cancel(owner, 1));
+  EXPECT_EQ(wheel.size(), 1);
+  EXPECT_EQ(wheel.next_expiry(), origin + 2ms);
+  EXPECT_EQ(expire(1h), ids{2});
+  EXPECT_TRUE(owner.empty());
+  EXPECT_FALSE(wheel.cancel(owner, 2));
+}
+
+TEST_F(timer_wheel_test, reschedule) {
+  timer_wheel::timer_list owner;
+  wheel.insert(timeout_entry{0, origin + 1h, 0}, &owner);
+  // Resetting an idle timer reuses its node
+  for (auto now = 0ms; now < 100ms; now += 1ms) {
+    EXPECT_EQ(expire(now), ids{});
+    EXPECT_TRUE(wheel.reschedule(owner, 0, origin + now + 5ms));
+  }
+  EXPECT_EQ(wheel.size(), 1);
+  EXPECT_EQ(expire(103ms), ids{});
+  EXPECT_EQ(expire(104ms), ids{0});
+  EXPECT_TRUE(owner.empty());
+  EXPECT_FALSE(wheel.reschedule(owner, 0, origin + 1h));
+}
+
+TEST_F(timer_wheel_test, cancel_all) {
+  timer_wheel::timer_list first;
+  timer_wheel::timer_list second;
+  for (std::uint64_t id = 0; id < 10; ++id) {
+    wheel.insert(timeout_entry{0, origin + (id * 100ms), id},
+                 ((id % 2) == 0) ? &first : &second);
+  }
+  EXPECT_EQ(wheel.cancel_all(first), 5);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(wheel.size(), 5);
+  EXPECT_EQ(expire(1h), (ids{1, 3, 5, 7, 9}));
+  EXPECT_TRUE(second.empty());
+}
+
+TEST_F(timer_wheel_test, modified_while_expiring) {
+  timer_wheel::timer_list owner;
+  for (std::uint64_t id = 0; id < 3; ++id) {
+    wheel.insert(timeout_entry{0, origin + 1ms, id}, &owner);
+  }
+  ids expired;
+  wheel.expire(origin + 1ms, [&](const timeout_entry& entry) {
+    expired.push_back(entry.id());
+    // The expired timer is gone, the others are still pending
+    EXPECT_FALSE(wheel.cancel(owner, entry.id()));
+    if (entry.id() == 0) {
+      EXPECT_TRUE(wheel.cancel(owner, 1));
+      EXPECT_TRUE(wheel.reschedule(owner, 2, origin + 2ms));
+    }
+  });
+  EXPECT_EQ(expired, ids{0});
+  EXPECT_EQ(wheel.size(), 1);
+  EXPECT_EQ(expire(2ms), ids{2});
+  EXPECT_TRUE(owner.empty());
+}
+
+TEST_F(timer_wheel_test, clear) {
+  for (auto i = 0; i < 1000; ++i) {
+    schedule(i * 1s);
+  }
+  EXPECT_EQ(wheel.size(), 1000);
+  wheel.clear();
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.next_expiry(), std::nullopt);
+  EXPECT_EQ(expire(24h), ids{});
+}
@@ -19,6 +19,7 @@
 #  include "net/ip/v4_endpoint.hpp"
 
 #  include "net/manager_result.hpp"
+#  include "net/receive_policy.hpp"
 #  include "net/socket/stream_socket.hpp"
 #  include "net/socket/tcp_stream_socket.hpp"
 #  include "net/socket_guard.hpp"
@@ -28,11 +29,13 @@
 #  include "util/error_or.hpp"
 #  include "util/intrusive_ptr.hpp"
 
+#  include <algorithm>
 #  include <chrono>
 #  include <gmock/gmock.h>
 #  include <memory>
 #  include <thread>
 #  include <tuple>
+#  include <vector>
 
 using namespace net;
 using namespace net::ip;
@@ -47,6 +50,7 @@ struct test_state {
   std::vector<uint64_t> handled_timeouts;
   bool register_for_writing{false};
   bool reset_timeouts{false};
+  std::vector<std::chrono::steady_clock::time_point> timeout_times;
 };
 
 /// Real implementation of socket manager for integration-style tests.
@@ -97,6 +101,7 @@ struct dummy_socket_manager : public detail::uring_manager {
 
   manager_result handle_timeout(uint64_t timeout_id) override {
     state_.handled_timeouts.push_back(timeout_id);
+    state_.timeout_times.push_back(std::chrono::steady_clock::now());
     if (state_.reset_timeouts) {
       EXPECT_EQ(set_timeout_in(1ms), timeout_id + 1);
     }
@@ -150,6 +155,27 @@ private:
   test_state& state_;
 };
 
+/// Echoes all received bytes, used on top of a uring_stream_transport.
+struct echo_application {
+  util::error init(auto& parent, const util::config&) {
+    parent.configure_next_read(receive_policy::up_to(1024));
+    return util::none;
+  }
+
+  manager_result produce(auto&) { return manager_result::ok; }
+
+  bool has_more_data() const noexcept { return false; }
+
+  manager_result consume(auto& parent, util::const_byte_span data) {
+    parent.enqueue(data);
+    return manager_result::ok;
+  }
+
+  manager_result handle_timeout(auto&, uint64_t) { return manager_result::ok; }
+};
+
+using echo_transport = detail::uring_stream_transport<echo_application>;
+
 // --Test fixture --------------------------------------------------------------
 
 struct uring_multiplexer_test : public testing::Test {
@@ -288,4 +314,91 @@ TEST_F(uring_multiplexer_test, multiple_timeouts) {
   EXPECT_EQ(state.handled_timeouts, expected_result);
 }
 
+TEST_F(uring_multiplexer_test, timers_have_sub_millisecond_precision) {
+  static constexpr std::size_t num_timeouts = 50;
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  auto mgr = util::make_intrusive<dummy_socket_manager>(sockets.first, &mpx,
+                                                        state);
+  mpx.add(mgr, operation::read);
+  std::vector<std::chrono::steady_clock::time_point> due;
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 1; i <= num_timeouts; ++i) {
+    due.push_back(start + (i * 200us));
+    mgr->set_timeout_at(due.back());
+  }
+  ASSERT_TRUE(poll_until(
+    [&] { return state.timeout_times.size() >= num_timeouts; }, true,
+    10 * num_timeouts));
+  std::vector<std::chrono::steady_clock::duration> lateness;
+  for (std::size_t i = 0; i < num_timeouts; ++i) {
+    lateness.push_back(state.timeout_times[i] - due[i]);
+  }
+  std::sort(lateness.begin(), lateness.end());
+  EXPECT_LT(lateness[num_timeouts / 2], 500us);
+}
+
+TEST(uring_provided_buffers, echo_via_multishot_receive) {
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.provided-buffers", true);
+  cfg.add_config_entry("multiplexer.provided-buffer-count", std::int64_t{4});
+  cfg.add_config_entry("multiplexer.provided-buffer-size", std::int64_t{512});
+  detail::uring_multiplexer mpx;
+  auto factory = [](net::socket handle, detail::multiplexer_base* mpx) {
+    return mpx->make_manager<echo_transport>(
+      socket_cast<stream_socket>(handle));
+  };
+  ASSERT_EQ(mpx.init(std::move(factory), cfg), util::none);
+  mpx.set_thread_id(std::this_thread::get_id());
+  ASSERT_TRUE(mpx.uses_provided_buffers());
+  const socket_guard guard{UNPACK_EXPRESSION(make_connected_tcp_stream_socket(
+    v4_endpoint{v4_address::localhost, mpx.port()}))};
+  ASSERT_TRUE(nonblocking(guard.get(), true));
+  // More bytes than fit into the buffer ring at once
+  util::byte_array<8192> sent;
+  for (std::size_t i = 0; i < sent.size(); ++i) {
+    sent[i] = static_cast<std::byte>(i & 0xFF);
+  }
+  std::thread writer{[&] { test::write_all(guard.get(), sent); }};
+  util::byte_buffer echoed;
+  util::byte_array<1024> buf;
+  for (std::size_t i = 0; (i < 1000) && (echoed.size() < sent.size()); ++i) {
+    ASSERT_EQ(mpx.poll_once(false), util::none);
+    const auto res = read(guard.get(), buf);
+    if (res > 0) {
+      echoed.insert(echoed.end(), buf.begin(), buf.begin() + res);
+    } else {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+  writer.join();
+  ASSERT_EQ(echoed.size(), sent.size());
+  EXPECT_TRUE(std::equal(echoed.begin(), echoed.end(), sent.begin()));
+}
+
+TEST(uring_provided_buffers, invalid_configuration_is_rejected) {
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.provided-buffers", true);
+  cfg.add_config_entry("multiplexer.provided-buffer-count", std::int64_t{3});
+  detail::uring_multiplexer mpx;
+  EXPECT_NE(mpx.init(detail::uring_multiplexer::manager_factory{}, cfg),
+            util::none);
+}
+
+TEST(uring_fixed_files, invalid_table_size_is_rejected) {
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.fixed-files", std::int64_t{-1});
+  detail::uring_multiplexer mpx;
+  EXPECT_NE(mpx.init(detail::uring_multiplexer::manager_factory{}, cfg),
+            util::none);
+}
+
+TEST(uring_fixed_buffers, invalid_configuration_is_rejected) {
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.fixed-buffers", true);
+  cfg.add_config_entry("multiplexer.fixed-buffer-count", std::int64_t{0});
+  detail::uring_multiplexer mpx;
+  EXPECT_NE(mpx.init(detail::uring_multiplexer::manager_factory{}, cfg),
+            util::none);
+}
+
 #endif
@@ -126,6 +126,15 @@ struct event_based {
   }
 };
 
+struct edge_triggered_event_based {
+  static void create_multiplexer(util::config& cfg,
+                                 detail::multiplexer_base_ptr& mpx,
+                                 std::size_t& num_managers) {
+    cfg.add_config_entry("multiplexer.edge-triggered", true);
+    event_based::create_multiplexer(cfg, mpx, num_managers);
+  }
+};
+
 #if defined(LIB_NET_URING)
 
 struct uring_based {
@@ -145,14 +154,37 @@ struct uring_based {
   }
 };
 
+struct uring_fixed_files_based {
+  static void create_multiplexer(util::config& cfg,
+                                 detail::multiplexer_base_ptr& mpx,
+                                 std::size_t& num_managers) {
+    cfg.add_config_entry("multiplexer.fixed-files", std::int64_t{1024});
+    uring_based::create_multiplexer(cfg, mpx, num_managers);
+  }
+};
+
+struct uring_fixed_buffers_based {
+  static void create_multiplexer(util::config& cfg,
+                                 detail::multiplexer_base_ptr& mpx,
+                                 std::size_t& num_managers) {
+    cfg.add_config_entry("multiplexer.fixed-buffers", true);
+    cfg.add_config_entry("multiplexer.fixed-buffer-count", std::int64_t{4});
+    cfg.add_config_entry("multiplexer.fixed-buffer-size", std::int64_t{4096});
+    uring_based::create_multiplexer(cfg, mpx, num_managers);
+  }
+};
+
 #endif
 
 // -- Parameterized fixture ---------------------------------------------------
 
-using FactoryCreators = ::testing::Types<event_based
+using FactoryCreators = ::testing::Types<event_based,
+                                         edge_triggered_event_based
 #if defined(LIB_NET_URING)
                                          ,
-                                         uring_based
+                                         uring_based,
+                                         uring_fixed_files_based,
+                                         uring_fixed_buffers_based
 #endif
                                          >;
 
@@ -172,3 +204,60 @@ TYPED_TEST(stream_transport_full_integration, mirror) {
   }
   EXPECT_EQ(this->data, receive_buffer);
 }
+
+TYPED_TEST(stream_transport_full_integration, mirror_multiple_rounds) {
+  for (std::size_t round = 0; round < 10; ++round) {
+    ASSERT_EQ(test::write_all(*this->socket, this->data), manager_result::done);
+    util::byte_array<10_KB> receive_buffer = {};
+    ASSERT_EQ(test::read_all(*this->socket, receive_buffer), manager_result::ok);
+    EXPECT_EQ(this->data, receive_buffer);
+  }
+}
+
+namespace {
+
+/// Mirrors data for the given number of rounds and returns the number of
+/// epoll_ctl calls issued by the multiplexer.
+std::size_t count_pollset_updates(bool edge_triggered, std::size_t rounds) {
+  util::config cfg;
+  cfg.add_config_entry("multiplexer.edge-triggered", edge_triggered);
+  auto factory = [](net::socket handle,
+                    detail::multiplexer_base* mpx) -> detail::event_handler_ptr {
+    return util::make_intrusive<
+      detail::event_stream_transport<mirror_application>>(
+      socket_cast<stream_socket>(handle), mpx);
+  };
+  auto mpx = UNPACK_EXPRESSION(net::make_multiplexer(std::move(factory), cfg));
+  const auto default_num_socket_managers = mpx->num_socket_managers();
+  mpx->start();
+  {
+    net::socket_guard sock{
+      UNPACK_EXPRESSION(make_connected_tcp_stream_socket(
+        v4_endpoint{v4_address::localhost, mpx->port()}))};
+    EXPECT_TRUE(test::wait_for([&] {
+      return mpx->num_socket_managers() == (default_num_socket_managers + 1);
+    }));
+    EXPECT_TRUE(nonblocking(*sock, true));
+    const auto data = test::generate_test_data<10_KB>();
+    for (std::size_t round = 0; round < rounds; ++round) {
+      EXPECT_EQ(test::write_all(*sock, data), manager_result::done);
+      util::byte_array<10_KB> receive_buffer = {};
+      EXPECT_EQ(test::read_all(*sock, receive_buffer), manager_result::ok);
+    }
+  }
+  mpx->shutdown();
+  mpx->join();
+  return mpx->num_pollset_updates();
+}
+
+} // namespace
+
+TEST(edge_triggered_multiplexer, avoids_pollset_updates) {
+  static constexpr std::size_t rounds = 10;
+  const auto level_triggered_updates = count_pollset_updates(false, rounds);
+  const auto edge_triggered_updates = count_pollset_updates(true, rounds);
+  // Level-triggered mode enables and disables writing once per round
+  EXPECT_GE(level_triggered_updates, 2 * rounds);
+  // Edge-triggered mode only adds and removes the three sockets
+  EXPECT_LE(edge_triggered_updates, 6);
+}
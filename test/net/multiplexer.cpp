@@ -18,15 +18,22 @@
 #include "net/socket_guard.hpp"
 #include "net/socket_manager_factory.hpp"
 
+#include "util/byte_array.hpp"
+#include "util/byte_buffer.hpp"
 #include "util/config.hpp"
+#include "util/cpu_affinity.hpp"
 #include "util/error.hpp"
 #include "util/error_or.hpp"
 #include "util/intrusive_ptr.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <future>
 #include <memory>
+#include <string>
 #include <thread>
 #include <tuple>
+#include <vector>
 
 using namespace net;
 using namespace net::ip;
@@ -41,6 +48,7 @@ struct test_state {
   std::vector<uint64_t> handled_timeouts;
   bool register_for_writing{false};
   bool reset_timeouts{false};
+  std::chrono::milliseconds timeout_delay{0};
 };
 
 struct dummy_socket_manager : public detail::event_handler {
@@ -69,6 +77,7 @@ struct dummy_socket_manager : public detail::event_handler {
 
   manager_result handle_timeout(uint64_t timeout_id) override {
     state_.handled_timeouts.push_back(timeout_id);
+    std::this_thread::sleep_for(state_.timeout_delay);
     if (state_.reset_timeouts) {
       EXPECT_EQ(set_timeout_in(1ms), timeout_id + 1);
     }
@@ -79,14 +88,138 @@ private:
   test_state& state_;
 };
 
+/// Measures how late its timeouts fire, rescheduling after every timeout.
+struct timer_manager : public detail::event_handler {
+  timer_manager(net::socket handle, detail::multiplexer_base* mpx,
+                std::size_t num_timeouts)
+    : detail::event_handler(handle, mpx), num_timeouts_{num_timeouts} {
+    // nop
+  }
+
+  manager_result handle_read_event() override { return manager_result::ok; }
+
+  manager_result handle_write_event() override {
+    return manager_result::done;
+  }
+
+  manager_result handle_timeout(uint64_t) override {
+    lateness.push_back(std::chrono::steady_clock::now() - due_);
+    if (lateness.size() < num_timeouts_) {
+      schedule();
+    }
+    return manager_result::ok;
+  }
+
+  void schedule() {
+    due_ = std::chrono::steady_clock::now() + interval;
+    set_timeout_at(due_);
+  }
+
+  bool done() const noexcept { return lateness.size() == num_timeouts_; }
+
+  static constexpr auto interval = 100us;
+
+  std::vector<std::chrono::steady_clock::duration> lateness;
+
+private:
+  std::size_t num_timeouts_;
+  std::chrono::steady_clock::time_point due_;
+};
+
+/// Reads a fixed number of bytes per turn and records its turns.
+struct turn_manager : public detail::event_handler {
+  static constexpr std::size_t bytes_per_turn = 16;
+
+  turn_manager(net::socket handle, detail::multiplexer_base* mpx, int id,
+               std::vector<int>& turns)
+    : detail::event_handler(handle, mpx), id_{id}, turns_{turns} {
+    // nop
+  }
+
+  manager_result handle_read_event() override {
+    util::byte_array<bytes_per_turn> buf;
+    const auto res = read(handle<stream_socket>(), buf);
+    if (res > 0) {
+      turns_.push_back(id_);
+      num_bytes_read += static_cast<std::size_t>(res);
+      return manager_result::ok;
+    } else if ((res < 0) && last_socket_error_is_temporary()) {
+      return manager_result::temporary_error;
+    }
+    return manager_result::done;
+  }
+
+  manager_result handle_write_event() override {
+    return manager_result::done;
+  }
+
+  manager_result handle_timeout(uint64_t) override {
+    return manager_result::ok;
+  }
+
+  std::size_t num_bytes_read{0};
+
+private:
+  int id_;
+  std::vector<int>& turns_;
+};
+
+/// Stalls the event loop for a while on every read event.
+struct slow_manager : public detail::event_handler {
+  using detail::event_handler::event_handler;
+
+  manager_result handle_read_event() override {
+    util::byte_array<1> buf;
+    if (read(handle<stream_socket>(), buf) <= 0) {
+      return manager_result::temporary_error;
+    }
+    std::this_thread::sleep_for(3ms);
+    return manager_result::ok;
+  }
+
+  manager_result handle_write_event() override {
+    return manager_result::done;
+  }
+
+  manager_result handle_timeout(uint64_t) override {
+    return manager_result::ok;
+  }
+};
+
+/// Returns the median lateness of timeouts in a blocking event loop.
+std::chrono::steady_clock::duration
+median_timer_lateness(detail::multiplexer_base& mpx) {
+  static constexpr std::size_t num_timeouts = 200;
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  net::socket_guard guard{sockets.second};
+  auto mgr = util::make_intrusive<timer_manager>(sockets.first, &mpx,
+                                                 num_timeouts);
+  mpx.add(mgr, operation::read);
+  mgr->schedule();
+  for (std::size_t i = 0; !mgr->done() && (i < 10 * num_timeouts); ++i) {
+    EXPECT_EQ(mpx.poll_once(true), util::none);
+  }
+  EXPECT_TRUE(mgr->done());
+  auto lateness = mgr->lateness;
+  if (lateness.empty()) {
+    return std::chrono::steady_clock::duration::max();
+  }
+  std::sort(lateness.begin(), lateness.end());
+  return lateness[lateness.size() / 2];
+}
+
 // -- Test fixture -------------------------------------------------------------
 
 struct multiplexer_test : public testing::Test {
-  multiplexer_test() {
+  multiplexer_test() : multiplexer_test(util::config{}) {
+    // nop
+  }
+
+  explicit multiplexer_test(util::config config) : cfg{std::move(config)} {
     auto factory = [this](net::socket handle, detail::multiplexer_base* mpx) {
       return util::make_intrusive<dummy_socket_manager>(handle, mpx, state);
     };
-    EXPECT_EQ(mpx.init(std::move(factory), util::config{}), util::none);
+    EXPECT_EQ(mpx.init(std::move(factory), cfg), util::none);
     mpx.set_thread_id(std::this_thread::get_id());
     default_num_socket_managers = mpx.num_socket_managers();
   }
@@ -115,11 +248,27 @@ struct multiplexer_test : public testing::Test {
 
   bool has_handled_write_event() const { return state.write_event_handled; }
 
+  util::config cfg;
   multiplexer mpx;
   size_t default_num_socket_managers;
   test_state state;
 };
 
+/// Collects statistics and measures the time spent in handlers.
+struct multiplexer_profiling_test : public multiplexer_test {
+  multiplexer_profiling_test() : multiplexer_test(make_config()) {
+    // nop
+  }
+
+  static util::config make_config() {
+    util::config cfg;
+    cfg.add_config_entry("multiplexer.collect-stats", true);
+    cfg.add_config_entry("multiplexer.profile-handlers", true);
+    cfg.add_config_entry("multiplexer.handler-budget-us", std::int64_t{1000});
+    return cfg;
+  }
+};
+
 bool write_all(net::tcp_stream_socket handle, util::byte_span data) {
   while (!data.empty()) {
     const auto res = write(handle, data);
@@ -235,5 +384,473 @@ TEST_F(multiplexer_test, multiple_timeouts_at_once) {
   EXPECT_EQ(state.handled_timeouts, expected_result);
 }
 
-// TODO: Implement test that checks pipe-reading and  writing for adding and
-// removing socket_managers from the pollset.
+TEST_F(multiplexer_test, cancel_timeout) {
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  auto mgr = util::make_intrusive<dummy_socket_manager>(sockets.first, &mpx,
+                                                        state);
+  mpx.add(mgr, operation::read);
+  EXPECT_EQ(mgr->set_timeout_in(1ms), 0);
+  EXPECT_EQ(mgr->set_timeout_in(2ms), 1);
+  EXPECT_TRUE(mgr->cancel_timeout(0));
+  EXPECT_FALSE(mgr->cancel_timeout(0));
+  EXPECT_TRUE(poll_until([&] { return !state.handled_timeouts.empty(); },
+                         true, 20));
+  EXPECT_EQ(state.handled_timeouts, std::vector<uint64_t>{1});
+  // Expired timeouts can not be cancelled
+  EXPECT_FALSE(mgr->cancel_timeout(1));
+}
+
+TEST_F(multiplexer_test, reschedule_timeout) {
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  auto mgr = util::make_intrusive<dummy_socket_manager>(sockets.first, &mpx,
+                                                        state);
+  mpx.add(mgr, operation::read);
+  const auto now = std::chrono::steady_clock::now();
+  EXPECT_EQ(mgr->set_timeout_at(now + 1h), 0);
+  EXPECT_TRUE(mgr->reschedule_timeout(0, now + 1ms));
+  EXPECT_TRUE(poll_until([&] { return !state.handled_timeouts.empty(); },
+                         true, 20));
+  EXPECT_EQ(state.handled_timeouts, std::vector<uint64_t>{0});
+  EXPECT_FALSE(mgr->reschedule_timeout(0, now + 1ms));
+}
+
+TEST_F(multiplexer_test, timeouts_are_cancelled_on_removal) {
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  auto mgr = util::make_intrusive<dummy_socket_manager>(sockets.first, &mpx,
+                                                        state);
+  mpx.add(mgr, operation::read);
+  // Long enough not to expire before the manager is removed on loaded hosts
+  EXPECT_EQ(mgr->set_timeout_in(50ms), 0);
+  EXPECT_EQ(mgr->set_timeout_in(1h), 1);
+  // Closing the peer makes the manager fail reading and remove itself
+  close(sockets.second);
+  ASSERT_TRUE(poll_until([&] {
+    return mpx.num_socket_managers() == default_num_socket_managers;
+  }));
+  std::this_thread::sleep_for(60ms);
+  EXPECT_EQ(mpx.poll_once(false), util::none);
+  EXPECT_TRUE(state.handled_timeouts.empty());
+  EXPECT_FALSE(mgr->cancel_timeout(1));
+}
+
+TEST_F(multiplexer_test, post_from_multiplexer_thread_is_deferred) {
+  std::vector<int> order;
+  EXPECT_TRUE(mpx.post([&] {
+    order.push_back(1);
+    // Tasks posted by tasks run in a later iteration
+    EXPECT_TRUE(mpx.post([&] { order.push_back(3); }));
+  }));
+  EXPECT_TRUE(mpx.post([&] { order.push_back(2); }));
+  EXPECT_TRUE(order.empty());
+  ASSERT_TRUE(poll_until([&] { return order.size() == 2; }));
+  EXPECT_EQ(order, (std::vector<int>{1, 2}));
+  ASSERT_TRUE(poll_until([&] { return order.size() == 3; }));
+  EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(multiplexer_test, dispatch_runs_inline_on_multiplexer_thread) {
+  bool executed = false;
+  EXPECT_TRUE(mpx.dispatch([&] { executed = true; }));
+  EXPECT_TRUE(executed);
+}
+
+TEST_F(multiplexer_test, post_from_other_threads) {
+  static constexpr int num_threads = 4;
+  static constexpr int num_tasks = 1000;
+  std::vector<int> counts(num_threads, 0);
+  bool in_order = true;
+  std::vector<std::jthread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < num_tasks; ++i) {
+        EXPECT_TRUE(mpx.dispatch([&, t, i] {
+          in_order &= (counts[t]++ == i);
+        }));
+      }
+    });
+  }
+  // More tasks than fit into the command queue, producers wait for the polls
+  EXPECT_TRUE(poll_until(
+    [&] {
+      return std::ranges::all_of(counts,
+                                 [](int n) { return n == num_tasks; });
+    },
+    true, num_threads * num_tasks));
+  EXPECT_TRUE(in_order);
+}
+
+TEST_F(multiplexer_test, post_fails_after_shutdown) {
+  mpx.shutdown();
+  bool executed = false;
+  EXPECT_FALSE(mpx.post([&] { executed = true; }));
+  std::thread([&] {
+    EXPECT_FALSE(mpx.post([&] { executed = true; }));
+  }).join();
+  EXPECT_EQ(mpx.poll_once(false), util::none);
+  EXPECT_FALSE(executed);
+}
+
+TEST_F(multiplexer_test, multiplexer_threads_give_up_on_full_queues) {
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.listen", false);
+  multiplexer other;
+  ASSERT_EQ(other.init(multiplexer::manager_factory{}, other_cfg), util::none);
+  other.start();
+  // The queue of mpx fills up, as it is not polled in the meantime
+  auto fill_queue = [&] {
+    std::promise<std::size_t> num_posted;
+    EXPECT_TRUE(other.post([&] {
+      std::size_t n = 0;
+      while (mpx.post([] {})) {
+        ++n;
+      }
+      num_posted.set_value(n);
+    }));
+    return num_posted.get_future().get();
+  };
+  EXPECT_LE(fill_queue(), multiplexer::default_command_queue_capacity);
+  // Draining the queue makes room again
+  EXPECT_EQ(mpx.poll_once(false), util::none);
+  EXPECT_GT(fill_queue(), 0);
+  other.shutdown();
+  other.join();
+}
+
+TEST_F(multiplexer_profiling_test, stats_are_collected) {
+  const auto before = mpx.stats().read();
+  const socket_guard guard{connect_to_mpx()};
+  ASSERT_TRUE(poll_until([this] {
+    return (mpx.num_socket_managers() == (default_num_socket_managers + 1));
+  }));
+  const auto after = mpx.stats().read();
+  EXPECT_EQ(after.num_accepted - before.num_accepted, 1);
+  EXPECT_GT(after.num_iterations, before.num_iterations);
+  EXPECT_GT(after.num_events, before.num_events);
+  EXPECT_EQ(after.events_per_iteration.count, after.num_iterations);
+  EXPECT_EQ(after.blocked_ns.count, after.num_iterations);
+  EXPECT_GT(detail::accepts_per_second(before, after), 0.0);
+}
+
+TEST_F(multiplexer_profiling_test, slow_handlers_are_reported) {
+  std::vector<std::pair<net::socket, std::chrono::nanoseconds>> reported;
+  mpx.set_slow_handler_callback(
+    [&](detail::manager_base& mgr, std::chrono::nanoseconds elapsed) {
+      reported.emplace_back(mgr.handle(), elapsed);
+    });
+  state.timeout_delay = 2ms;
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  auto mgr = util::make_intrusive<dummy_socket_manager>(sockets.first, &mpx,
+                                                        state);
+  mpx.add(mgr, operation::read);
+  mgr->set_timeout_in(1ms);
+  ASSERT_TRUE(poll_until([&] { return !state.handled_timeouts.empty(); },
+                         true));
+  ASSERT_EQ(reported.size(), 1);
+  EXPECT_EQ(reported.front().first, sockets.first);
+  EXPECT_GE(reported.front().second, 1ms);
+  EXPECT_EQ(mgr->num_handler_calls(), 1);
+  EXPECT_EQ(mgr->num_slow_handler_calls(), 1);
+  EXPECT_GE(mgr->cpu_time(), 1ms);
+}
+
+TEST_F(multiplexer_profiling_test, most_expensive_managers) {
+  state.timeout_delay = 2ms;
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  auto slow = util::make_intrusive<dummy_socket_manager>(sockets.first, &mpx,
+                                                         state);
+  mpx.add(slow, operation::read);
+  slow->set_timeout_in(1ms);
+  ASSERT_TRUE(poll_until([&] { return !state.handled_timeouts.empty(); },
+                         true));
+  // Trigger a cheap read event on a second manager
+  state.timeout_delay = 0ms;
+  const socket_guard guard{connect_to_mpx()};
+  ASSERT_TRUE(poll_until([this] {
+    return (mpx.num_socket_managers() == (default_num_socket_managers + 2));
+  }));
+  const auto costs = mpx.most_expensive_managers(10);
+  ASSERT_GE(costs.size(), 2);
+  EXPECT_EQ(costs.front().handle, sockets.first);
+  EXPECT_TRUE(std::is_sorted(costs.begin(), costs.end(),
+                             [](const auto& lhs, const auto& rhs) {
+                               return lhs.cpu_time > rhs.cpu_time;
+                             }));
+  const auto top = mpx.most_expensive_managers(1);
+  ASSERT_EQ(top.size(), 1);
+  EXPECT_EQ(top.front().handle, sockets.first);
+}
+
+TEST_F(multiplexer_test, migrate_moves_manager_with_timeouts) {
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.listen", false);
+  multiplexer other;
+  ASSERT_EQ(other.init(multiplexer::manager_factory{}, other_cfg), util::none);
+  other.set_thread_id(std::this_thread::get_id());
+  const auto default_num_other = other.num_socket_managers();
+
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  const socket_guard peer{sockets.second};
+  auto mgr = util::make_intrusive<dummy_socket_manager>(sockets.first, &mpx,
+                                                        state);
+  mpx.add(mgr, operation::read);
+  const auto id = mgr->set_timeout_in(5ms);
+  ASSERT_TRUE(mpx.migrate(mgr, other));
+  EXPECT_EQ(other.load(), default_num_other);
+  // The migration runs as a task on the current multiplexer
+  ASSERT_TRUE(poll_until([&] {
+    return mpx.num_socket_managers() == default_num_socket_managers;
+  }));
+  EXPECT_EQ(mgr->mpx(), &other);
+  EXPECT_EQ(other.load(), default_num_other + 1);
+  for (int i = 0; i < 10 && other.num_socket_managers() == default_num_other;
+       ++i) {
+    EXPECT_EQ(other.poll_once(false), util::none);
+  }
+  EXPECT_EQ(other.num_socket_managers(), default_num_other + 1);
+  // Events and timeouts are handled by the new multiplexer
+  util::byte_array<32> buf{};
+  ASSERT_EQ(write(peer.get(), buf), buf.size());
+  for (int i = 0; i < 100 && !has_handled_read_event(); ++i) {
+    EXPECT_EQ(other.poll_once(true), util::none);
+  }
+  EXPECT_TRUE(has_handled_read_event());
+  for (int i = 0; i < 100 && state.handled_timeouts.empty(); ++i) {
+    EXPECT_EQ(other.poll_once(true), util::none);
+  }
+  EXPECT_EQ(state.handled_timeouts, std::vector<uint64_t>{id});
+  // New timeouts do not collide with the migrated IDs
+  const auto new_id = mgr->set_timeout_in(1h);
+  EXPECT_GT(new_id, id);
+  EXPECT_TRUE(mgr->cancel_timeout(new_id));
+}
+
+TEST_F(multiplexer_test, migrate_managers_skips_internal_managers) {
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.listen", false);
+  multiplexer other;
+  ASSERT_EQ(other.init(multiplexer::manager_factory{}, other_cfg), util::none);
+  other.set_thread_id(std::this_thread::get_id());
+  const auto default_num_other = other.num_socket_managers();
+
+  std::vector<stream_socket> peers;
+  std::vector<util::intrusive_ptr<dummy_socket_manager>> mgrs;
+  for (int i = 0; i < 3; ++i) {
+    auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+    peers.emplace_back(sockets.second);
+    mgrs.emplace_back(util::make_intrusive<dummy_socket_manager>(
+      sockets.first, &mpx, state));
+    mpx.add(mgrs.back(), operation::read);
+  }
+  ASSERT_TRUE(mpx.migrate_managers(other, 10));
+  ASSERT_TRUE(poll_until([&] {
+    return mpx.num_socket_managers() == default_num_socket_managers;
+  }));
+  EXPECT_EQ(other.load(), default_num_other + mgrs.size());
+  for (const auto& mgr : mgrs) {
+    EXPECT_EQ(mgr->mpx(), &other);
+  }
+  for (auto peer : peers) {
+    close(peer);
+  }
+}
+
+TEST_F(multiplexer_test, invalid_placement_is_rejected) {
+  auto init_with = [](const std::string& key, auto value) {
+    util::config other_cfg;
+    other_cfg.add_config_entry("multiplexer.listen", false);
+    other_cfg.add_config_entry(key, std::move(value));
+    multiplexer other;
+    return other.init(multiplexer::manager_factory{}, other_cfg);
+  };
+  EXPECT_NE(init_with("multiplexer.cpu-affinity", std::string{"x"}),
+            util::none);
+  EXPECT_NE(init_with("multiplexer.numa-node", std::int64_t{100'000}),
+            util::none);
+}
+
+TEST_F(multiplexer_test, accepting_pauses_while_overloaded) {
+  std::size_t num_accepted = 0;
+  auto factory = [&](net::socket handle, detail::multiplexer_base* mpx) {
+    ++num_accepted;
+    return util::make_intrusive<dummy_socket_manager>(handle, mpx, state);
+  };
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.max-loop-lag-us", std::int64_t{1000});
+  other_cfg.add_config_entry("multiplexer.overload-recheck-ms",
+                             std::int64_t{1});
+  multiplexer other;
+  ASSERT_EQ(other.init(std::move(factory), other_cfg), util::none);
+  other.set_thread_id(std::this_thread::get_id());
+  // Stall a few iterations to drive up the loop lag
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  net::socket_guard peer{sockets.second};
+  other.add(util::make_intrusive<slow_manager>(sockets.first, &other),
+            operation::read);
+  const util::byte_buffer data(8, std::byte{0x2A});
+  ASSERT_EQ(test::write_all(sockets.second, data), manager_result::done);
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_EQ(other.poll_once(false), util::none);
+  }
+  ASSERT_GT(other.loop_lag(), 1ms);
+  net::socket_guard client{UNPACK_EXPRESSION(make_connected_tcp_stream_socket(
+    v4_endpoint{v4_address::localhost, other.port()}))};
+  ASSERT_EQ(other.poll_once(false), util::none);
+  EXPECT_EQ(num_accepted, 0);
+  // Accepting resumes once idle iterations brought the lag down
+  EXPECT_TRUE(test::poll_until([&] { return num_accepted == 1; }, other, 100,
+                               true));
+  EXPECT_LE(other.loop_lag(), 1ms);
+}
+
+TEST_F(multiplexer_test, timers_have_sub_millisecond_precision) {
+  EXPECT_LT(median_timer_lateness(mpx), 500us);
+}
+
+#if defined(__linux__)
+
+TEST_F(multiplexer_test, thread_is_pinned_to_configured_cpus) {
+  const auto allowed = util::allowed_cpus();
+  ASSERT_FALSE(allowed.empty());
+  const util::cpu_list pinned{allowed.back()};
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.listen", false);
+  other_cfg.add_config_entry("multiplexer.cpu-affinity",
+                             std::to_string(pinned.front()));
+  multiplexer other;
+  ASSERT_EQ(other.init(multiplexer::manager_factory{}, other_cfg), util::none);
+  EXPECT_EQ(other.cpu_affinity(), pinned);
+  other.start();
+  std::promise<util::cpu_list> cpus;
+  ASSERT_TRUE(other.post([&] { cpus.set_value(util::allowed_cpus()); }));
+  EXPECT_EQ(cpus.get_future().get(), pinned);
+  other.shutdown();
+  other.join();
+}
+
+TEST_F(multiplexer_test, timerfd_timers_have_sub_millisecond_precision) {
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.listen", false);
+  other_cfg.add_config_entry("multiplexer.use-timerfd", true);
+  multiplexer other;
+  ASSERT_EQ(other.init(multiplexer::manager_factory{}, other_cfg), util::none);
+  other.set_thread_id(std::this_thread::get_id());
+  ASSERT_TRUE(other.uses_timerfd());
+  EXPECT_LT(median_timer_lateness(other), 500us);
+}
+
+TEST_F(multiplexer_test, busy_managers_take_turns) {
+  static constexpr std::size_t num_bytes = 4 * turn_manager::bytes_per_turn;
+  // Returns the order of turns and the bytes read by each manager
+  auto run = [](bool fair_scheduling) {
+    util::config other_cfg;
+    other_cfg.add_config_entry("multiplexer.listen", false);
+    other_cfg.add_config_entry("multiplexer.fair-scheduling", fair_scheduling);
+    other_cfg.add_config_entry("multiplexer.max-ready-rounds", std::int64_t{8});
+    multiplexer other;
+    EXPECT_EQ(other.init(multiplexer::manager_factory{}, other_cfg),
+              util::none);
+    other.set_thread_id(std::this_thread::get_id());
+    std::vector<int> turns;
+    std::vector<socket_guard<stream_socket>> peers;
+    std::vector<util::intrusive_ptr<turn_manager>> mgrs;
+    const util::byte_buffer data(num_bytes, std::byte{0x2A});
+    for (int id = 0; id < 2; ++id) {
+      auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+      EXPECT_TRUE(nonblocking(sockets.first, true));
+      EXPECT_EQ(test::write_all(sockets.second, data), manager_result::done);
+      peers.emplace_back(sockets.second);
+      mgrs.emplace_back(util::make_intrusive<turn_manager>(sockets.first,
+                                                           &other, id, turns));
+      other.add(mgrs.back(), operation::read);
+    }
+    EXPECT_EQ(other.poll_once(false), util::none);
+    std::vector<std::size_t> num_bytes_read;
+    for (const auto& mgr : mgrs) {
+      num_bytes_read.push_back(mgr->num_bytes_read);
+    }
+    return std::make_pair(turns, num_bytes_read);
+  };
+  // Without fair scheduling every manager gets a single turn per poll
+  EXPECT_EQ(run(false).first, (std::vector<int>{0, 1}));
+  // Otherwise the managers alternate until both are drained
+  const auto [turns, num_bytes_read] = run(true);
+  EXPECT_EQ(turns, (std::vector<int>{0, 1, 0, 1, 0, 1, 0, 1}));
+  EXPECT_EQ(num_bytes_read, (std::vector<std::size_t>(2, num_bytes)));
+}
+
+TEST_F(multiplexer_test, busy_managers_are_queued_once) {
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.listen", false);
+  other_cfg.add_config_entry("multiplexer.fair-scheduling", true);
+  other_cfg.add_config_entry("multiplexer.max-ready-rounds", std::int64_t{1});
+  multiplexer other;
+  ASSERT_EQ(other.init(multiplexer::manager_factory{}, other_cfg), util::none);
+  other.set_thread_id(std::this_thread::get_id());
+  std::vector<int> turns;
+  auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+  ASSERT_TRUE(nonblocking(sockets.first, true));
+  socket_guard<stream_socket> peer{sockets.second};
+  const util::byte_buffer data(64 * turn_manager::bytes_per_turn,
+                               std::byte{0x2A});
+  ASSERT_EQ(test::write_all(sockets.second, data), manager_result::done);
+  other.add(util::make_intrusive<turn_manager>(sockets.first, &other, 0,
+                                               turns),
+            operation::read);
+  // The socket stays readable, but its events must not queue the manager
+  // again while it is waiting on the ready list
+  for (std::size_t i = 0; i < 10; ++i) {
+    const auto num_turns = turns.size();
+    ASSERT_EQ(other.poll_once(false), util::none);
+    EXPECT_LE(turns.size() - num_turns, 2);
+  }
+}
+
+TEST_F(multiplexer_test, event_batch_adapts_to_load) {
+  static constexpr std::size_t num_sockets = 100;
+  util::config other_cfg;
+  other_cfg.add_config_entry("multiplexer.listen", false);
+  multiplexer other;
+  ASSERT_EQ(other.init(multiplexer::manager_factory{}, other_cfg), util::none);
+  other.set_thread_id(std::this_thread::get_id());
+  EXPECT_EQ(other.event_batch_size(), multiplexer::max_events);
+  std::vector<int> turns;
+  std::vector<socket_guard<stream_socket>> peers;
+  const util::byte_buffer data(turn_manager::bytes_per_turn, std::byte{0x2A});
+  for (std::size_t i = 0; i < num_sockets; ++i) {
+    auto sockets = UNPACK_EXPRESSION(make_stream_socket_pair());
+    ASSERT_TRUE(nonblocking(sockets.first, true));
+    ASSERT_EQ(test::write_all(sockets.second, data), manager_result::done);
+    peers.emplace_back(sockets.second);
+    other.add(util::make_intrusive<turn_manager>(sockets.first, &other, 0,
+                                                 turns),
+              operation::read);
+  }
+  // Full batches grow the batch until all ready sockets fit
+  std::size_t max_batch_size = 0;
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_EQ(other.poll_once(false), util::none);
+    max_batch_size = std::max(max_batch_size, other.event_batch_size());
+  }
+  EXPECT_EQ(turns.size(), num_sockets);
+  EXPECT_GE(max_batch_size, num_sockets);
+  // Idle polls shrink it back
+  EXPECT_EQ(other.event_batch_size(), multiplexer::max_events);
+}
+
+TEST_F(multiplexer_test, invalid_scheduling_configuration_is_rejected) {
+  auto init_with = [](const std::string& key, std::int64_t value) {
+    util::config other_cfg;
+    other_cfg.add_config_entry("multiplexer.listen", false);
+    other_cfg.add_config_entry(key, value);
+    multiplexer other;
+    return other.init(multiplexer::manager_factory{}, other_cfg);
+  };
+  EXPECT_NE(init_with("multiplexer.max-ready-rounds", 0), util::none);
+  EXPECT_NE(init_with("multiplexer.max-events", 0), util::none);
+  EXPECT_NE(init_with("multiplexer.max-events-limit", 16), util::none);
+  EXPECT_NE(init_with("multiplexer.max-ready-rounds", -1), util::none);
+  EXPECT_NE(init_with("multiplexer.max-events", -1), util::none);
+  EXPECT_NE(init_with("multiplexer.max-events-limit", -1), util::none);
+}
+
+#endif
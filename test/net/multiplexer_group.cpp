@@ -0,0 +1,275 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      multiplexer_group.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "net/multiplexer_group.hpp"
+#include "net/placement_policy.hpp"
+
+#include "net_test.hpp"
+
+#include "net/detail/event_handler.hpp"
+
+#include "net/ip/v4_address.hpp"
+#include "net/ip/v4_endpoint.hpp"
+
+#include "net/manager_result.hpp"
+#include "net/operation.hpp"
+#include "net/socket/stream_socket.hpp"
+#include "net/socket/tcp_stream_socket.hpp"
+
+#include "util/byte_array.hpp"
+#include "util/config.hpp"
+#include "util/error.hpp"
+#include "util/intrusive_ptr.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace net;
+using namespace net::ip;
+using namespace std::string_literals;
+
+namespace {
+
+constexpr std::int64_t num_threads = 4;
+
+struct dummy_manager : public detail::event_handler {
+  using detail::event_handler::event_handler;
+
+  manager_result handle_read_event() override {
+    util::byte_array<1024> buf;
+    return (read(handle<stream_socket>(), buf) > 0) ? manager_result::ok
+                                                    : manager_result::error;
+  }
+
+  manager_result handle_write_event() override { return manager_result::done; }
+
+  manager_result handle_timeout(uint64_t) override { return manager_result::ok; }
+};
+
+struct multiplexer_group_test
+  : public testing::TestWithParam<placement_policy> {
+  multiplexer_group_test() {
+    cfg.add_config_entry("multiplexer.num-threads", num_threads);
+    cfg.add_config_entry("multiplexer.placement", to_string(GetParam()));
+    auto factory = [](net::socket handle, detail::multiplexer_base* mpx) {
+      return util::make_intrusive<dummy_manager>(handle, mpx);
+    };
+    EXPECT_EQ(group.init(std::move(factory), cfg), util::none);
+    default_num_socket_managers = group.num_socket_managers();
+  }
+
+  tcp_stream_socket connect_to_group() {
+    return UNPACK_EXPRESSION(make_connected_tcp_stream_socket(
+      v4_endpoint{v4_address::localhost, group.port()}));
+  }
+
+  /// Returns the number of connections handled by the worker at `index`.
+  std::size_t num_connections(std::size_t index) {
+    // Each worker holds its pollset_updater, and an acceptor when listening
+    const std::size_t num_internal
+      = (GetParam() == placement_policy::reuse_port) ? 2 : 1;
+    return group.at(index).num_socket_managers() - num_internal;
+  }
+
+  util::config cfg;
+  multiplexer_group<> group;
+  std::size_t default_num_socket_managers{0};
+};
+
+/// Runs a group of two workers, filling the first with connections.
+struct multiplexer_group_rebalance_test : public testing::Test {
+  multiplexer_group_rebalance_test() {
+    cfg.add_config_entry("multiplexer.num-threads", std::int64_t{2});
+  }
+
+  ~multiplexer_group_rebalance_test() {
+    group.shutdown();
+    group.join();
+    for (const auto peer : peers) {
+      close(peer);
+    }
+  }
+
+  void init() {
+    auto factory = [](net::socket handle, detail::multiplexer_base* mpx) {
+      return util::make_intrusive<dummy_manager>(handle, mpx);
+    };
+    ASSERT_EQ(group.init(std::move(factory), cfg), util::none);
+    default_load = group.at(0).load();
+    group.start();
+  }
+
+  /// Adds `num` connections to the first worker.
+  void add_connections(std::size_t num) {
+    auto& first = group.at(0);
+    for (std::size_t i = 0; i < num; ++i) {
+      auto [server, client] = UNPACK_EXPRESSION(make_stream_socket_pair());
+      peers.push_back(client);
+      first.add(util::make_intrusive<dummy_manager>(server, &first),
+                operation::read);
+    }
+  }
+
+  /// Returns the number of connections handled by the worker at `index`.
+  std::size_t num_connections(std::size_t index) {
+    return group.at(index).num_socket_managers() - default_load;
+  }
+
+  /// Waits until the workers handle the given numbers of connections.
+  bool wait_for_connections(std::size_t first, std::size_t second) {
+    return test::wait_for([&] {
+      return (num_connections(0) == first) && (num_connections(1) == second);
+    });
+  }
+
+  util::config cfg;
+  multiplexer_group<> group;
+  std::size_t default_load{0};
+  std::vector<stream_socket> peers;
+};
+
+} // namespace
+
+TEST(placement_policy, parse) {
+  for (auto policy :
+       {placement_policy::reuse_port, placement_policy::round_robin,
+        placement_policy::least_connections, placement_policy::least_lag}) {
+    EXPECT_EQ(UNPACK_EXPRESSION(parse_placement_policy(to_string(policy))),
+              policy);
+  }
+  EXPECT_TRUE(util::get_error(parse_placement_policy("invalid")));
+}
+
+TEST(multiplexer_group, invalid_config) {
+  util::config invalid_cfg;
+  invalid_cfg.add_config_entry("multiplexer.num-threads", std::int64_t{0});
+  multiplexer_group<> invalid_group;
+  EXPECT_NE(invalid_group.init({}, invalid_cfg), util::none);
+  EXPECT_EQ(invalid_group.size(), 0);
+  invalid_cfg.set_config_entry("multiplexer.num-threads", std::int64_t{1});
+  invalid_cfg.add_config_entry("multiplexer.placement", "invalid"s);
+  EXPECT_NE(invalid_group.init({}, invalid_cfg), util::none);
+  EXPECT_EQ(invalid_group.size(), 0);
+}
+
+TEST_P(multiplexer_group_test, init) {
+  ASSERT_EQ(group.size(), num_threads);
+  ASSERT_NE(group.port(), 0);
+  EXPECT_EQ(group.policy(), GetParam());
+  if (GetParam() == placement_policy::reuse_port) {
+    EXPECT_EQ(group.acceptor(), nullptr);
+    for (std::size_t i = 0; i < group.size(); ++i) {
+      EXPECT_EQ(group.at(i).port(), group.port());
+    }
+    // Each multiplexer holds its pollset_updater and acceptor
+    EXPECT_EQ(default_num_socket_managers, 2 * num_threads);
+  } else {
+    ASSERT_NE(group.acceptor(), nullptr);
+    for (std::size_t i = 0; i < group.size(); ++i) {
+      EXPECT_EQ(group.at(i).port(), 0);
+    }
+    // Workers only hold their pollset_updater
+    EXPECT_EQ(default_num_socket_managers, num_threads + 2);
+  }
+  EXPECT_NE(group.init({}, cfg), util::none);
+}
+
+TEST_P(multiplexer_group_test, connections_are_spread_across_multiplexers) {
+  static constexpr std::size_t num_sockets = 64;
+  group.start();
+  std::array<tcp_stream_socket, num_sockets> sockets;
+  for (std::size_t i = 0; i < num_sockets; ++i) {
+    sockets[i] = connect_to_group();
+    if (GetParam() == placement_policy::least_connections) {
+      // Wait for the placement to be visible to the acceptor
+      ASSERT_TRUE(test::wait_for([&] {
+        return group.num_socket_managers()
+               == (default_num_socket_managers + i + 1);
+      }));
+    }
+  }
+  ASSERT_TRUE(test::wait_for([&] {
+    return group.num_socket_managers()
+           == (default_num_socket_managers + num_sockets);
+  }));
+  switch (GetParam()) {
+    case placement_policy::round_robin:
+    case placement_policy::least_connections:
+      // Connections are distributed evenly
+      for (std::size_t i = 0; i < group.size(); ++i) {
+        EXPECT_EQ(num_connections(i), num_sockets / num_threads);
+      }
+      break;
+    default: {
+      // The kernel distributes connections by hashing, all landing on the
+      // same multiplexer is practically impossible. The lag of idle loops is
+      // close to zero, so least-lag distributes by load as well
+      std::size_t num_used_multiplexers = 0;
+      for (std::size_t i = 0; i < group.size(); ++i) {
+        if (num_connections(i) > 0) {
+          ++num_used_multiplexers;
+        }
+      }
+      EXPECT_GT(num_used_multiplexers, 1);
+      break;
+    }
+  }
+  for (auto sock : sockets) {
+    close(sock);
+  }
+  ASSERT_TRUE(test::wait_for([&] {
+    return group.num_socket_managers() == default_num_socket_managers;
+  }));
+  group.shutdown();
+  group.join();
+  EXPECT_EQ(group.num_socket_managers(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  multiplexer_group_tests, multiplexer_group_test,
+  testing::Values(placement_policy::reuse_port, placement_policy::round_robin,
+                  placement_policy::least_connections,
+                  placement_policy::least_lag),
+  [](const auto& info) {
+    auto name = to_string(info.param);
+    std::replace(name.begin(), name.end(), '-', '_');
+    return name;
+  });
+
+TEST_F(multiplexer_group_rebalance_test, moves_half_of_the_difference) {
+  init();
+  add_connections(10);
+  ASSERT_TRUE(wait_for_connections(10, 0));
+  EXPECT_EQ(group.rebalance(), 5);
+  EXPECT_TRUE(wait_for_connections(5, 5));
+  // Balanced groups are left alone
+  EXPECT_EQ(group.rebalance(), 0);
+}
+
+TEST_F(multiplexer_group_rebalance_test, tolerates_differences_in_threshold) {
+  cfg.add_config_entry("multiplexer.rebalance-threshold", std::int64_t{4});
+  init();
+  add_connections(4);
+  ASSERT_TRUE(wait_for_connections(4, 0));
+  EXPECT_EQ(group.rebalance(), 0);
+  EXPECT_TRUE(wait_for_connections(4, 0));
+}
+
+TEST_F(multiplexer_group_rebalance_test, rebalances_periodically) {
+  cfg.add_config_entry("multiplexer.rebalance-interval-ms", std::int64_t{5});
+  init();
+  add_connections(10);
+  ASSERT_TRUE(wait_for_connections(5, 5));
+  // Stops and joins the rebalancer before the workers
+  group.shutdown();
+  group.join();
+  EXPECT_EQ(group.num_socket_managers(), 0);
+}
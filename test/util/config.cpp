@@ -65,6 +65,21 @@ TEST(config, add_config_entry) {
     EXPECT_EQ(dict.at(p.first), p.second);
 }
 
+TEST(config, set_config_entry) {
+  util::config cfg = create_sample_config();
+  // add_config_entry never overwrites existing entries
+  cfg.add_config_entry(key3, std::int64_t{42});
+  EXPECT_EQ(*cfg.get<std::int64_t>(key3), std::int64_t{123456789});
+  // set_config_entry does
+  cfg.set_config_entry(key3, std::int64_t{42});
+  EXPECT_EQ(*cfg.get<std::int64_t>(key3), std::int64_t{42});
+  cfg.set_config_entry(key1, true);
+  EXPECT_TRUE(cfg.has_entry<bool>(key1));
+  cfg.set_config_entry("new_key", "value"s);
+  EXPECT_EQ(*cfg.get<std::string>("new_key"), "value"s);
+  EXPECT_EQ(cfg.get_entries().size(), sample_entries.size() + 1);
+}
+
 TEST(config, get) {
   const util::config cfg = create_sample_config();
 
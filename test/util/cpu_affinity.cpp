@@ -0,0 +1,60 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      cpu_affinity.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/cpu_affinity.hpp"
+
+#include "net_test.hpp"
+
+#include <thread>
+
+using util::cpu_list;
+
+TEST(cpu_affinity, parse_cpu_list) {
+  auto res = util::parse_cpu_list("0-3,8, 10-11\n");
+  ASSERT_EQ(util::get_error(res), nullptr);
+  EXPECT_EQ(std::get<cpu_list>(res), (cpu_list{0, 1, 2, 3, 8, 10, 11}));
+  // Duplicates are removed and the result is sorted
+  res = util::parse_cpu_list("5,1-2,2");
+  ASSERT_EQ(util::get_error(res), nullptr);
+  EXPECT_EQ(std::get<cpu_list>(res), (cpu_list{1, 2, 5}));
+}
+
+TEST(cpu_affinity, parse_invalid_cpu_list) {
+  for (const auto* str : {"", "a", "1,,2", "3-1", "1-", "-1", "0-100000"}) {
+    const auto res = util::parse_cpu_list(str);
+    ASSERT_NE(util::get_error(res), nullptr) << str;
+    EXPECT_EQ(util::get_error(res)->code(), util::error_code::parser_error);
+  }
+}
+
+#if defined(__linux__)
+
+TEST(cpu_affinity, pin_current_thread) {
+  const auto allowed = util::allowed_cpus();
+  ASSERT_FALSE(allowed.empty());
+  const cpu_list pinned{allowed.back()};
+  std::thread worker{[&] {
+    EXPECT_EQ(util::pin_current_thread(pinned), util::none);
+    EXPECT_EQ(util::allowed_cpus(), pinned);
+  }};
+  worker.join();
+  // Other threads are not affected
+  EXPECT_EQ(util::allowed_cpus(), allowed);
+  EXPECT_NE(util::pin_current_thread({}), util::none);
+}
+
+TEST(cpu_affinity, numa_node_cpus) {
+  const auto res = util::numa_node_cpus(0);
+  if (util::get_error(res) != nullptr) {
+    GTEST_SKIP() << "no NUMA information available";
+  }
+  EXPECT_FALSE(std::get<cpu_list>(res).empty());
+  EXPECT_NE(util::get_error(util::numa_node_cpus(100'000)), nullptr);
+}
+
+#endif
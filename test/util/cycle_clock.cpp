@@ -0,0 +1,42 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      cycle_clock.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/cycle_clock.hpp"
+
+#include "net_test.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST(cycle_clock, monotonic) {
+  const auto first = util::cycle_clock::now();
+  const auto second = util::cycle_clock::now();
+  EXPECT_GE(second, first);
+  EXPECT_GT(util::cycle_clock::ticks_per_ns(), 0.0);
+}
+
+TEST(cycle_clock, conversion) {
+  EXPECT_EQ(util::cycle_clock::to_ticks(0ns), 0);
+  EXPECT_EQ(util::cycle_clock::to_ticks(-1ns), 0);
+  const auto ticks = util::cycle_clock::to_ticks(1ms);
+  EXPECT_GT(ticks, 0);
+  const auto roundtrip = util::cycle_clock::to_duration(ticks);
+  EXPECT_GE(roundtrip, 999us);
+  EXPECT_LE(roundtrip, 1001us);
+}
+
+TEST(cycle_clock, measures_elapsed_time) {
+  const auto start = util::cycle_clock::now();
+  std::this_thread::sleep_for(5ms);
+  const auto elapsed = util::cycle_clock::to_duration(util::cycle_clock::now()
+                                                      - start);
+  EXPECT_GE(elapsed, 4ms);
+  EXPECT_LT(elapsed, 1s);
+}
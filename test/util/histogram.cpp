@@ -0,0 +1,75 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      histogram.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/histogram.hpp"
+
+#include "net_test.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+TEST(histogram, buckets) {
+  EXPECT_EQ(util::histogram::bucket_for(0), 0);
+  EXPECT_EQ(util::histogram::bucket_for(1), 1);
+  EXPECT_EQ(util::histogram::bucket_for(2), 2);
+  EXPECT_EQ(util::histogram::bucket_for(3), 2);
+  EXPECT_EQ(util::histogram::bucket_for(4), 3);
+  EXPECT_EQ(util::histogram::bucket_for(
+              std::numeric_limits<std::uint64_t>::max()),
+            64);
+  EXPECT_EQ(util::histogram::upper_limit(0), 0);
+  EXPECT_EQ(util::histogram::upper_limit(3), 7);
+  EXPECT_EQ(util::histogram::upper_limit(64),
+            std::numeric_limits<std::uint64_t>::max());
+}
+
+TEST(histogram, record) {
+  util::histogram hist;
+  for (std::uint64_t i = 1; i <= 100; ++i) {
+    hist.record(i);
+  }
+  const auto snapshot = hist.read();
+  EXPECT_EQ(snapshot.count, 100);
+  EXPECT_EQ(snapshot.sum, 5050);
+  EXPECT_EQ(snapshot.max, 100);
+  EXPECT_DOUBLE_EQ(snapshot.mean(), 50.5);
+  EXPECT_EQ(snapshot.buckets[1], 1);
+  EXPECT_EQ(snapshot.buckets[7], 37);
+}
+
+TEST(histogram, percentile) {
+  util::histogram hist;
+  EXPECT_EQ(hist.read().percentile(0.5), 0);
+  for (int i = 0; i < 90; ++i) {
+    hist.record(10);
+  }
+  for (int i = 0; i < 10; ++i) {
+    hist.record(1000);
+  }
+  const auto snapshot = hist.read();
+  EXPECT_EQ(snapshot.percentile(0.5), 15);
+  EXPECT_EQ(snapshot.percentile(0.95), 1000);
+  EXPECT_EQ(snapshot.percentile(1.0), 1000);
+}
+
+TEST(histogram, concurrent_read) {
+  util::histogram hist;
+  constexpr std::uint64_t num_values = 100000;
+  std::jthread writer{[&] {
+    for (std::uint64_t i = 0; i < num_values; ++i) {
+      hist.record(i);
+    }
+  }};
+  std::uint64_t last_count = 0;
+  while (last_count < num_values) {
+    const auto count = hist.read().count;
+    EXPECT_GE(count, last_count);
+    last_count = count;
+  }
+}
@@ -0,0 +1,115 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      mpsc_queue.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/mpsc_queue.hpp"
+
+#include "net_test.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(mpsc_queue, capacity) {
+  EXPECT_EQ(util::mpsc_queue<int>{0}.capacity(), 2);
+  EXPECT_EQ(util::mpsc_queue<int>{8}.capacity(), 8);
+  EXPECT_EQ(util::mpsc_queue<int>{100}.capacity(), 128);
+}
+
+TEST(mpsc_queue, push_pop) {
+  util::mpsc_queue<int> queue{4};
+  int value = 0;
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.try_push(1));
+  EXPECT_TRUE(queue.try_push(2));
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(mpsc_queue, full) {
+  util::mpsc_queue<int> queue{4};
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(queue.try_push(int{i}));
+  }
+  EXPECT_FALSE(queue.try_push(4));
+  int value = 0;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(queue.try_push(4));
+}
+
+TEST(mpsc_queue, wraparound) {
+  util::mpsc_queue<int> queue{4};
+  int value = 0;
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(queue.try_push(int{i}));
+    EXPECT_TRUE(queue.try_push(i + 100));
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i + 100);
+  }
+}
+
+TEST(mpsc_queue, failed_push_does_not_move) {
+  util::mpsc_queue<std::unique_ptr<int>> queue{2};
+  EXPECT_TRUE(queue.try_push(std::make_unique<int>(1)));
+  EXPECT_TRUE(queue.try_push(std::make_unique<int>(2)));
+  auto ptr = std::make_unique<int>(3);
+  EXPECT_FALSE(queue.try_push(std::move(ptr)));
+  ASSERT_NE(ptr, nullptr);
+  EXPECT_EQ(*ptr, 3);
+}
+
+TEST(mpsc_queue, destroys_remaining_elements) {
+  auto ptr = std::make_shared<int>(42);
+  {
+    util::mpsc_queue<std::shared_ptr<int>> queue{4};
+    EXPECT_TRUE(queue.try_push(std::shared_ptr<int>{ptr}));
+    EXPECT_TRUE(queue.try_push(std::shared_ptr<int>{ptr}));
+    EXPECT_EQ(ptr.use_count(), 3);
+  }
+  EXPECT_EQ(ptr.use_count(), 1);
+}
+
+TEST(mpsc_queue, multiple_producers) {
+  static constexpr std::size_t num_producers = 4;
+  static constexpr std::size_t num_values = 10000;
+  util::mpsc_queue<std::size_t> queue{64};
+  std::vector<std::thread> producers;
+  for (std::size_t p = 0; p < num_producers; ++p) {
+    producers.emplace_back([&queue, p]() {
+      for (std::size_t i = 0; i < num_values; ++i) {
+        while (!queue.try_push((p * num_values) + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  // Values of every producer arrive in the order they were pushed
+  std::vector<std::size_t> next(num_producers, 0);
+  std::size_t num_received = 0;
+  std::size_t value = 0;
+  while (num_received < (num_producers * num_values)) {
+    if (!queue.try_pop(value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    const auto producer = value / num_values;
+    ASSERT_LT(producer, num_producers);
+    EXPECT_EQ(value % num_values, next[producer]++);
+    ++num_received;
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+}
@@ -0,0 +1,63 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      slot_table.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/slot_table.hpp"
+
+#include "net_test.hpp"
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+TEST(slot_table, finds_inserted_values) {
+  util::slot_table<int> table{4};
+  const auto first = table.insert(1);
+  const auto second = table.insert(2);
+  EXPECT_NE(first, second);
+  EXPECT_NE(first, 0);
+  EXPECT_NE(second, 0);
+  EXPECT_EQ(table.size(), 2);
+  ASSERT_NE(table.find(first), nullptr);
+  EXPECT_EQ(*table.find(first), 1);
+  ASSERT_NE(table.find(second), nullptr);
+  EXPECT_EQ(*table.find(second), 2);
+}
+
+TEST(slot_table, erased_keys_are_stale) {
+  util::slot_table<int> table{1};
+  const auto first = table.insert(1);
+  EXPECT_TRUE(table.erase(first));
+  EXPECT_FALSE(table.erase(first));
+  EXPECT_EQ(table.find(first), nullptr);
+  // The slot is reused under a new generation
+  const auto second = table.insert(2);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(table.capacity(), 1);
+  EXPECT_EQ(table.find(first), nullptr);
+  ASSERT_NE(table.find(second), nullptr);
+  EXPECT_EQ(*table.find(second), 2);
+  EXPECT_EQ(table.find(std::uint64_t{1} << 40), nullptr);
+}
+
+TEST(slot_table, grows_when_full) {
+  util::slot_table<int> table{2};
+  std::vector<std::uint64_t> keys;
+  for (int i = 0; i < 5; ++i) {
+    keys.push_back(table.insert(i));
+  }
+  EXPECT_EQ(table.size(), 5);
+  EXPECT_GE(table.capacity(), 5);
+  EXPECT_EQ(std::set<std::uint64_t>(keys.begin(), keys.end()).size(), 5);
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_NE(table.find(keys[i]), nullptr);
+    EXPECT_EQ(*table.find(keys[i]), i);
+  }
+  int sum = 0;
+  table.for_each([&sum](int value) { sum += value; });
+  EXPECT_EQ(sum, 10);
+}
@@ -0,0 +1,47 @@
+/**
+ *  @author    Jakob Otto
+ *  @file      token_bucket.cpp
+ *  @copyright Copyright 2023 Jakob Otto. All rights reserved.
+ *             This file is part of the network-driver project, released under
+ *             the GNU GPL3 License.
+ */
+
+#include "util/token_bucket.hpp"
+
+#include "net_test.hpp"
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+const auto start = util::token_bucket::clock_type::now();
+
+} // namespace
+
+TEST(token_bucket, admits_bursts) {
+  util::token_bucket bucket{1, 3, start};
+  EXPECT_TRUE(bucket.try_acquire(start));
+  EXPECT_TRUE(bucket.try_acquire(start));
+  EXPECT_TRUE(bucket.try_acquire(start));
+  EXPECT_FALSE(bucket.try_acquire(start));
+}
+
+TEST(token_bucket, refills_at_rate) {
+  util::token_bucket bucket{10, 1, start};
+  EXPECT_TRUE(bucket.try_acquire(start));
+  EXPECT_FALSE(bucket.try_acquire(start + 50ms));
+  EXPECT_TRUE(bucket.try_acquire(start + 100ms));
+  EXPECT_FALSE(bucket.try_acquire(start + 100ms));
+}
+
+TEST(token_bucket, does_not_exceed_burst) {
+  util::token_bucket bucket{100, 2, start};
+  EXPECT_TRUE(bucket.full(start + 10s));
+  EXPECT_TRUE(bucket.try_acquire(start + 10s));
+  EXPECT_FALSE(bucket.full(start + 10s));
+  EXPECT_TRUE(bucket.try_acquire(start + 10s));
+  EXPECT_FALSE(bucket.try_acquire(start + 10s));
+  EXPECT_TRUE(bucket.full(start + 11s));
+}